@@ -15,6 +15,8 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "asio/adaptive_buffer_size.hpp"
+#include "asio/aligned_buffer_pool.hpp"
 #include "asio/any_completion_executor.hpp"
 #include "asio/any_completion_handler.hpp"
 #include "asio/any_io_executor.hpp"
@@ -27,9 +29,11 @@
 #include "asio/associator.hpp"
 #include "asio/async_result.hpp"
 #include "asio/awaitable.hpp"
+#include "asio/basic_connection_pool.hpp"
 #include "asio/basic_datagram_socket.hpp"
 #include "asio/basic_file.hpp"
 #include "asio/basic_io_object.hpp"
+#include "asio/basic_process.hpp"
 #include "asio/basic_random_access_file.hpp"
 #include "asio/basic_raw_socket.hpp"
 #include "asio/basic_readable_pipe.hpp"
@@ -71,6 +75,7 @@
 #include "asio/config.hpp"
 #include "asio/connect.hpp"
 #include "asio/connect_pipe.hpp"
+#include "asio/connect_racing.hpp"
 #include "asio/consign.hpp"
 #include "asio/coroutine.hpp"
 #include "asio/defer.hpp"
@@ -98,17 +103,20 @@
 #include "asio/executor.hpp"
 #include "asio/executor_work_guard.hpp"
 #include "asio/file_base.hpp"
+#include "asio/file_request.hpp"
 #include "asio/generic/basic_endpoint.hpp"
 #include "asio/generic/datagram_protocol.hpp"
 #include "asio/generic/raw_protocol.hpp"
 #include "asio/generic/seq_packet_protocol.hpp"
 #include "asio/generic/stream_protocol.hpp"
+#include "asio/handler_allocation_stats.hpp"
 #include "asio/handler_continuation_hook.hpp"
 #include "asio/high_resolution_timer.hpp"
 #include "asio/immediate.hpp"
 #include "asio/inline_executor.hpp"
 #include "asio/inline_or_executor.hpp"
 #include "asio/io_context.hpp"
+#include "asio/io_context_pool.hpp"
 #include "asio/io_context_strand.hpp"
 #include "asio/ip/address.hpp"
 #include "asio/ip/address_v4.hpp"
@@ -144,6 +152,7 @@
 #include "asio/local/datagram_protocol.hpp"
 #include "asio/local/seq_packet_protocol.hpp"
 #include "asio/local/stream_protocol.hpp"
+#include "asio/mapped_file.hpp"
 #include "asio/multiple_exceptions.hpp"
 #include "asio/packaged_task.hpp"
 #include "asio/placeholders.hpp"
@@ -155,6 +164,8 @@
 #include "asio/post.hpp"
 #include "asio/prefer.hpp"
 #include "asio/prepend.hpp"
+#include "asio/process.hpp"
+#include "asio/process_base.hpp"
 #include "asio/query.hpp"
 #include "asio/random_access_file.hpp"
 #include "asio/read.hpp"
@@ -167,6 +178,7 @@
 #include "asio/registered_buffer.hpp"
 #include "asio/require.hpp"
 #include "asio/require_concept.hpp"
+#include "asio/segmented_buffer.hpp"
 #include "asio/serial_port.hpp"
 #include "asio/serial_port_base.hpp"
 #include "asio/signal_set.hpp"
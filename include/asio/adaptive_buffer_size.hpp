@@ -0,0 +1,113 @@
+//
+// adaptive_buffer_size.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_ADAPTIVE_BUFFER_SIZE_HPP
+#define ASIO_ADAPTIVE_BUFFER_SIZE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+class aligned_buffer_pool;
+
+/// Specifies adaptive sizing for the storage of a buffered stream.
+/**
+ * When a buffered_read_stream, buffered_write_stream or buffered_stream is
+ * constructed with an adaptive_buffer_size object, its internal storage is
+ * sized according to the observed transfer sizes:
+ *
+ * @li The storage is doubled, up to the maximum size, when a transfer fills
+ * it completely.
+ *
+ * @li The storage is halved, down to the minimum size, after a number of
+ * consecutive transfers use less than a quarter of it.
+ *
+ * @li The storage is released whenever it holds no data, and is acquired again
+ * when needed. Idle connections therefore hold no buffer memory.
+ *
+ * Storage is obtained from a pool of blocks shared by the execution context
+ * of the stream's executor. Sizes are rounded up to a power of two. The number
+ * of blocks cached for each size is set using the configuration option
+ * @c segmented_buffer / @c pool_capacity.
+ *
+ * Alternatively, storage may be obtained from an aligned_buffer_pool. The
+ * pool's buffers are registered with the execution context, which allows the
+ * implementation to use registered buffer operations, such as those provided
+ * by io_uring, where supported. The maximum size is then the pool's buffer
+ * size. When the pool is exhausted, storage is obtained from the shared pool
+ * of blocks instead. An aligned_buffer_pool is not thread safe, so all
+ * streams that share one must be used from the same thread or strand.
+ */
+class adaptive_buffer_size
+{
+public:
+  /// Construct with the given minimum and maximum sizes.
+  explicit adaptive_buffer_size(std::size_t min_size = 512,
+      std::size_t max_size = 65536) noexcept
+    : min_size_(min_size),
+      max_size_(max_size < min_size ? min_size : max_size),
+      registered_pool_(0)
+  {
+  }
+
+  /// Construct to use buffers from an aligned_buffer_pool.
+  /**
+   * @param pool The pool from which storage is acquired. The pool must
+   * outlive the streams that use it.
+   *
+   * @param min_size The minimum size of the storage.
+   */
+  explicit adaptive_buffer_size(aligned_buffer_pool& pool,
+      std::size_t min_size = 512) noexcept
+    : min_size_(min_size),
+      max_size_(0),
+      registered_pool_(&pool)
+  {
+  }
+
+  /// Get the minimum size of the storage.
+  std::size_t min_size() const noexcept
+  {
+    return min_size_;
+  }
+
+  /// Get the maximum size of the storage. A value of zero means that the
+  /// maximum is the buffer size of the registered buffer pool.
+  std::size_t max_size() const noexcept
+  {
+    return max_size_;
+  }
+
+  /// Get the registered buffer pool, if any.
+  aligned_buffer_pool* registered_pool() const noexcept
+  {
+    return registered_pool_;
+  }
+
+private:
+  std::size_t min_size_;
+  std::size_t max_size_;
+  aligned_buffer_pool* registered_pool_;
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_ADAPTIVE_BUFFER_SIZE_HPP
@@ -0,0 +1,267 @@
+//
+// aligned_buffer_pool.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_ALIGNED_BUFFER_POOL_HPP
+#define ASIO_ALIGNED_BUFFER_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include "asio/buffer.hpp"
+#include "asio/buffer_registration.hpp"
+#include "asio/detail/throw_exception.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/execution/executor.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/is_executor.hpp"
+#include "asio/registered_buffer.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// A pool of aligned buffers that are registered with an execution context.
+/**
+ * The aligned_buffer_pool class allocates a fixed number of equally sized
+ * buffers whose addresses and sizes are multiples of a given alignment, and
+ * registers them with an execution context using buffer_registration. This
+ * makes the buffers suitable for files opened with file_base::direct, where
+ * the alignment is obtained from the file's @c alignment() function, and
+ * allows the implementation to use pre-registered buffers where supported.
+ *
+ * For portability, applications should assume that only one registration is
+ * permitted per execution context, and so only one aligned_buffer_pool may
+ * exist for each execution context.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * @par Example
+ * @code
+ * asio::random_access_file file(my_context, "/path/to/db",
+ *     asio::random_access_file::read_only
+ *       | asio::random_access_file::direct);
+ * asio::aligned_buffer_pool pool(my_context, 64, 65536, file.alignment());
+ * asio::mutable_registered_buffer b = pool.acquire();
+ * file.async_read_some_at(0, b, handler);
+ * @endcode
+ */
+class aligned_buffer_pool
+{
+public:
+  /// Allocate buffers and register them with an executor's execution context.
+  /**
+   * @param ex The executor whose execution context the buffers are registered
+   * with.
+   *
+   * @param buffer_count The number of buffers in the pool.
+   *
+   * @param buffer_size The size of each buffer. The size is rounded up to a
+   * multiple of @c alignment.
+   *
+   * @param alignment The alignment of each buffer. Must be a power of two.
+   *
+   * @throws std::invalid_argument Thrown if @c alignment is not a power of
+   * two.
+   */
+  template <typename Executor>
+  aligned_buffer_pool(const Executor& ex, std::size_t buffer_count,
+      std::size_t buffer_size, std::size_t alignment,
+      constraint_t<
+        is_executor<Executor>::value || execution::is_executor<Executor>::value
+      > = 0)
+    : storage_(allocate(buffer_count, buffer_size, alignment)),
+      buffer_size_(rounded_size(buffer_size, alignment)),
+      alignment_(alignment),
+      registration_(ex, make_buffers(storage_.data_, buffer_count,
+            rounded_size(buffer_size, alignment), alignment))
+  {
+    init_free_list();
+  }
+
+  /// Allocate buffers and register them with an execution context.
+  /**
+   * @param ctx The execution context with which the buffers are registered.
+   *
+   * @param buffer_count The number of buffers in the pool.
+   *
+   * @param buffer_size The size of each buffer. The size is rounded up to a
+   * multiple of @c alignment.
+   *
+   * @param alignment The alignment of each buffer. Must be a power of two.
+   *
+   * @throws std::invalid_argument Thrown if @c alignment is not a power of
+   * two.
+   */
+  template <typename ExecutionContext>
+  aligned_buffer_pool(ExecutionContext& ctx, std::size_t buffer_count,
+      std::size_t buffer_size, std::size_t alignment,
+      constraint_t<
+        is_convertible<ExecutionContext&, execution_context&>::value
+      > = 0)
+    : storage_(allocate(buffer_count, buffer_size, alignment)),
+      buffer_size_(rounded_size(buffer_size, alignment)),
+      alignment_(alignment),
+      registration_(ctx, make_buffers(storage_.data_, buffer_count,
+            rounded_size(buffer_size, alignment), alignment))
+  {
+    init_free_list();
+  }
+
+  /// Get the size of each buffer in the pool.
+  std::size_t buffer_size() const noexcept
+  {
+    return buffer_size_;
+  }
+
+  /// Get the alignment of each buffer in the pool.
+  std::size_t alignment() const noexcept
+  {
+    return alignment_;
+  }
+
+  /// Get the total number of buffers in the pool.
+  std::size_t capacity() const noexcept
+  {
+    return registration_.size();
+  }
+
+  /// Get the number of buffers that are available to be acquired.
+  std::size_t available() const noexcept
+  {
+    return free_.size();
+  }
+
+  /// Acquire a buffer from the pool.
+  /**
+   * @returns A registered buffer of buffer_size() bytes, or an empty buffer if
+   * all buffers in the pool are in use.
+   */
+  mutable_registered_buffer acquire() noexcept
+  {
+    if (free_.empty())
+      return mutable_registered_buffer();
+    std::size_t index = free_.back();
+    free_.pop_back();
+    in_use_[index] = true;
+    return registration_[index];
+  }
+
+  /// Return a buffer to the pool.
+  /**
+   * @param b A buffer that was obtained from acquire(). Buffers that were not
+   * obtained from this pool, or that have already been released, are ignored.
+   */
+  void release(const mutable_registered_buffer& b) noexcept
+  {
+    std::size_t index = index_of(b.data());
+    if (index < registration_.size() && in_use_[index])
+    {
+      in_use_[index] = false;
+      free_.push_back(index);
+    }
+  }
+
+private:
+  // Owns the memory used for the buffers. It is declared before the
+  // registration so that the buffers are unregistered before being freed.
+  struct storage
+  {
+    explicit storage(void* data) : data_(data) {}
+    ~storage() { ::operator delete(data_); }
+    void* data_;
+  };
+
+  // Disallow copying and assignment.
+  aligned_buffer_pool(const aligned_buffer_pool&) = delete;
+  aligned_buffer_pool& operator=(const aligned_buffer_pool&) = delete;
+
+  // Helper function to round a size up to the alignment.
+  static std::size_t rounded_size(std::size_t size, std::size_t alignment)
+  {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+      std::invalid_argument ex("aligned_buffer_pool alignment");
+      asio::detail::throw_exception(ex);
+    }
+    return (size + alignment - 1) & ~(alignment - 1);
+  }
+
+  // Helper function to allocate storage for the buffers. An extra alignment's
+  // worth of space is allocated so that the first buffer may be aligned.
+  static void* allocate(std::size_t buffer_count,
+      std::size_t buffer_size, std::size_t alignment)
+  {
+    return ::operator new(
+        buffer_count * rounded_size(buffer_size, alignment) + alignment);
+  }
+
+  // Helper function to divide the storage into aligned buffers.
+  static std::vector<mutable_buffer> make_buffers(void* storage,
+      std::size_t buffer_count, std::size_t buffer_size,
+      std::size_t alignment)
+  {
+    std::size_t address = reinterpret_cast<std::size_t>(storage);
+    char* first = static_cast<char*>(storage)
+      + ((alignment - address % alignment) % alignment);
+    std::vector<mutable_buffer> buffers(buffer_count);
+    for (std::size_t i = 0; i < buffer_count; ++i)
+      buffers[i] = mutable_buffer(first + i * buffer_size, buffer_size);
+    return buffers;
+  }
+
+  // Helper function to initialise the list of available buffers.
+  void init_free_list()
+  {
+    std::size_t n = registration_.size();
+    in_use_.assign(n, false);
+    free_.reserve(n);
+    for (std::size_t i = n; i > 0; --i)
+      free_.push_back(i - 1);
+  }
+
+  // Helper function to determine the index of a buffer from its address.
+  std::size_t index_of(const void* data) const noexcept
+  {
+    if (registration_.size() == 0 || buffer_size_ == 0)
+      return registration_.size();
+    const char* first = static_cast<const char*>(
+        registration_.begin()->data());
+    const char* p = static_cast<const char*>(data);
+    if (p < first)
+      return registration_.size();
+    std::size_t offset = static_cast<std::size_t>(p - first);
+    if (offset % buffer_size_ != 0)
+      return registration_.size();
+    return offset / buffer_size_;
+  }
+
+  storage storage_;
+  std::size_t buffer_size_;
+  std::size_t alignment_;
+  buffer_registration<std::vector<mutable_buffer>> registration_;
+  std::vector<std::size_t> free_;
+  std::vector<bool> in_use_;
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_ALIGNED_BUFFER_POOL_HPP
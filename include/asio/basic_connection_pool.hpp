@@ -0,0 +1,713 @@
+//
+// basic_connection_pool.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_BASIC_CONNECTION_POOL_HPP
+#define ASIO_BASIC_CONNECTION_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include "asio/any_completion_handler.hpp"
+#include "asio/any_io_executor.hpp"
+#include "asio/append.hpp"
+#include "asio/associated_cancellation_slot.hpp"
+#include "asio/async_result.hpp"
+#include "asio/basic_stream_socket.hpp"
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/buffer.hpp"
+#include "asio/cancellation_type.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/post.hpp"
+#include "asio/socket_base.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// Caches connected sockets for reuse.
+/**
+ * The basic_connection_pool class template maintains a cache of connected
+ * stream sockets, keyed by the remote endpoint. Sockets are obtained from the
+ * pool using async_acquire() and returned to it using release().
+ *
+ * When a socket is acquired, the most recently released idle socket for the
+ * endpoint is reused, provided that it passes a liveness check. The check
+ * performs a non-blocking, one-byte @c MSG_PEEK read on the socket: the socket
+ * is reused only if the read would block. Sockets that the peer has closed,
+ * that have failed, or that have unexpected data waiting to be read are
+ * discarded. If no idle socket is available, a new connection is established,
+ * unless the number of connections to the endpoint has reached the limit
+ * specified on construction. In that case, the operation waits until a socket
+ * for the endpoint is released. Waiting operations are completed in the order
+ * in which they were started.
+ *
+ * Idle sockets are closed once they have been unused for the idle timeout
+ * specified on construction. All idle sockets share a single timer.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * The pool's internal completion handlers run on the pool's executor. When the
+ * pool is used from multiple threads, a strand should be used as the executor.
+ *
+ * @par Example
+ * @code
+ * asio::basic_connection_pool<asio::ip::tcp> pool(my_context,
+ *     4, std::chrono::seconds(30));
+ *
+ * // ...
+ *
+ * pool.async_acquire(endpoint,
+ *     [&](asio::error_code ec, asio::ip::tcp::socket s)
+ *     {
+ *       if (!ec)
+ *       {
+ *         // Use the socket, then return it to the pool.
+ *         pool.release(endpoint, std::move(s));
+ *       }
+ *     });
+ * @endcode
+ */
+template <typename Protocol, typename Executor = any_io_executor>
+class basic_connection_pool
+{
+private:
+  class initiate_async_acquire;
+
+public:
+  /// The type of the executor associated with the object.
+  typedef Executor executor_type;
+
+  /// The protocol type.
+  typedef Protocol protocol_type;
+
+  /// The endpoint type.
+  typedef typename Protocol::endpoint endpoint_type;
+
+  /// The type of the sockets held in the pool.
+  typedef basic_stream_socket<Protocol, Executor> socket_type;
+
+  /// The type used to specify the idle timeout.
+  typedef std::chrono::steady_clock::duration duration;
+
+  /// Construct a connection pool.
+  /**
+   * @param ex The I/O executor that the pool will use, by default, to
+   * dispatch handlers for any asynchronous operations, and with which the
+   * pool's sockets are created.
+   *
+   * @param max_connections The maximum number of connections to each
+   * endpoint, including both idle sockets and sockets that have been acquired.
+   *
+   * @param idle_timeout The length of time for which a socket may remain idle
+   * in the pool before it is closed.
+   */
+  basic_connection_pool(const executor_type& ex, std::size_t max_connections,
+      const duration& idle_timeout)
+    : impl_(std::make_shared<impl>(ex, max_connections, idle_timeout))
+  {
+  }
+
+  /// Construct a connection pool.
+  /**
+   * @param context An execution context which provides the I/O executor that
+   * the pool will use, by default, to dispatch handlers for any asynchronous
+   * operations, and with which the pool's sockets are created.
+   *
+   * @param max_connections The maximum number of connections to each
+   * endpoint, including both idle sockets and sockets that have been acquired.
+   *
+   * @param idle_timeout The length of time for which a socket may remain idle
+   * in the pool before it is closed.
+   */
+  template <typename ExecutionContext>
+  basic_connection_pool(ExecutionContext& context,
+      std::size_t max_connections, const duration& idle_timeout,
+      constraint_t<
+        is_convertible<ExecutionContext&, execution_context&>::value
+      > = 0)
+    : impl_(std::make_shared<impl>(context.get_executor(),
+          max_connections, idle_timeout))
+  {
+  }
+
+  /// Destroys the connection pool.
+  /**
+   * Closes all idle sockets. Operations that are waiting for a socket, or for
+   * a connection to be established, complete with the
+   * asio::error::operation_aborted error. Sockets that have been acquired are
+   * not affected.
+   */
+  ~basic_connection_pool()
+  {
+    impl_->shutdown();
+  }
+
+  /// Get the executor associated with the object.
+  executor_type get_executor() const noexcept
+  {
+    return impl_->executor_;
+  }
+
+  /// Get the maximum number of connections to each endpoint.
+  std::size_t max_connections() const noexcept
+  {
+    return impl_->max_connections_;
+  }
+
+  /// Get the idle timeout.
+  duration idle_timeout() const noexcept
+  {
+    return impl_->idle_timeout_;
+  }
+
+  /// Get the number of idle sockets in the pool.
+  std::size_t idle_count() const noexcept
+  {
+    return impl_->idle_.size();
+  }
+
+  /// Get the number of connections to an endpoint.
+  /**
+   * @returns The number of idle sockets, acquired sockets, and connections
+   * being established for the endpoint.
+   */
+  std::size_t connection_count(const endpoint_type& endpoint) const
+  {
+    typename impl::endpoint_map::const_iterator iter
+      = impl_->endpoints_.find(endpoint);
+    return iter == impl_->endpoints_.end() ? 0 : iter->second.connections;
+  }
+
+  /// Start an asynchronous operation to acquire a connected socket.
+  /**
+   * This function is used to asynchronously obtain a socket that is connected
+   * to the specified endpoint. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * @param endpoint The remote endpoint to which the socket is connected.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when a socket is available.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   // Result of operation. If a new connection could not be
+   *   // established, contains the error from the connect operation.
+   *   const asio::error_code& error,
+   *
+   *   // On success, the connected socket.
+   *   socket_type socket
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, socket_type) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * While the operation is waiting for a socket to be released, it supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        socket_type)) AcquireToken = default_completion_token_t<executor_type>>
+  auto async_acquire(const endpoint_type& endpoint,
+      AcquireToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<AcquireToken, void (asio::error_code, socket_type)>(
+        declval<initiate_async_acquire>(), token, endpoint))
+  {
+    return async_initiate<AcquireToken,
+      void (asio::error_code, socket_type)>(
+        initiate_async_acquire(impl_), token, endpoint);
+  }
+
+  /// Return a socket to the pool.
+  /**
+   * If an operation is waiting for a socket to the endpoint, the socket is
+   * passed to it. Otherwise, the socket is kept as an idle socket.
+   *
+   * @param endpoint The endpoint that was passed to async_acquire() when the
+   * socket was obtained.
+   *
+   * @param socket The socket to be returned. If the socket is not open, the
+   * connection is removed from the pool, allowing a new connection to be
+   * established in its place.
+   */
+  void release(const endpoint_type& endpoint, socket_type socket)
+  {
+    impl_->release(endpoint, static_cast<socket_type&&>(socket));
+  }
+
+private:
+  // Disallow copying and assignment.
+  basic_connection_pool(const basic_connection_pool&) = delete;
+  basic_connection_pool& operator=(const basic_connection_pool&) = delete;
+
+  typedef any_completion_handler<void (asio::error_code, socket_type)>
+    handler_type;
+
+  typedef basic_waitable_timer<std::chrono::steady_clock,
+      wait_traits<std::chrono::steady_clock>, Executor> timer_type;
+
+  // The state of the pool. It is shared with the pool's outstanding
+  // operations so that they may safely complete after the pool is destroyed.
+  class impl : public std::enable_shared_from_this<impl>
+  {
+  public:
+    struct idle_socket
+    {
+      idle_socket(socket_type&& s, const endpoint_type& ep,
+          const std::chrono::steady_clock::time_point& t)
+        : socket(static_cast<socket_type&&>(s)),
+          endpoint(ep),
+          expiry(t)
+      {
+      }
+
+      socket_type socket;
+      endpoint_type endpoint;
+      std::chrono::steady_clock::time_point expiry;
+    };
+
+    // All idle sockets share the same timeout, so a list ordered by release
+    // time is also ordered by expiry. The single timer waits for the expiry
+    // of the socket at the front.
+    typedef std::list<idle_socket> idle_list;
+
+    struct waiter
+    {
+      std::size_t id;
+      handler_type handler;
+    };
+
+    struct endpoint_state
+    {
+      endpoint_state() : connections(0) {}
+
+      // The number of idle sockets, acquired sockets and connects in progress.
+      std::size_t connections;
+
+      // The endpoint's entries in the idle list, oldest first. Sockets are
+      // reused from the back so that the warmest connection is preferred.
+      std::deque<typename idle_list::iterator> idle;
+
+      // The operations waiting for a socket, in the order they were started.
+      std::deque<waiter> waiters;
+    };
+
+    typedef std::map<endpoint_type, endpoint_state> endpoint_map;
+
+    // The sockets of connects in progress. They are owned by the pool, rather
+    // than by the connect handlers, so that shutdown can close them.
+    typedef std::list<socket_type> socket_list;
+
+    // Removes a waiting operation when it is cancelled.
+    class cancellation_handler
+    {
+    public:
+      cancellation_handler(const std::shared_ptr<impl>& p,
+          const endpoint_type& ep, std::size_t id)
+        : impl_(p),
+          endpoint_(ep),
+          id_(id)
+      {
+      }
+
+      void operator()(cancellation_type_t type)
+      {
+        if (!!(type & (cancellation_type::terminal
+                | cancellation_type::partial
+                | cancellation_type::total)))
+        {
+          if (std::shared_ptr<impl> p = impl_.lock())
+            p->cancel_waiter(endpoint_, id_);
+        }
+      }
+
+    private:
+      std::weak_ptr<impl> impl_;
+      endpoint_type endpoint_;
+      std::size_t id_;
+    };
+
+    // The completion handler for connects started by the pool.
+    class connect_handler
+    {
+    public:
+      connect_handler(const std::shared_ptr<impl>& p, const endpoint_type& ep,
+          typename socket_list::iterator s, handler_type&& h)
+        : impl_(p),
+          endpoint_(ep),
+          socket_(s),
+          handler_(static_cast<handler_type&&>(h))
+      {
+      }
+
+      void operator()(const asio::error_code& ec)
+      {
+        impl_->on_connect(endpoint_, socket_,
+            static_cast<handler_type&&>(handler_), ec);
+      }
+
+    private:
+      std::shared_ptr<impl> impl_;
+      endpoint_type endpoint_;
+      typename socket_list::iterator socket_;
+      handler_type handler_;
+    };
+
+    // The completion handler for the idle timer.
+    class timer_handler
+    {
+    public:
+      explicit timer_handler(const std::shared_ptr<impl>& p)
+        : impl_(p)
+      {
+      }
+
+      void operator()(const asio::error_code&)
+      {
+        impl_->on_timer();
+      }
+
+    private:
+      std::shared_ptr<impl> impl_;
+    };
+
+    impl(const executor_type& ex, std::size_t max_connections,
+        const duration& idle_timeout)
+      : executor_(ex),
+        max_connections_(max_connections),
+        idle_timeout_(idle_timeout),
+        timer_(ex),
+        timer_active_(false),
+        next_waiter_id_(0),
+        shutdown_(false)
+    {
+    }
+
+    void acquire(const endpoint_type& ep, handler_type&& handler)
+    {
+      if (shutdown_)
+      {
+        complete(handler, asio::error::operation_aborted);
+        return;
+      }
+
+      endpoint_state& state = endpoints_[ep];
+      while (!state.idle.empty())
+      {
+        typename idle_list::iterator iter = state.idle.back();
+        state.idle.pop_back();
+        socket_type socket(static_cast<socket_type&&>(iter->socket));
+        idle_.erase(iter);
+
+        if (is_alive(socket))
+        {
+          complete(handler, asio::error_code(),
+              static_cast<socket_type&&>(socket));
+          return;
+        }
+
+        asio::error_code ignored_ec;
+        socket.close(ignored_ec);
+        --state.connections;
+      }
+
+      if (state.connections < max_connections_)
+      {
+        ++state.connections;
+        start_connect(ep, static_cast<handler_type&&>(handler));
+        return;
+      }
+
+      // Wait for a socket to be released.
+      std::size_t id = next_waiter_id_++;
+      cancellation_slot slot = handler.get_cancellation_slot();
+      if (slot.is_connected())
+      {
+        slot.template emplace<cancellation_handler>(
+            this->shared_from_this(), ep, id);
+      }
+      waiter w = { id, static_cast<handler_type&&>(handler) };
+      state.waiters.push_back(static_cast<waiter&&>(w));
+    }
+
+    void release(const endpoint_type& ep, socket_type&& socket)
+    {
+      typename endpoint_map::iterator iter = endpoints_.find(ep);
+      if (shutdown_ || iter == endpoints_.end() || !socket.is_open())
+      {
+        asio::error_code ignored_ec;
+        socket.close(ignored_ec);
+        if (!shutdown_ && iter != endpoints_.end())
+          connection_closed(iter);
+        return;
+      }
+
+      endpoint_state& state = iter->second;
+      if (!state.waiters.empty())
+      {
+        // The connection is handed over, so the count is unchanged.
+        handler_type handler(
+            static_cast<handler_type&&>(state.waiters.front().handler));
+        state.waiters.pop_front();
+        complete(handler, asio::error_code(),
+            static_cast<socket_type&&>(socket));
+        return;
+      }
+
+      idle_.push_back(idle_socket(static_cast<socket_type&&>(socket), ep,
+            std::chrono::steady_clock::now() + idle_timeout_));
+      state.idle.push_back(--idle_.end());
+      start_timer();
+    }
+
+    void shutdown()
+    {
+      shutdown_ = true;
+
+      asio::error_code ignored_ec;
+      timer_.cancel();
+      for (typename idle_list::iterator iter = idle_.begin();
+          iter != idle_.end(); ++iter)
+        iter->socket.close(ignored_ec);
+      idle_.clear();
+
+      // Closing the sockets makes the connects complete promptly. The entries
+      // are removed by the connect handlers.
+      for (typename socket_list::iterator iter = connecting_.begin();
+          iter != connecting_.end(); ++iter)
+        iter->close(ignored_ec);
+
+      endpoint_map endpoints;
+      endpoints.swap(endpoints_);
+      for (typename endpoint_map::iterator iter = endpoints.begin();
+          iter != endpoints.end(); ++iter)
+      {
+        std::deque<waiter>& waiters = iter->second.waiters;
+        for (std::size_t i = 0; i < waiters.size(); ++i)
+          complete(waiters[i].handler, asio::error::operation_aborted);
+      }
+    }
+
+    executor_type executor_;
+    std::size_t max_connections_;
+    duration idle_timeout_;
+    endpoint_map endpoints_;
+    idle_list idle_;
+
+  private:
+    // Checks that the peer has not closed an idle connection. A read that
+    // returns zero bytes cannot be distinguished from end of file, so a
+    // one-byte peek is used and the socket is alive only if it would block.
+    static bool is_alive(socket_type& socket)
+    {
+      asio::error_code ec;
+      bool mode = socket.non_blocking();
+      socket.non_blocking(true, ec);
+      if (ec)
+        return false;
+
+      char data;
+      socket.receive(asio::buffer(&data, 1),
+          socket_base::message_peek, ec);
+
+      asio::error_code ignored_ec;
+      socket.non_blocking(mode, ignored_ec);
+      return ec == asio::error::would_block || ec == asio::error::try_again;
+    }
+
+    void start_connect(const endpoint_type& ep, handler_type&& handler)
+    {
+      typename socket_list::iterator socket
+        = connecting_.insert(connecting_.end(), socket_type(executor_));
+      socket->async_connect(ep, connect_handler(this->shared_from_this(), ep,
+            socket, static_cast<handler_type&&>(handler)));
+    }
+
+    void on_connect(const endpoint_type& ep,
+        typename socket_list::iterator connecting,
+        handler_type&& handler, const asio::error_code& ec)
+    {
+      socket_type socket(static_cast<socket_type&&>(*connecting));
+      connecting_.erase(connecting);
+
+      if (shutdown_)
+      {
+        asio::error_code ignored_ec;
+        socket.close(ignored_ec);
+        complete(handler, asio::error::operation_aborted);
+        return;
+      }
+
+      if (ec)
+      {
+        complete(handler, ec);
+        connection_closed(endpoints_.find(ep));
+        return;
+      }
+
+      complete(handler, ec, static_cast<socket_type&&>(socket));
+    }
+
+    // Removes a connection from an endpoint's count, and starts a new
+    // connection for the next waiting operation, if any.
+    void connection_closed(typename endpoint_map::iterator iter)
+    {
+      endpoint_state& state = iter->second;
+      --state.connections;
+      if (!state.waiters.empty())
+      {
+        handler_type handler(
+            static_cast<handler_type&&>(state.waiters.front().handler));
+        state.waiters.pop_front();
+        handler.get_cancellation_slot().clear();
+        ++state.connections;
+        start_connect(iter->first, static_cast<handler_type&&>(handler));
+      }
+      else if (state.connections == 0)
+      {
+        endpoints_.erase(iter);
+      }
+    }
+
+    void cancel_waiter(const endpoint_type& ep, std::size_t id)
+    {
+      typename endpoint_map::iterator iter = endpoints_.find(ep);
+      if (iter == endpoints_.end())
+        return;
+
+      std::deque<waiter>& waiters = iter->second.waiters;
+      for (typename std::deque<waiter>::iterator w = waiters.begin();
+          w != waiters.end(); ++w)
+      {
+        if (w->id == id)
+        {
+          handler_type handler(static_cast<handler_type&&>(w->handler));
+          waiters.erase(w);
+          complete(handler, asio::error::operation_aborted);
+          return;
+        }
+      }
+    }
+
+    void start_timer()
+    {
+      if (timer_active_ || idle_.empty())
+        return;
+
+      timer_active_ = true;
+      timer_.expires_at(idle_.front().expiry);
+      timer_.async_wait(timer_handler(this->shared_from_this()));
+    }
+
+    void on_timer()
+    {
+      timer_active_ = false;
+      if (shutdown_)
+        return;
+
+      std::chrono::steady_clock::time_point now
+        = std::chrono::steady_clock::now();
+      while (!idle_.empty() && idle_.front().expiry <= now)
+      {
+        typename endpoint_map::iterator iter
+          = endpoints_.find(idle_.front().endpoint);
+        iter->second.idle.pop_front();
+        asio::error_code ignored_ec;
+        idle_.front().socket.close(ignored_ec);
+        idle_.pop_front();
+        connection_closed(iter);
+      }
+
+      start_timer();
+    }
+
+    void complete(handler_type& handler, const asio::error_code& ec)
+    {
+      complete(handler, ec, socket_type(executor_));
+    }
+
+    void complete(handler_type& handler,
+        const asio::error_code& ec, socket_type&& socket)
+    {
+      handler.get_cancellation_slot().clear();
+      asio::post(executor_,
+          asio::append(static_cast<handler_type&&>(handler),
+            ec, static_cast<socket_type&&>(socket)));
+    }
+
+    socket_list connecting_;
+    timer_type timer_;
+    bool timer_active_;
+    std::size_t next_waiter_id_;
+    bool shutdown_;
+  };
+
+  class initiate_async_acquire
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_acquire(const std::shared_ptr<impl>& p)
+      : impl_(p)
+    {
+    }
+
+    executor_type get_executor() const noexcept
+    {
+      return impl_->executor_;
+    }
+
+    template <typename AcquireHandler>
+    void operator()(AcquireHandler&& handler,
+        const endpoint_type& endpoint) const
+    {
+      impl_->acquire(endpoint,
+          handler_type(static_cast<AcquireHandler&&>(handler)));
+    }
+
+  private:
+    std::shared_ptr<impl> impl_;
+  };
+
+  std::shared_ptr<impl> impl_;
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_BASIC_CONNECTION_POOL_HPP
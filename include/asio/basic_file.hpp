@@ -816,6 +816,38 @@ public:
     return impl_.get_service().size(impl_.get_implementation(), ec);
   }
 
+  /// Get the alignment required for direct I/O.
+  /**
+   * This function determines the alignment, in bytes, that buffer addresses,
+   * buffer sizes and file offsets must satisfy for reads and writes to bypass
+   * the operating system's page cache when the file is opened with
+   * file_base::direct. On Linux the value is obtained using @c statx.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  std::size_t alignment() const
+  {
+    asio::error_code ec;
+    std::size_t a = impl_.get_service().alignment(
+        impl_.get_implementation(), ec);
+    asio::detail::throw_error(ec, "alignment");
+    return a;
+  }
+
+  /// Get the alignment required for direct I/O.
+  /**
+   * This function determines the alignment, in bytes, that buffer addresses,
+   * buffer sizes and file offsets must satisfy for reads and writes to bypass
+   * the operating system's page cache when the file is opened with
+   * file_base::direct. On Linux the value is obtained using @c statx.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  std::size_t alignment(asio::error_code& ec) const
+  {
+    return impl_.get_service().alignment(impl_.get_implementation(), ec);
+  }
+
   /// Alter the size of the file.
   /**
    * This function resizes the file to the specified size, in bytes. If the
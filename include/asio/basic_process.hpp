@@ -0,0 +1,645 @@
+//
+// basic_process.hpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_BASIC_PROCESS_HPP
+#define ASIO_BASIC_PROCESS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_PROCESS) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <signal.h>
+#include <unistd.h>
+#include "asio/any_io_executor.hpp"
+#include "asio/async_result.hpp"
+#include "asio/basic_readable_pipe.hpp"
+#include "asio/basic_writable_pipe.hpp"
+#include "asio/compose.hpp"
+#include "asio/error.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/post.hpp"
+#include "asio/process_base.hpp"
+#include "asio/posix/basic_stream_descriptor.hpp"
+#include "asio/detail/process_ops.hpp"
+#include "asio/detail/throw_error.hpp"
+#include "asio/detail/type_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+#if !defined(ASIO_BASIC_PROCESS_FWD_DECL)
+#define ASIO_BASIC_PROCESS_FWD_DECL
+
+// Forward declaration with defaulted arguments.
+template <typename Executor = any_io_executor>
+class basic_process;
+
+#endif // !defined(ASIO_BASIC_PROCESS_FWD_DECL)
+
+/// Provides child process functionality.
+/**
+ * The basic_process class template spawns a child process, optionally
+ * connects the child's standard input, output and error to pipes, and waits
+ * for the child to exit.
+ *
+ * The child is created using @c posix_spawn. Exit notification uses a
+ * @c pidfd descriptor that is registered with the I/O executor's execution
+ * context, in the same way as any other descriptor. Waiting for a child does
+ * not involve @c SIGCHLD, and so does not affect, or depend on, the handling
+ * of that signal elsewhere in the program. However, the program must not reap
+ * the child by other means, such as by calling @c waitpid(-1, ...) or by
+ * setting the disposition of @c SIGCHLD to @c SIG_IGN.
+ *
+ * A child that is still running when the basic_process object is destroyed is
+ * terminated and reaped, so that it does not remain as a zombie process.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * @par Example
+ * Running a program and reading its output:
+ * @code
+ * asio::process child(my_context);
+ * child.spawn("/bin/ls", {"-l"}, asio::process::pipe_stdout);
+ *
+ * asio::async_read(child.std_out(), asio::dynamic_buffer(output),
+ *     [&](asio::error_code, std::size_t)
+ *     {
+ *       child.async_wait(
+ *           [](asio::error_code ec, int exit_code)
+ *           {
+ *             ...
+ *           });
+ *     });
+ * @endcode
+ */
+template <typename Executor>
+class basic_process
+  : public process_base
+{
+private:
+  class wait_op;
+
+public:
+  /// The type of the executor associated with the object.
+  typedef Executor executor_type;
+
+  /// Rebinds the process type to another executor.
+  template <typename Executor1>
+  struct rebind_executor
+  {
+    /// The process type when rebound to the specified executor.
+    typedef basic_process<Executor1> other;
+  };
+
+  /// The type of the pipe connected to the child's standard input.
+  typedef basic_writable_pipe<Executor> writable_pipe_type;
+
+  /// The type of the pipes connected to the child's standard output and error.
+  typedef basic_readable_pipe<Executor> readable_pipe_type;
+
+  /// Construct a basic_process without a child process.
+  /**
+   * @param ex The I/O executor that the process will use, by default, to
+   * dispatch handlers for any asynchronous operations performed on the
+   * process and its pipes.
+   */
+  explicit basic_process(const executor_type& ex)
+    : std_in_(ex),
+      std_out_(ex),
+      std_err_(ex)
+  {
+  }
+
+  /// Construct a basic_process without a child process.
+  /**
+   * @param context An execution context which provides the I/O executor that
+   * the process will use, by default, to dispatch handlers for any
+   * asynchronous operations performed on the process and its pipes.
+   */
+  template <typename ExecutionContext>
+  explicit basic_process(ExecutionContext& context,
+      constraint_t<
+        is_convertible<ExecutionContext&, execution_context&>::value,
+        defaulted_constraint
+      > = defaulted_constraint())
+    : std_in_(context),
+      std_out_(context),
+      std_err_(context)
+  {
+  }
+
+  /// Move-construct a basic_process from another.
+  /**
+   * @note Following the move, the moved-from object is in the same state as if
+   * constructed using the @c basic_process(const executor_type&) constructor.
+   */
+  basic_process(basic_process&& other)
+    : std_in_(std::move(other.std_in_)),
+      std_out_(std::move(other.std_out_)),
+      std_err_(std::move(other.std_err_)),
+      child_(std::move(other.child_))
+  {
+  }
+
+  /// Move-assign a basic_process from another.
+  /**
+   * If this object refers to a child that is still running, the child is
+   * terminated and reaped, as if by the destructor.
+   *
+   * @note Following the move, the moved-from object is in the same state as if
+   * constructed using the @c basic_process(const executor_type&) constructor.
+   */
+  basic_process& operator=(basic_process&& other)
+  {
+    if (this != &other)
+    {
+      terminate_and_reap();
+      std_in_ = std::move(other.std_in_);
+      std_out_ = std::move(other.std_out_);
+      std_err_ = std::move(other.std_err_);
+      child_ = std::move(other.child_);
+    }
+    return *this;
+  }
+
+  /// Destroys the process object.
+  /**
+   * Closes the pipes and cancels any outstanding asynchronous wait. A child
+   * process that is still running is terminated, by sending it @c SIGKILL, and
+   * then reaped. This blocks until the child has exited, which is normally
+   * immediate. To let the child finish its work, wait for it before the object
+   * is destroyed.
+   */
+  ~basic_process()
+  {
+    terminate_and_reap();
+  }
+
+  /// Get the executor associated with the object.
+  const executor_type& get_executor() noexcept
+  {
+    return std_in_.get_executor();
+  }
+
+  /// Spawn a child process.
+  /**
+   * @param path The path of the program to run. The path is not searched for
+   * in the @c PATH environment variable.
+   *
+   * @param args The arguments to pass to the program, not including the
+   * program name. The first argument received by the program is @c path.
+   *
+   * @param flags Selects the standard streams of the child that are connected
+   * to pipes. The remaining streams are inherited from the parent.
+   *
+   * @throws asio::system_error Thrown on failure. An error of
+   * asio::error::already_open indicates that a child process has been spawned
+   * and not yet waited for.
+   */
+  void spawn(const std::string& path,
+      const std::vector<std::string>& args,
+      stdio_flags flags = inherit_stdio)
+  {
+    asio::error_code ec;
+    spawn(path, args, flags, ec);
+    asio::detail::throw_error(ec, "spawn");
+  }
+
+  /// Spawn a child process.
+  /**
+   * @param path The path of the program to run. The path is not searched for
+   * in the @c PATH environment variable.
+   *
+   * @param args The arguments to pass to the program, not including the
+   * program name. The first argument received by the program is @c path.
+   *
+   * @param flags Selects the standard streams of the child that are connected
+   * to pipes. The remaining streams are inherited from the parent.
+   *
+   * @param ec Set to indicate what error occurred, if any. An error of
+   * asio::error::already_open indicates that a child process has been spawned
+   * and not yet waited for.
+   */
+  ASIO_SYNC_OP_VOID spawn(const std::string& path,
+      const std::vector<std::string>& args, stdio_flags flags,
+      asio::error_code& ec)
+  {
+    if (child_ && child_->exit_code_ == -1)
+    {
+      ec = asio::error::already_open;
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+    // The state is allocated first, so that a child is never left running
+    // because the allocation failed.
+    std::shared_ptr<child_state> child =
+      std::make_shared<child_state>(get_executor());
+
+    std::vector<char*> argv;
+    argv.reserve(args.size() + 2);
+    argv.push_back(const_cast<char*>(path.c_str()));
+    for (std::size_t i = 0; i < args.size(); ++i)
+      argv.push_back(const_cast<char*>(args[i].c_str()));
+    argv.push_back(0);
+
+    asio::error_code ignored_ec;
+    std_in_.close(ignored_ec);
+    std_out_.close(ignored_ec);
+    std_err_.close(ignored_ec);
+
+    int parent_fds[3] = { -1, -1, -1 };
+    int pidfd = -1;
+    int pid = detail::process_ops::spawn(path.c_str(), &argv[0],
+        static_cast<int>(flags), parent_fds, pidfd, ec);
+    if (pid == -1)
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+
+    child->pid_ = pid;
+    child->pidfd_.assign(pidfd, ec);
+    if (!ec && parent_fds[0] != -1)
+      std_in_.assign(parent_fds[0], ec);
+    if (!ec && parent_fds[1] != -1)
+      std_out_.assign(parent_fds[1], ec);
+    if (!ec && parent_fds[2] != -1)
+      std_err_.assign(parent_fds[2], ec);
+
+    if (ec)
+    {
+      // Registration failed, so release everything that has not yet been
+      // transferred to an object, and do not leave the child running.
+      if (!child->pidfd_.is_open())
+        ::close(pidfd);
+      if (parent_fds[0] != -1 && !std_in_.is_open())
+        ::close(parent_fds[0]);
+      if (parent_fds[1] != -1 && !std_out_.is_open())
+        ::close(parent_fds[1]);
+      if (parent_fds[2] != -1 && !std_err_.is_open())
+        ::close(parent_fds[2]);
+      std_in_.close(ignored_ec);
+      std_out_.close(ignored_ec);
+      std_err_.close(ignored_ec);
+      ::kill(pid, SIGKILL);
+      detail::process_ops::reap(pid, true, child->exit_code_, ignored_ec);
+      child->pidfd_.close(ignored_ec);
+      child_.reset();
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+    child_ = std::move(child);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Get the process id of the most recently spawned child, or -1 if no child
+  /// has been spawned.
+  int id() const noexcept
+  {
+    return child_ ? child_->pid_ : -1;
+  }
+
+  /// Get the pipe connected to the child's standard input.
+  /**
+   * The pipe is open only if the child was spawned with the
+   * process_base::pipe_stdin flag. Closing the pipe signals end of file to
+   * the child.
+   */
+  writable_pipe_type& std_in() noexcept
+  {
+    return std_in_;
+  }
+
+  /// Get the pipe connected to the child's standard output.
+  /**
+   * The pipe is open only if the child was spawned with the
+   * process_base::pipe_stdout flag.
+   */
+  readable_pipe_type& std_out() noexcept
+  {
+    return std_out_;
+  }
+
+  /// Get the pipe connected to the child's standard error.
+  /**
+   * The pipe is open only if the child was spawned with the
+   * process_base::pipe_stderr flag.
+   */
+  readable_pipe_type& std_err() noexcept
+  {
+    return std_err_;
+  }
+
+  /// Determine whether the child process is still running.
+  /**
+   * @throws asio::system_error Thrown on failure.
+   */
+  bool running()
+  {
+    asio::error_code ec;
+    bool result = running(ec);
+    asio::detail::throw_error(ec, "running");
+    return result;
+  }
+
+  /// Determine whether the child process is still running.
+  /**
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  bool running(asio::error_code& ec)
+  {
+    ec = asio::error_code();
+    if (!child_ || child_->exit_code_ != -1)
+      return false;
+    return !reap(*child_, false, ec) && !ec;
+  }
+
+  /// Get the exit code of the child process.
+  /**
+   * @returns The exit status if the child exited normally, 128 plus the signal
+   * number if the child was terminated by a signal, or -1 if the child has not
+   * yet been waited for.
+   */
+  int exit_code() const noexcept
+  {
+    return child_ ? child_->exit_code_ : -1;
+  }
+
+  /// Ask the child process to exit, by sending it @c SIGTERM.
+  /**
+   * @throws asio::system_error Thrown on failure.
+   */
+  void request_exit()
+  {
+    asio::error_code ec;
+    request_exit(ec);
+    asio::detail::throw_error(ec, "request_exit");
+  }
+
+  /// Ask the child process to exit, by sending it @c SIGTERM.
+  /**
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID request_exit(asio::error_code& ec)
+  {
+    send_signal(SIGTERM, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Terminate the child process immediately, by sending it @c SIGKILL.
+  /**
+   * The child must still be waited for to obtain its exit code.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void terminate()
+  {
+    asio::error_code ec;
+    terminate(ec);
+    asio::detail::throw_error(ec, "terminate");
+  }
+
+  /// Terminate the child process immediately, by sending it @c SIGKILL.
+  /**
+   * The child must still be waited for to obtain its exit code.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID terminate(asio::error_code& ec)
+  {
+    send_signal(SIGKILL, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Cancel an outstanding asynchronous wait.
+  /**
+   * The handler of an outstanding async_wait operation is invoked with the
+   * asio::error::operation_aborted error. The child process is unaffected.
+   */
+  void cancel()
+  {
+    if (child_)
+      child_->pidfd_.cancel();
+  }
+
+  /// Wait for the child process to exit.
+  /**
+   * Blocks until the child has exited.
+   *
+   * @returns The exit code of the child. See exit_code().
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  int wait()
+  {
+    asio::error_code ec;
+    int result = wait(ec);
+    asio::detail::throw_error(ec, "wait");
+    return result;
+  }
+
+  /// Wait for the child process to exit.
+  /**
+   * Blocks until the child has exited.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The exit code of the child, or -1 if an error occurred. See
+   * exit_code().
+   */
+  int wait(asio::error_code& ec)
+  {
+    ec = asio::error_code();
+    if (!child_)
+      ec = asio::error::bad_descriptor;
+    else if (child_->exit_code_ == -1)
+      reap(*child_, true, ec);
+    return ec ? -1 : child_->exit_code_;
+  }
+
+  /// Start an asynchronous wait for the child process to exit.
+  /**
+   * This function is used to asynchronously wait for the child to exit, and
+   * to reap it. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the child has exited.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   int exit_code // The exit code of the child. See exit_code().
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, int) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @note The operation remains valid if the basic_process object is moved
+   * while the wait is outstanding. If the object is destroyed, the child is
+   * terminated and the handler is invoked with the
+   * asio::error::operation_aborted error.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code, int))
+        WaitToken = default_completion_token_t<executor_type>>
+  auto async_wait(
+      WaitToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_compose<WaitToken, void (asio::error_code, int)>(
+        declval<wait_op>(), token, declval<const executor_type&>()))
+  {
+    return async_compose<WaitToken, void (asio::error_code, int)>(
+        wait_op(child_), token, get_executor());
+  }
+
+private:
+  // Disallow copying and assignment.
+  basic_process(const basic_process&) = delete;
+  basic_process& operator=(const basic_process&) = delete;
+
+  // The state of a spawned child. It is shared with any outstanding wait, so
+  // that the wait remains valid when the basic_process object is moved.
+  struct child_state
+  {
+    explicit child_state(const executor_type& ex)
+      : pidfd_(ex),
+        pid_(-1),
+        exit_code_(-1)
+    {
+    }
+
+    posix::basic_stream_descriptor<Executor> pidfd_;
+    int pid_;
+    int exit_code_;
+  };
+
+  // Reap the child, if it has exited, and release the pidfd descriptor.
+  static bool reap(child_state& child, bool block, asio::error_code& ec)
+  {
+    if (!detail::process_ops::reap(child.pid_, block, child.exit_code_, ec))
+      return false;
+    asio::error_code ignored_ec;
+    child.pidfd_.close(ignored_ec);
+    return true;
+  }
+
+  // Terminate a running child and reap it, ignoring any errors. Closing the
+  // pidfd descriptor cancels any outstanding wait.
+  void terminate_and_reap()
+  {
+    if (child_ && child_->exit_code_ == -1)
+    {
+      asio::error_code ignored_ec;
+      if (!reap(*child_, false, ignored_ec) && !ignored_ec)
+      {
+        detail::process_ops::send_signal(
+            child_->pidfd_.native_handle(), SIGKILL, ignored_ec);
+        reap(*child_, true, ignored_ec);
+      }
+      child_->pidfd_.close(ignored_ec);
+    }
+  }
+
+  // Send a signal to a running child.
+  void send_signal(int signal_number, asio::error_code& ec)
+  {
+    if (!child_ || child_->exit_code_ != -1)
+      ec = asio::error::bad_descriptor;
+    else
+      detail::process_ops::send_signal(
+          child_->pidfd_.native_handle(), signal_number, ec);
+  }
+
+  // The composed operation used to implement async_wait.
+  class wait_op
+  {
+  public:
+    explicit wait_op(const std::shared_ptr<child_state>& child)
+      : child_(child),
+        starting_(true)
+    {
+    }
+
+    template <typename Self>
+    void operator()(Self& self,
+        asio::error_code ec = asio::error_code())
+    {
+      if (starting_)
+      {
+        starting_ = false;
+        if (child_ && child_->exit_code_ == -1)
+        {
+          child_->pidfd_.async_wait(
+              posix::descriptor_base::wait_read, std::move(self));
+        }
+        else
+          asio::post(std::move(self));
+        return;
+      }
+
+      if (!ec)
+      {
+        if (!child_)
+          ec = asio::error::bad_descriptor;
+        else if (child_->exit_code_ == -1
+            && !reap(*child_, false, ec) && !ec)
+        {
+          // The descriptor was readable but the child was not yet reapable.
+          child_->pidfd_.async_wait(
+              posix::descriptor_base::wait_read, std::move(self));
+          return;
+        }
+      }
+
+      self.complete(ec, ec ? -1 : child_->exit_code_);
+    }
+
+  private:
+    std::shared_ptr<child_state> child_;
+    bool starting_;
+  };
+
+  writable_pipe_type std_in_;
+  readable_pipe_type std_out_;
+  readable_pipe_type std_err_;
+  std::shared_ptr<child_state> child_;
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_PROCESS)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_BASIC_PROCESS_HPP
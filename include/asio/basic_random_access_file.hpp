@@ -27,6 +27,7 @@
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
+#include "asio/file_request.hpp"
 
 #include "asio/detail/push_options.hpp"
 
@@ -66,6 +67,7 @@ class basic_random_access_file
 private:
   class initiate_async_write_some_at;
   class initiate_async_read_some_at;
+  class initiate_async_batch_at;
 
 public:
   /// The type of the executor associated with the object.
@@ -609,6 +611,236 @@ public:
         initiate_async_read_some_at(this), token, offset, buffers);
   }
 
+  /// Write a batch of data at the specified offsets.
+  /**
+   * This function is used to perform a number of independent writes to the
+   * random-access handle. Each request performs a single write_some_at
+   * operation, and on return holds the result of that operation. The function
+   * call will block until all of the requests have completed.
+   *
+   * @param requests A pointer to the first of the requests to be performed.
+   *
+   * @param count The number of requests.
+   *
+   * @returns The total number of bytes written.
+   *
+   * @throws asio::system_error Thrown if any of the requests failed. The
+   * exception contains the error of the first request that failed.
+   *
+   * @par Example
+   * @code
+   * asio::file_write_request requests[] =
+   * {
+   *   asio::file_write_request(0, asio::buffer(header)),
+   *   asio::file_write_request(4096, asio::buffer(data))
+   * };
+   * handle.write_batch_at(requests, 2);
+   * @endcode
+   */
+  std::size_t write_batch_at(file_write_request* requests, std::size_t count)
+  {
+    asio::error_code ec;
+    std::size_t s = this->impl_.get_service().batch_at(
+        this->impl_.get_implementation(), requests, count, ec);
+    asio::detail::throw_error(ec, "write_batch_at");
+    return s;
+  }
+
+  /// Write a batch of data at the specified offsets.
+  /**
+   * This function is used to perform a number of independent writes to the
+   * random-access handle. Each request performs a single write_some_at
+   * operation, and on return holds the result of that operation. The function
+   * call will block until all of the requests have completed.
+   *
+   * @param requests A pointer to the first of the requests to be performed.
+   *
+   * @param count The number of requests.
+   *
+   * @param ec Set to the error of the first request that failed, if any.
+   *
+   * @returns The total number of bytes written.
+   */
+  std::size_t write_batch_at(file_write_request* requests,
+      std::size_t count, asio::error_code& ec)
+  {
+    return this->impl_.get_service().batch_at(
+        this->impl_.get_implementation(), requests, count, ec);
+  }
+
+  /// Start an asynchronous batch of writes at the specified offsets.
+  /**
+   * This function is used to asynchronously perform a number of independent
+   * writes to the random-access handle. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * Each request performs a single write_some_at operation. The requests may
+   * be performed concurrently and in any order. When the completion handler
+   * is called, each request holds the result of its own operation.
+   *
+   * @param requests A pointer to the first of the requests to be performed.
+   * Ownership of the requests, and of the memory blocks referred to by their
+   * buffers, is retained by the caller, which must guarantee that they remain
+   * valid until the completion handler is called.
+   *
+   * @param count The number of requests.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when all of the requests have
+   * completed. Potential completion tokens include @ref use_future,
+   * @ref use_awaitable, @ref yield_context, or a function object with the
+   * correct completion signature. The function signature of the completion
+   * handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Error of the first failed request.
+   *   std::size_t bytes_transferred // Total number of bytes written.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note When using io_uring, the requests are submitted to the kernel
+   * together and complete as a single operation. A batch should not contain
+   * more requests than the io_uring submission queue can hold; any excess
+   * requests fail with asio::error::no_buffer_space. If the batch is
+   * cancelled, requests that have not yet completed fail with
+   * asio::error::operation_aborted.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken = default_completion_token_t<executor_type>>
+  auto async_write_batch_at(file_write_request* requests, std::size_t count,
+      WriteToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_batch_at>(), token, requests, count))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_batch_at(this), token, requests, count);
+  }
+
+  /// Read a batch of data from the specified offsets.
+  /**
+   * This function is used to perform a number of independent reads from the
+   * random-access handle. Each request performs a single read_some_at
+   * operation, and on return holds the result of that operation. The function
+   * call will block until all of the requests have completed.
+   *
+   * @param requests A pointer to the first of the requests to be performed.
+   *
+   * @param count The number of requests.
+   *
+   * @returns The total number of bytes read.
+   *
+   * @throws asio::system_error Thrown if any of the requests failed. The
+   * exception contains the error of the first request that failed. An error
+   * code of asio::error::eof indicates that a request started at or beyond
+   * the end of the file.
+   *
+   * @par Example
+   * @code
+   * asio::file_read_request requests[] =
+   * {
+   *   asio::file_read_request(0, asio::buffer(page1)),
+   *   asio::file_read_request(8192, asio::buffer(page2))
+   * };
+   * handle.read_batch_at(requests, 2);
+   * @endcode
+   */
+  std::size_t read_batch_at(file_read_request* requests, std::size_t count)
+  {
+    asio::error_code ec;
+    std::size_t s = this->impl_.get_service().batch_at(
+        this->impl_.get_implementation(), requests, count, ec);
+    asio::detail::throw_error(ec, "read_batch_at");
+    return s;
+  }
+
+  /// Read a batch of data from the specified offsets.
+  /**
+   * This function is used to perform a number of independent reads from the
+   * random-access handle. Each request performs a single read_some_at
+   * operation, and on return holds the result of that operation. The function
+   * call will block until all of the requests have completed.
+   *
+   * @param requests A pointer to the first of the requests to be performed.
+   *
+   * @param count The number of requests.
+   *
+   * @param ec Set to the error of the first request that failed, if any.
+   *
+   * @returns The total number of bytes read.
+   */
+  std::size_t read_batch_at(file_read_request* requests,
+      std::size_t count, asio::error_code& ec)
+  {
+    return this->impl_.get_service().batch_at(
+        this->impl_.get_implementation(), requests, count, ec);
+  }
+
+  /// Start an asynchronous batch of reads from the specified offsets.
+  /**
+   * This function is used to asynchronously perform a number of independent
+   * reads from the random-access handle. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * Each request performs a single read_some_at operation. The requests may
+   * be performed concurrently and in any order. When the completion handler
+   * is called, each request holds the result of its own operation.
+   *
+   * @param requests A pointer to the first of the requests to be performed.
+   * Ownership of the requests, and of the memory blocks referred to by their
+   * buffers, is retained by the caller, which must guarantee that they remain
+   * valid until the completion handler is called.
+   *
+   * @param count The number of requests.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when all of the requests have
+   * completed. Potential completion tokens include @ref use_future,
+   * @ref use_awaitable, @ref yield_context, or a function object with the
+   * correct completion signature. The function signature of the completion
+   * handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Error of the first failed request.
+   *   std::size_t bytes_transferred // Total number of bytes read.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::async_immediate().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note When using io_uring, the requests are submitted to the kernel
+   * together and complete as a single operation. A batch should not contain
+   * more requests than the io_uring submission queue can hold; any excess
+   * requests fail with asio::error::no_buffer_space. If the batch is
+   * cancelled, requests that have not yet completed fail with
+   * asio::error::operation_aborted.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken = default_completion_token_t<executor_type>>
+  auto async_read_batch_at(file_read_request* requests, std::size_t count,
+      ReadToken&& token = default_completion_token_t<executor_type>())
+    -> decltype(
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_batch_at>(), token, requests, count))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_batch_at(this), token, requests, count);
+  }
+
 private:
   // Disallow copying and assignment.
   basic_random_access_file(const basic_random_access_file&) = delete;
@@ -680,6 +912,40 @@ private:
   private:
     basic_random_access_file* self_;
   };
+
+  class initiate_async_batch_at
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_batch_at(basic_random_access_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const noexcept
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler, typename Buffer>
+    void operator()(Handler&& handler,
+        basic_file_request<Buffer>* requests, std::size_t count) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler or
+      // WriteHandler.
+      ASIO_READ_HANDLER_CHECK(Handler, handler) type_check;
+
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_batch_at(
+          self_->impl_.get_implementation(), requests, count,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_random_access_file* self_;
+  };
 };
 
 ASIO_INLINE_NAMESPACE_END
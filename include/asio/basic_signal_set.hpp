@@ -103,6 +103,16 @@ class basic_signal_set;
  * that any signals registered using signal_set objects are unblocked in at
  * least one thread.
  *
+ * When @c ASIO_HAS_SIGNALFD is defined on Linux, signals that are blocked in
+ * every thread are received through a @c signalfd descriptor, without a write
+ * to a pipe for each signal. Adding a signal blocks it in the calling thread,
+ * so a program typically adds its signals before creating any other threads.
+ * Removing the last registration for a signal unblocks it again, unless the
+ * signal was already blocked when it was first added, in which case the
+ * application's signal mask is left unchanged. A signal that is delivered to
+ * a thread where it is not blocked is still reported, through the signal
+ * handler and the pipe.
+ *
  * @sa @ref overview_signals "Signal handling"
  */
 template <typename Executor>
@@ -370,6 +370,68 @@ public:
   {
   }
 
+  /// Set the read-ahead used by asynchronous read operations.
+  /**
+   * This function configures the file for sequential reading. When the depth
+   * is non-zero, the first call to async_read_some() starts @c depth reads of
+   * @c chunk_size bytes each, ahead of the current position, and subsequent
+   * calls are satisfied from those reads in file order. Each chunk is
+   * re-used for the next read-ahead as soon as its data has been consumed.
+   * The chunk storage is aligned to a 4096 byte boundary.
+   *
+   * While read-ahead is in use, each call to async_read_some() fills only the
+   * first non-empty buffer of the buffer sequence. Any other operation that
+   * depends on the current position, such as seek(), read_some() or
+   * write_some(), first discards the read-ahead data and moves the file
+   * position to the next byte that async_read_some() would have delivered.
+   *
+   * Read-ahead requires io_uring. On other platforms the values are
+   * validated but otherwise have no effect.
+   *
+   * @param depth The number of reads to keep in flight. A value of zero
+   * disables read-ahead.
+   *
+   * @param chunk_size The number of bytes requested by each read.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @par Example
+   * @code
+   * asio::stream_file file(my_context, "/path/to/my/file",
+   *     asio::stream_file::read_only);
+   * file.set_read_ahead(4, 1024 * 1024);
+   * @endcode
+   */
+  void set_read_ahead(std::size_t depth, std::size_t chunk_size)
+  {
+    asio::error_code ec;
+    this->impl_.get_service().set_read_ahead(
+        this->impl_.get_implementation(), depth, chunk_size, ec);
+    asio::detail::throw_error(ec, "set_read_ahead");
+  }
+
+  /// Set the read-ahead used by asynchronous read operations.
+  /**
+   * This function configures the file for sequential reading. When the depth
+   * is non-zero, the first call to async_read_some() starts @c depth reads of
+   * @c chunk_size bytes each, ahead of the current position, and subsequent
+   * calls are satisfied from those reads in file order.
+   *
+   * @param depth The number of reads to keep in flight. A value of zero
+   * disables read-ahead.
+   *
+   * @param chunk_size The number of bytes requested by each read.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID set_read_ahead(std::size_t depth,
+      std::size_t chunk_size, asio::error_code& ec)
+  {
+    this->impl_.get_service().set_read_ahead(
+        this->impl_.get_implementation(), depth, chunk_size, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
   /// Seek to a position in the file.
   /**
    * This function updates the current position in the file.
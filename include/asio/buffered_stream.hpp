@@ -17,6 +17,7 @@
 
 #include "asio/detail/config.hpp"
 #include <cstddef>
+#include "asio/adaptive_buffer_size.hpp"
 #include "asio/async_result.hpp"
 #include "asio/buffered_read_stream.hpp"
 #include "asio/buffered_write_stream.hpp"
@@ -72,6 +73,15 @@ public:
   {
   }
 
+  /// Construct, passing the specified argument to initialise the next layer,
+  /// with read and write storage that is sized adaptively.
+  template <typename Arg>
+  buffered_stream(Arg&& a, const adaptive_buffer_size& policy)
+    : inner_stream_impl_(static_cast<Arg&&>(a), policy),
+      stream_impl_(inner_stream_impl_, policy)
+  {
+  }
+
   /// Get a reference to the next layer.
   next_layer_type& next_layer()
   {
@@ -17,6 +17,7 @@
 
 #include "asio/detail/config.hpp"
 #include <cstddef>
+#include "asio/adaptive_buffer_size.hpp"
 #include "asio/buffered_write_stream_fwd.hpp"
 #include "asio/buffer.hpp"
 #include "asio/completion_condition.hpp"
@@ -88,6 +89,16 @@ public:
   {
   }
 
+  /// Construct, passing the specified argument to initialise the next layer,
+  /// with storage that is sized adaptively.
+  template <typename Arg>
+  buffered_write_stream(Arg&& a,
+      const adaptive_buffer_size& policy)
+    : next_layer_(static_cast<Arg&&>(a)),
+      storage_(next_layer_.lowest_layer().get_executor(), policy)
+  {
+  }
+
   /// Get a reference to the next layer.
   next_layer_type& next_layer()
   {
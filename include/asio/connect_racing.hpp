@@ -0,0 +1,143 @@
+//
+// connect_racing.hpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_CONNECT_RACING_HPP
+#define ASIO_CONNECT_RACING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <chrono>
+#include "asio/async_result.hpp"
+#include "asio/basic_socket.hpp"
+#include "asio/connect.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+namespace detail
+{
+  template <typename, typename> class initiate_async_connect_racing;
+} // namespace detail
+
+/// Asynchronously establishes a socket connection by racing staggered
+/// connection attempts to the endpoints in a sequence.
+/**
+ * This function implements the connection racing algorithm described in
+ * RFC 8305, "Happy Eyeballs Version 2". It is an initiating function for an
+ * @ref asynchronous_operation, and always returns immediately.
+ *
+ * The endpoints are reordered so that address families alternate, starting
+ * with the family of the first endpoint. A connection attempt is started to
+ * the first endpoint, and each time @c attempt_delay elapses without a
+ * connection being established, or an attempt fails, an attempt is started to
+ * the next endpoint. Earlier attempts are not abandoned when a new attempt is
+ * started. When the first attempt succeeds, all other attempts are cancelled
+ * and the winning connection is moved into @c s.
+ *
+ * @param s The socket to be connected. If the socket is already open, it will
+ * be closed. The socket must not be used until the operation completes.
+ *
+ * @param endpoints A sequence of endpoints.
+ *
+ * @param attempt_delay The time to wait for an attempt to complete before
+ * starting the next one. RFC 8305 recommends a value of 250 milliseconds.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the connect completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation. if the sequence is empty, set to
+ *   // asio::error::not_found. Otherwise, contains the
+ *   // error from the last connection attempt to fail.
+ *   const asio::error_code& error,
+ *
+ *   // On success, the successfully connected endpoint.
+ *   // Otherwise, a default-constructed endpoint.
+ *   const typename Protocol::endpoint& endpoint
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::async_immediate().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, typename Protocol::endpoint) @endcode
+ *
+ * @par Example
+ * @code tcp::resolver r(my_context);
+ * tcp::socket s(my_context);
+ *
+ * // ...
+ *
+ * void resolve_handler(
+ *     const asio::error_code& ec,
+ *     tcp::resolver::results_type results)
+ * {
+ *   if (!ec)
+ *   {
+ *     asio::async_connect_racing(s, results,
+ *         std::chrono::milliseconds(250), connect_handler);
+ *   }
+ * } @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * @li @c cancellation_type::partial
+ *
+ * @li @c cancellation_type::total
+ *
+ * Cancellation closes all outstanding attempts, and the operation completes
+ * with asio::error::operation_aborted unless an attempt has already
+ * succeeded.
+ */
+template <typename Protocol, typename Executor, typename EndpointSequence,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      typename Protocol::endpoint)) RangeConnectToken
+        = default_completion_token_t<Executor>>
+inline auto async_connect_racing(basic_socket<Protocol, Executor>& s,
+    const EndpointSequence& endpoints,
+    const std::chrono::steady_clock::duration& attempt_delay,
+    RangeConnectToken&& token = default_completion_token_t<Executor>(),
+    constraint_t<
+      is_endpoint_sequence<EndpointSequence>::value
+    > = 0)
+  -> decltype(
+    async_initiate<RangeConnectToken,
+      void (asio::error_code, typename Protocol::endpoint)>(
+        declval<detail::initiate_async_connect_racing<Protocol, Executor>>(),
+        token, endpoints, attempt_delay))
+{
+  return async_initiate<RangeConnectToken,
+    void (asio::error_code, typename Protocol::endpoint)>(
+      detail::initiate_async_connect_racing<Protocol, Executor>(s),
+      token, endpoints, attempt_delay);
+}
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/connect_racing.hpp"
+
+#endif // ASIO_CONNECT_RACING_HPP
@@ -16,10 +16,21 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/config.hpp"
+#include "asio/adaptive_buffer_size.hpp"
+#include "asio/aligned_buffer_pool.hpp"
 #include "asio/buffer.hpp"
+#include "asio/execution/context.hpp"
+#include "asio/execution/executor.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/query.hpp"
+#include "asio/registered_buffer.hpp"
 #include "asio/detail/assert.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/segment_pool.hpp"
+#include "asio/detail/type_traits.hpp"
 #include <cstddef>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 #include "asio/detail/push_options.hpp"
@@ -29,6 +40,7 @@ ASIO_INLINE_NAMESPACE_BEGIN
 namespace detail {
 
 class buffered_stream_storage
+  : private noncopyable
 {
 public:
   // The type of the bytes stored in the buffer.
@@ -41,27 +53,68 @@ public:
   explicit buffered_stream_storage(std::size_t buffer_capacity)
     : begin_offset_(0),
       end_offset_(0),
-      buffer_(buffer_capacity)
+      buffer_(buffer_capacity),
+      data_(buffer_.empty() ? 0 : &buffer_[0]),
+      capacity_(buffer_capacity),
+      service_(0),
+      min_capacity_(buffer_capacity),
+      max_capacity_(buffer_capacity),
+      target_capacity_(buffer_capacity),
+      small_transfers_(0),
+      registered_pool_(0)
   {
   }
 
+  // Construct storage that is sized adaptively. No memory is allocated until
+  // the storage is first used.
+  template <typename Executor>
+  buffered_stream_storage(const Executor& ex,
+      const adaptive_buffer_size& policy)
+    : begin_offset_(0),
+      end_offset_(0),
+      data_(0),
+      capacity_(0),
+      service_(&asio::use_service<segment_pool_service>(
+            buffered_stream_storage::get_context(ex))),
+      min_capacity_(0),
+      max_capacity_(0),
+      target_capacity_(0),
+      small_transfers_(0),
+      registered_pool_(policy.registered_pool())
+  {
+    max_capacity_ = registered_pool_
+      ? registered_pool_->buffer_size() : round_up(policy.max_size());
+    min_capacity_ = round_up(policy.min_size());
+    if (min_capacity_ > max_capacity_)
+      min_capacity_ = max_capacity_;
+    target_capacity_ = min_capacity_;
+  }
+
+  // Destructor.
+  ~buffered_stream_storage()
+  {
+    release();
+  }
+
   /// Clear the buffer.
   void clear()
   {
     begin_offset_ = 0;
     end_offset_ = 0;
+    if (service_)
+      release();
   }
 
   // Return a pointer to the beginning of the unread data.
   mutable_buffer data()
   {
-    return asio::buffer(buffer_) + begin_offset_;
+    return asio::buffer(data_, capacity_) + begin_offset_;
   }
 
   // Return a pointer to the beginning of the unread data.
   const_buffer data() const
   {
-    return asio::buffer(buffer_) + begin_offset_;
+    return asio::buffer(data_, capacity_) + begin_offset_;
   }
 
   // Is there no unread data in the buffer.
@@ -79,6 +132,9 @@ public:
   // Resize the buffer to the specified length.
   void resize(size_type length)
   {
+    if (service_ && !data_ && length > 0)
+      allocate();
+
     ASIO_ASSERT(length <= capacity());
     if (begin_offset_ + length <= capacity())
     {
@@ -87,16 +143,19 @@ public:
     else
     {
       using namespace std; // For memmove.
-      memmove(&buffer_[0], &buffer_[0] + begin_offset_, size());
+      memmove(data_, data_ + begin_offset_, size());
       end_offset_ = length;
       begin_offset_ = 0;
     }
+
+    if (empty())
+      clear();
   }
 
   // Return the maximum size for data in the buffer.
   size_type capacity() const
   {
-    return buffer_.size();
+    return data_ || !service_ ? capacity_ : target_capacity_;
   }
 
   // Consume multiple bytes from the beginning of the buffer.
@@ -108,15 +167,147 @@ public:
       clear();
   }
 
+  // Record the result of a transfer into or out of the buffer, where
+  // available is the space that was offered to the transfer. Adaptive storage
+  // grows when a transfer uses all of the available space, and shrinks after
+  // several consecutive transfers use less than a quarter of it. The new size
+  // takes effect when the storage is next acquired.
+  void record_transfer(size_type available, size_type transferred)
+  {
+    if (!service_)
+      return;
+
+    if (transferred > 0 && transferred >= available
+        && target_capacity_ < max_capacity_)
+    {
+      target_capacity_ = target_capacity_ * 2 < max_capacity_
+        ? target_capacity_ * 2 : max_capacity_;
+      small_transfers_ = 0;
+    }
+    else if (transferred < target_capacity_ / 4)
+    {
+      if (++small_transfers_ >= shrink_threshold
+          && target_capacity_ > min_capacity_)
+      {
+        target_capacity_ = target_capacity_ / 2 > min_capacity_
+          ? target_capacity_ / 2 : min_capacity_;
+        small_transfers_ = 0;
+      }
+    }
+    else
+    {
+      small_transfers_ = 0;
+    }
+  }
+
+  // Whether the storage is a registered buffer.
+  bool is_registered() const
+  {
+    return registered_.size() != 0;
+  }
+
+  // Return part of the registered buffer, relative to the unread data.
+  mutable_registered_buffer registered_data(size_type offset, size_type length)
+  {
+    return asio::buffer(registered_ + (begin_offset_ + offset), length);
+  }
+
 private:
+  // The number of consecutive small transfers that cause storage to shrink.
+  enum { shrink_threshold = 4 };
+
+  // Helper function to get an executor's context.
+  template <typename T>
+  static execution_context& get_context(const T& t,
+      enable_if_t<execution::is_executor<T>::value>* = 0)
+  {
+    return asio::query(t, execution::context);
+  }
+
+  // Helper function to get an executor's context.
+  template <typename T>
+  static execution_context& get_context(const T& t,
+      enable_if_t<!execution::is_executor<T>::value>* = 0)
+  {
+    return t.context();
+  }
+
+  // Round a size up to a power of two.
+  static size_type round_up(size_type size)
+  {
+    size_type result = 64;
+    while (result < size)
+      result <<= 1;
+    return result;
+  }
+
+  // Acquire adaptive storage of the target size.
+  void allocate()
+  {
+    if (registered_pool_)
+    {
+      registered_ = registered_pool_->acquire();
+      if (registered_.size() != 0)
+      {
+        data_ = static_cast<byte_type*>(registered_.data());
+        capacity_ = target_capacity_;
+        return;
+      }
+    }
+
+    pool_ = service_->pool(target_capacity_);
+    data_ = reinterpret_cast<byte_type*>(pool_->allocate());
+    capacity_ = target_capacity_;
+  }
+
+  // Return adaptive storage to its pool.
+  void release()
+  {
+    if (registered_.size() != 0)
+    {
+      registered_pool_->release(registered_);
+      registered_ = mutable_registered_buffer();
+    }
+    else if (pool_)
+    {
+      pool_->deallocate(reinterpret_cast<char*>(data_));
+      pool_.reset();
+    }
+    else
+    {
+      return;
+    }
+
+    data_ = 0;
+    capacity_ = 0;
+  }
+
   // The offset to the beginning of the unread data.
   size_type begin_offset_;
 
   // The offset to the end of the unread data.
   size_type end_offset_;
 
-  // The data in the buffer.
+  // The data in the buffer, when the storage has a fixed size.
   std::vector<byte_type> buffer_;
+
+  // The storage in use.
+  byte_type* data_;
+  size_type capacity_;
+
+  // The service that owns the shared pools, for adaptive storage.
+  segment_pool_service* service_;
+
+  // The sizing state for adaptive storage.
+  size_type min_capacity_;
+  size_type max_capacity_;
+  size_type target_capacity_;
+  size_type small_transfers_;
+
+  // The pools from which adaptive storage is currently held.
+  std::shared_ptr<segment_pool> pool_;
+  aligned_buffer_pool* registered_pool_;
+  mutable_registered_buffer registered_;
 };
 
 } // namespace detail
@@ -903,7 +903,7 @@
 # include <unistd.h>
 #endif // defined(ASIO_HAS_UNISTD_H)
 
-// Linux: epoll, eventfd, timerfd and io_uring.
+// Linux: epoll, eventfd, timerfd, signalfd and io_uring.
 #if defined(__linux__)
 # include <linux/version.h>
 # if !defined(ASIO_HAS_EPOLL)
@@ -929,6 +929,11 @@
 #   endif // defined(ASIO_HAS_EPOLL)
 #  endif // !defined(ASIO_DISABLE_TIMERFD)
 # endif // !defined(ASIO_HAS_TIMERFD)
+# if defined(ASIO_HAS_SIGNALFD)
+#  if LINUX_VERSION_CODE < KERNEL_VERSION(2,6,27)
+#   error Linux kernel 2.6.27 or later is required to support signalfd
+#  endif // LINUX_VERSION_CODE < KERNEL_VERSION(2,6,27)
+# endif // defined(ASIO_HAS_SIGNALFD)
 # if defined(ASIO_HAS_IO_URING)
 #  if LINUX_VERSION_CODE < KERNEL_VERSION(5,10,0)
 #   error Linux kernel 5.10 or later is required to support io_uring
@@ -1119,6 +1124,32 @@
         //   && !defined(ASIO_CYGWIN_W32_SOCKETS)
 #endif // !defined(ASIO_HAS_PIPE)
 
+// Memory-mapped files.
+#if !defined(ASIO_HAS_MAPPED_FILE)
+# if !defined(ASIO_DISABLE_MAPPED_FILE)
+#  if !defined(ASIO_WINDOWS_RUNTIME) \
+  && !defined(__SYMBIAN32__)
+#   define ASIO_HAS_MAPPED_FILE 1
+#  endif // !defined(ASIO_WINDOWS_RUNTIME)
+         //   && !defined(__SYMBIAN32__)
+# endif // !defined(ASIO_DISABLE_MAPPED_FILE)
+#endif // !defined(ASIO_HAS_MAPPED_FILE)
+
+// Linux: child processes, with exit notification using pidfd.
+#if !defined(ASIO_HAS_PROCESS)
+# if !defined(ASIO_DISABLE_PROCESS)
+#  if defined(__linux__) \
+  && defined(ASIO_HAS_PIPE) \
+  && defined(ASIO_HAS_POSIX_STREAM_DESCRIPTOR)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(5,3,0)
+#    define ASIO_HAS_PROCESS 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(5,3,0)
+#  endif // defined(__linux__)
+         //   && defined(ASIO_HAS_PIPE)
+         //   && defined(ASIO_HAS_POSIX_STREAM_DESCRIPTOR)
+# endif // !defined(ASIO_DISABLE_PROCESS)
+#endif // !defined(ASIO_HAS_PROCESS)
+
 // Can use sigaction() instead of signal().
 #if !defined(ASIO_HAS_SIGACTION)
 # if !defined(ASIO_DISABLE_SIGACTION)
@@ -1453,6 +1484,17 @@
 # define ASIO_ASSUME(expr) (void)0
 #endif // !defined(ASIO_ASSUME)
 
+// Compiler support for SSE2 intrinsics.
+#if !defined(ASIO_HAS_SSE2)
+# if !defined(ASIO_DISABLE_SSE2)
+#  if defined(__SSE2__) || defined(_M_X64) \
+  || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#   define ASIO_HAS_SSE2 1
+#  endif // defined(__SSE2__) || defined(_M_X64)
+         //   || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+# endif // !defined(ASIO_DISABLE_SSE2)
+#endif // !defined(ASIO_HAS_SSE2)
+
 // Support the co_await keyword on compilers known to allow it.
 #if !defined(ASIO_HAS_CO_AWAIT)
 # if !defined(ASIO_DISABLE_CO_AWAIT)
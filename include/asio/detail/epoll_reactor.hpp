@@ -19,6 +19,9 @@
 
 #if defined(ASIO_HAS_EPOLL)
 
+#include <atomic>
+#include <vector>
+#include <sys/epoll.h>
 #include "asio/detail/atomic_count.hpp"
 #include "asio/detail/conditionally_enabled_mutex.hpp"
 #include "asio/detail/limits.hpp"
@@ -29,6 +32,7 @@
 #include "asio/detail/select_interrupter.hpp"
 #include "asio/detail/slim_mutex.hpp"
 #include "asio/detail/socket_types.hpp"
+#include "asio/detail/speculative_policy.hpp"
 #include "asio/detail/timer_queue_base.hpp"
 #include "asio/detail/timer_queue_set.hpp"
 #include "asio/detail/wait_op.hpp"
@@ -56,18 +60,101 @@ public:
   enum op_types { read_op = 0, write_op = 1,
     connect_op = 1, except_op = 2, max_ops = 3 };
 
+  // An additional epoll instance, which is itself registered with the main
+  // epoll instance using EPOLLONESHOT. When it becomes ready, it is queued as
+  // an operation, and the scheduler thread that runs the operation retrieves
+  // its events. Each shard is therefore polled by at most one thread at a
+  // time, but different shards may be polled concurrently.
+  struct shard : operation
+  {
+    ASIO_DECL shard(epoll_reactor* r, std::size_t max_events,
+        const execution_context::allocator<epoll_event>& a);
+    shard(const shard&) = delete;
+    shard& operator=(const shard&) = delete;
+    epoll_reactor* reactor_;
+    int epoll_fd_;
+    bool rearm_;
+    std::atomic<bool> queued_;
+    std::vector<epoll_event, execution_context::allocator<epoll_event>> events_;
+    ASIO_DECL static void do_complete(
+        void* owner, operation* base,
+        const asio::error_code& ec, std::size_t bytes_transferred);
+  };
+
+  // Fixed-capacity storage for the shards, allocated using the execution
+  // context's allocator. Shards are referred to by address from the main epoll
+  // instance and from descriptor states, so they are never copied or moved.
+  class shard_array
+  {
+  public:
+    explicit shard_array(const execution_context::allocator<shard>& a)
+      : allocator_(a),
+        data_(0),
+        size_(0),
+        capacity_(0)
+    {
+    }
+
+    ~shard_array()
+    {
+      while (size_ > 0)
+        data_[--size_].~shard();
+      if (data_)
+        allocator_.deallocate(data_, capacity_);
+    }
+
+    // Allocate space for the given number of shards. Must be called at most
+    // once, before any shards are added.
+    void reserve(std::size_t capacity)
+    {
+      data_ = allocator_.allocate(capacity);
+      capacity_ = capacity;
+    }
+
+    // Construct a new shard at the end of the reserved space.
+    shard& emplace_back(epoll_reactor* r, std::size_t max_events)
+    {
+      new (data_ + size_) shard(r, max_events,
+          execution_context::allocator<epoll_event>(allocator_));
+      return data_[size_++];
+    }
+
+    bool empty() const
+    {
+      return size_ == 0;
+    }
+
+    std::size_t size() const
+    {
+      return size_;
+    }
+
+    shard& operator[](std::size_t i)
+    {
+      return data_[i];
+    }
+
+  private:
+    shard_array(const shard_array&) = delete;
+    shard_array& operator=(const shard_array&) = delete;
+
+    execution_context::allocator<shard> allocator_;
+    shard* data_;
+    std::size_t size_;
+    std::size_t capacity_;
+  };
+
   // Per-descriptor queues.
   struct descriptor_state : operation
   {
-    descriptor_state* next_;
-    descriptor_state* prev_;
-
     mutex mutex_;
     epoll_reactor* reactor_;
     int descriptor_;
+    shard* shard_;
     uint32_t registered_events_;
     op_queue<reactor_op> op_queue_[max_ops];
     bool try_speculative_[max_ops];
+    speculative_policy::history speculative_history_[max_ops];
     bool shutdown_;
 
     ASIO_DECL descriptor_state(bool locking, int spin_count);
@@ -109,6 +196,12 @@ public:
       int op_type, socket_type descriptor,
       per_descriptor_data& descriptor_data, reactor_op* op);
 
+  // Request exclusive wakeups for a descriptor that is listening for
+  // connections, if enabled by the configuration. Does nothing if the
+  // descriptor is not listening.
+  ASIO_DECL void register_listener(socket_type descriptor,
+      per_descriptor_data& descriptor_data);
+
   // Move descriptor registration from one descriptor_data object to another.
   ASIO_DECL void move_descriptor(socket_type descriptor,
       per_descriptor_data& target_descriptor_data,
@@ -215,6 +308,13 @@ private:
   // The hint to pass to epoll_create to size its data structures.
   enum { epoll_size = 20000 };
 
+  // The default number of events to retrieve with each call to epoll_wait.
+  enum { default_max_events = 128 };
+
+  // Get the configured number of events to retrieve with each call to
+  // epoll_wait.
+  ASIO_DECL static std::size_t max_events(asio::execution_context& ctx);
+
   // Create the epoll file descriptor. Throws an exception if the descriptor
   // cannot be created.
   ASIO_DECL static int do_epoll_create();
@@ -222,6 +322,26 @@ private:
   // Create the timerfd file descriptor. Does not throw.
   ASIO_DECL static int do_timerfd_create();
 
+  // Create the configured number of shards and register them with the main
+  // epoll instance.
+  ASIO_DECL void create_shards(asio::execution_context& ctx);
+
+  // Register a shard with the main epoll instance, armed if requested.
+  ASIO_DECL void add_shard(shard& s, bool armed);
+
+  // Choose the epoll instance with which a new descriptor is registered.
+  ASIO_DECL shard* choose_shard();
+
+  // Get the shard to which an event refers, or null if it does not refer to a
+  // shard.
+  ASIO_DECL shard* event_shard(void* ptr);
+
+  // Get the epoll instance with which a descriptor is registered.
+  int epoll_fd(descriptor_state* s) const
+  {
+    return s->shard_ ? s->shard_->epoll_fd_ : epoll_fd_;
+  }
+
   // Allocate a new descriptor state object.
   ASIO_DECL descriptor_state* allocate_descriptor_state();
 
@@ -275,10 +395,25 @@ private:
   // How any times to spin waiting for the I/O mutex.
   const int io_locking_spin_count_;
 
-  // Mutex to protect access to the registered descriptors.
-  mutex registered_descriptors_mutex_;
+  // When to attempt operations before waiting for readiness.
+  const speculative_policy speculative_policy_;
+
+  // Whether listening descriptors are registered with EPOLLEXCLUSIVE.
+  const bool exclusive_accept_;
+
+  // The buffer that receives events from epoll_wait. Only used by the thread
+  // running the reactor task.
+  std::vector<epoll_event, execution_context::allocator<epoll_event>> events_;
+
+  // The additional epoll instances. Descriptors are distributed across these
+  // and the main epoll instance.
+  shard_array shards_;
+
+  // Used to distribute descriptors across the epoll instances.
+  std::atomic<std::size_t> next_shard_;
 
-  // Keep track of all registered descriptors.
+  // Keep track of all registered descriptors. Allocation and deallocation of
+  // descriptor states do not require locking.
   object_pool<descriptor_state, execution_context::allocator<void>>
     registered_descriptors_;
 
@@ -0,0 +1,286 @@
+//
+// detail/file_read_ahead.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_FILE_READ_AHEAD_HPP
+#define ASIO_DETAIL_FILE_READ_AHEAD_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include "asio/buffer.hpp"
+#include "asio/error.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/operation.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// Base class for a stream read operation that is satisfied from read-ahead
+// data. Only the first buffer of the operation's buffer sequence is filled.
+class file_read_ahead_waiter : public operation
+{
+public:
+  asio::mutable_buffer buffer_;
+  asio::error_code ec_;
+  std::size_t bytes_transferred_;
+
+protected:
+  file_read_ahead_waiter(func_type complete_func,
+      const asio::mutable_buffer& buffer)
+    : operation(complete_func),
+      buffer_(buffer),
+      bytes_transferred_(0)
+  {
+  }
+};
+
+// Keeps a ring of reads in flight ahead of the logical position of a stream
+// file, and delivers the data to stream reads in file order. The object is
+// shared between the file implementation and the outstanding chunk reads, so
+// that it remains valid until the last read completes.
+class file_read_ahead
+  : private noncopyable
+{
+public:
+  typedef file_read_ahead_waiter waiter;
+
+  // The alignment of each chunk's storage, suitable for direct I/O.
+  enum { chunk_alignment = 4096 };
+
+  file_read_ahead(std::size_t depth, std::size_t chunk_size, uint64_t position)
+    : chunks_(new chunk[depth]),
+      data_(static_cast<unsigned char*>(
+            aligned_new(chunk_alignment, depth * chunk_size))),
+      depth_(depth),
+      chunk_size_(chunk_size),
+      head_(0),
+      count_(0),
+      next_offset_(position),
+      position_(position),
+      waiter_(0)
+  {
+  }
+
+  ~file_read_ahead()
+  {
+    if (waiter_)
+      waiter_->destroy();
+    aligned_delete(data_);
+    delete[] chunks_;
+  }
+
+  // Get the position of the next byte to be delivered to a stream read.
+  uint64_t position() const
+  {
+    mutex::scoped_lock lock(mutex_);
+    return position_;
+  }
+
+  // The handler used for the read into a single chunk.
+  class chunk_handler
+  {
+  public:
+    chunk_handler(const shared_ptr<file_read_ahead>& owner, std::size_t index)
+      : owner_(owner),
+        index_(index)
+    {
+    }
+
+    void operator()(const asio::error_code& ec, std::size_t n)
+    {
+      owner_->chunk_complete(index_, ec, n);
+    }
+
+  private:
+    shared_ptr<file_read_ahead> owner_;
+    std::size_t index_;
+  };
+
+  // Start reads for all idle chunks. The start function is called as
+  // start(index, offset, buffer, handler) for each chunk, and may start the
+  // reads concurrently.
+  template <typename Start>
+  static void fill(const shared_ptr<file_read_ahead>& self, Start start)
+  {
+    for (;;)
+    {
+      mutex::scoped_lock lock(self->mutex_);
+      if (self->count_ == self->depth_)
+        return;
+      std::size_t index = (self->head_ + self->count_) % self->depth_;
+      ++self->count_;
+      chunk& c = self->chunks_[index];
+      c.state_ = chunk::reading;
+      c.offset_ = self->next_offset_;
+      c.size_ = 0;
+      c.consumed_ = 0;
+      c.ec_ = asio::error_code();
+      self->next_offset_ += self->chunk_size_;
+      lock.unlock();
+
+      start(index, c.offset_, asio::buffer(self->data_
+            + index * self->chunk_size_, self->chunk_size_),
+          chunk_handler(self, index));
+    }
+  }
+
+  // Fill the waiter's buffer from the head of the ring if the data is already
+  // available. Otherwise, keep the waiter until the head chunk completes.
+  bool complete_or_wait(waiter* w)
+  {
+    mutex::scoped_lock lock(mutex_);
+    if (deliver(w))
+      return true;
+    waiter_ = w;
+    return false;
+  }
+
+  // Take ownership of the specified waiter, if it is still waiting.
+  waiter* take_waiter(waiter* w)
+  {
+    mutex::scoped_lock lock(mutex_);
+    if (waiter_ != w)
+      return 0;
+    waiter_ = 0;
+    return w;
+  }
+
+private:
+  struct chunk
+  {
+    enum state_type { idle, reading, ready } state_;
+    uint64_t offset_;
+    std::size_t size_;
+    std::size_t consumed_;
+    asio::error_code ec_;
+
+    chunk()
+      : state_(idle),
+        offset_(0),
+        size_(0),
+        consumed_(0)
+    {
+    }
+  };
+
+  void chunk_complete(std::size_t index,
+      const asio::error_code& ec, std::size_t n)
+  {
+    mutex::scoped_lock lock(mutex_);
+    chunk& c = chunks_[index];
+    c.state_ = chunk::ready;
+    c.size_ = n;
+    c.ec_ = ec;
+
+    waiter* w = waiter_;
+    if (w && deliver(w))
+    {
+      waiter_ = 0;
+      lock.unlock();
+      w->complete(this, w->ec_, w->bytes_transferred_);
+    }
+  }
+
+  // Deliver data or an error from the head of the ring. Must be called with
+  // the lock held.
+  bool deliver(waiter* w)
+  {
+    while (count_ > 0)
+    {
+      chunk& c = chunks_[head_];
+      if (c.state_ != chunk::ready)
+        return false;
+
+      if (c.offset_ + c.consumed_ != position_)
+      {
+        // The chunk was read for a position that has since been abandoned.
+        release_head();
+        continue;
+      }
+
+      if (c.consumed_ < c.size_)
+      {
+        std::size_t n = asio::buffer_copy(w->buffer_,
+            asio::buffer(data_ + head_ * chunk_size_ + c.consumed_,
+              c.size_ - c.consumed_));
+        c.consumed_ += n;
+        position_ += n;
+        w->ec_ = asio::error_code();
+        w->bytes_transferred_ = n;
+        if (c.consumed_ == c.size_ && !c.ec_)
+        {
+          if (c.size_ < chunk_size_)
+          {
+            // A short read means that the chunks behind this one were read
+            // from the wrong offsets.
+            restart();
+          }
+          release_head();
+        }
+        return true;
+      }
+
+      // All data has been delivered, so report the error (typically eof). The
+      // remaining chunks are restarted so that reading may continue from the
+      // current position, e.g. when the file is growing.
+      w->ec_ = c.ec_ ? c.ec_ : asio::error::eof;
+      w->bytes_transferred_ = 0;
+      restart();
+      release_head();
+      return true;
+    }
+    return false;
+  }
+
+  // Continue reading from the current position. The chunks that are already
+  // in flight will be discarded when they reach the head of the ring, as they
+  // no longer match the position. Must be called with the lock held.
+  void restart()
+  {
+    next_offset_ = position_;
+  }
+
+  // Return the head chunk to the idle state. Must be called with the lock
+  // held.
+  void release_head()
+  {
+    chunks_[head_].state_ = chunk::idle;
+    head_ = (head_ + 1) % depth_;
+    --count_;
+  }
+
+  mutable mutex mutex_;
+  chunk* chunks_;
+  unsigned char* data_;
+  std::size_t depth_;
+  std::size_t chunk_size_;
+  std::size_t head_;
+  std::size_t count_;
+  uint64_t next_offset_;
+  uint64_t position_;
+  waiter* waiter_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_FILE_READ_AHEAD_HPP
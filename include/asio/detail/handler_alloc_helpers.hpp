@@ -17,6 +17,7 @@
 
 #include "asio/detail/config.hpp"
 #include "asio/detail/memory.hpp"
+#include "asio/detail/op_slot.hpp"
 #include "asio/detail/recycling_allocator.hpp"
 #include "asio/associated_allocator.hpp"
 
@@ -73,6 +74,85 @@
       ::asio::detail::thread_info_base::default_tag, op ) \
   /**/
 
+// As for ASIO_DEFINE_HANDLER_PTR, but where the operation's memory may instead
+// come from an op_slot owned by the I/O object. The op must have a member
+// slot_ that records the slot, if any, from which its memory was obtained.
+#define ASIO_DEFINE_HANDLER_SLOT_PTR(op) \
+  struct ptr \
+  { \
+    Handler* h; \
+    op* v; \
+    op* p; \
+    ::asio::detail::op_slot* s; \
+    ~ptr() \
+    { \
+      reset(); \
+    } \
+    static op* allocate(Handler& handler) \
+    { \
+      typedef typename ::asio::associated_allocator< \
+        Handler>::type associated_allocator_type; \
+      typedef typename ::asio::detail::get_recycling_allocator< \
+        associated_allocator_type, \
+        ::asio::detail::thread_info_base::default_tag>::type \
+          default_allocator_type; \
+      ASIO_REBIND_ALLOC(default_allocator_type, op) a( \
+            ::asio::detail::get_recycling_allocator< \
+              associated_allocator_type, \
+              ::asio::detail::thread_info_base::default_tag>::get( \
+                ::asio::get_associated_allocator(handler))); \
+      return a.allocate(1); \
+    } \
+    void allocate(Handler& handler, ::asio::detail::op_slot** slot) \
+    { \
+      if (slot) \
+      { \
+        if (void* mem = ::asio::detail::op_slot::allocate( \
+              *slot, sizeof(op), alignof(op))) \
+        { \
+          v = static_cast<op*>(mem); \
+          s = *slot; \
+          return; \
+        } \
+      } \
+      v = allocate(handler); \
+      s = 0; \
+    } \
+    void reset() \
+    { \
+      if (p) \
+      { \
+        p->~op(); \
+        p = 0; \
+      } \
+      if (v) \
+      { \
+        if (s) \
+        { \
+          ::asio::detail::op_slot::deallocate(s); \
+          s = 0; \
+        } \
+        else \
+        { \
+          typedef typename ::asio::associated_allocator< \
+            Handler>::type associated_allocator_type; \
+          typedef typename ::asio::detail::get_recycling_allocator< \
+            associated_allocator_type, \
+            ::asio::detail::thread_info_base::default_tag>::type \
+              default_allocator_type; \
+          ASIO_REBIND_ALLOC(default_allocator_type, op) a( \
+                ::asio::detail::get_recycling_allocator< \
+                  associated_allocator_type, \
+                  ::asio::detail::thread_info_base::default_tag>::get( \
+                    ::asio::get_associated_allocator(*h))); \
+          a.deallocate(static_cast<op*>(v), 1); \
+        } \
+        v = 0; \
+      } \
+    } \
+  } \
+  /**/
+
 #define ASIO_DEFINE_TAGGED_HANDLER_ALLOCATOR_PTR(purpose, op) \
   struct ptr \
   { \
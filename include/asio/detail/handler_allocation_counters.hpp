@@ -0,0 +1,110 @@
+//
+// detail/handler_allocation_counters.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_HANDLER_ALLOCATION_COUNTERS_HPP
+#define ASIO_DETAIL_HANDLER_ALLOCATION_COUNTERS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <atomic>
+#include <cstddef>
+#include "asio/detail/noncopyable.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// Program-wide counters for the memory allocated by thread_info_base, kept
+// separately for each allocation purpose. Only updated when the program is
+// compiled with ASIO_ENABLE_HANDLER_ALLOCATION_STATS.
+class handler_allocation_counters
+  : private noncopyable
+{
+public:
+  enum { num_purposes = 6 };
+
+  struct entry
+  {
+    std::atomic<std::size_t> hits_;
+    std::atomic<std::size_t> misses_;
+    std::atomic<std::size_t> bytes_;
+    std::atomic<std::size_t> outstanding_bytes_;
+    std::atomic<std::size_t> high_water_bytes_;
+    std::atomic<std::size_t> largest_request_;
+  };
+
+  static handler_allocation_counters& instance()
+  {
+    static handler_allocation_counters counters;
+    return counters;
+  }
+
+  // Record an allocation, where hit indicates whether the memory came from
+  // the thread's cache.
+  void allocated(int purpose, std::size_t size, bool hit)
+  {
+    entry& e = entries_[purpose];
+    (hit ? e.hits_ : e.misses_).fetch_add(1, std::memory_order_relaxed);
+    e.bytes_.fetch_add(size, std::memory_order_relaxed);
+    raise(e.high_water_bytes_, e.outstanding_bytes_.fetch_add(
+          size, std::memory_order_relaxed) + size);
+    raise(e.largest_request_, size);
+  }
+
+  void deallocated(int purpose, std::size_t size)
+  {
+    entries_[purpose].outstanding_bytes_.fetch_sub(
+        size, std::memory_order_relaxed);
+  }
+
+  const entry& get(int purpose) const
+  {
+    return entries_[purpose];
+  }
+
+private:
+  handler_allocation_counters()
+  {
+    for (int i = 0; i < num_purposes; ++i)
+    {
+      entries_[i].hits_.store(0, std::memory_order_relaxed);
+      entries_[i].misses_.store(0, std::memory_order_relaxed);
+      entries_[i].bytes_.store(0, std::memory_order_relaxed);
+      entries_[i].outstanding_bytes_.store(0, std::memory_order_relaxed);
+      entries_[i].high_water_bytes_.store(0, std::memory_order_relaxed);
+      entries_[i].largest_request_.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Raise the value to at least the specified amount.
+  static void raise(std::atomic<std::size_t>& value, std::size_t amount)
+  {
+    std::size_t current = value.load(std::memory_order_relaxed);
+    while (current < amount && !value.compare_exchange_weak(
+          current, amount, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  entry entries_[num_purposes];
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_HANDLER_ALLOCATION_COUNTERS_HPP
@@ -16,11 +16,23 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/config.hpp"
-#include <list>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <new>
 #include <utility>
 #include "asio/detail/assert.hpp"
+#include "asio/detail/cstdint.hpp"
 #include "asio/detail/noncopyable.hpp"
 
+#if defined(ASIO_HAS_SSE2)
+# include <emmintrin.h>
+#endif // defined(ASIO_HAS_SSE2)
+
+#if defined(ASIO_MSVC)
+# include <intrin.h>
+#endif // defined(ASIO_MSVC)
+
 #if defined(ASIO_WINDOWS) || defined(ASIO_CYGWIN_W32_SOCKETS)
 # include "asio/detail/socket_types.hpp"
 #endif // defined(ASIO_WINDOWS) || defined(ASIO_CYGWIN_W32_SOCKETS)
@@ -49,279 +61,475 @@ inline std::size_t calculate_hash_value(SOCKET s)
 }
 #endif // defined(ASIO_WINDOWS) || defined(ASIO_CYGWIN_W32_SOCKETS)
 
-// Note: assumes K and V are POD types.
+// An open-addressed hash map. Slots are arranged in groups of 16, and each
+// slot has a one-byte control value that holds 7 bits of the key's hash when
+// the slot is in use. A lookup compares the control bytes of a whole group at
+// once, using SSE2 where available, and only compares keys for the slots whose
+// hash bits match. Erasing an element leaves a tombstone rather than moving
+// other elements, so iterators to other elements remain valid. Inserting an
+// element may invalidate all iterators.
+//
+// Elements must be copy constructible, and are move constructed when the map
+// grows.
 template <typename K, typename V>
 class hash_map
   : private noncopyable
 {
+private:
+  enum { group_width = 16 };
+
+  // Control byte values. Values from 0 to 127 mark slots that are in use.
+  enum
+  {
+    ctrl_empty = -128,
+    ctrl_deleted = -2,
+    ctrl_sentinel = -1
+  };
+
+  template <typename Value> class iterator_base;
+
 public:
   // The type of a value in the map.
   typedef std::pair<K, V> value_type;
 
   // The type of a non-const iterator over the hash map.
-  typedef typename std::list<value_type>::iterator iterator;
+  typedef iterator_base<value_type> iterator;
 
   // The type of a const iterator over the hash map.
-  typedef typename std::list<value_type>::const_iterator const_iterator;
+  typedef iterator_base<const value_type> const_iterator;
 
   // Constructor.
   hash_map()
-    : size_(0),
-      buckets_(0),
-      num_buckets_(0)
+    : ctrl_(0),
+      slots_(0),
+      capacity_(0),
+      size_(0),
+      growth_left_(0)
   {
   }
 
   // Destructor.
   ~hash_map()
   {
-    delete[] buckets_;
+    destroy_all();
+    ::operator delete(static_cast<void*>(slots_));
   }
 
   // Get an iterator for the beginning of the map.
   iterator begin()
   {
-    return values_.begin();
+    return iterator(ctrl_, slots_, true);
   }
 
   // Get an iterator for the beginning of the map.
   const_iterator begin() const
   {
-    return values_.begin();
+    return const_iterator(ctrl_, slots_, true);
   }
 
   // Get an iterator for the end of the map.
   iterator end()
   {
-    return values_.end();
+    return iterator(ctrl_ + capacity_, slots_ + capacity_, false);
   }
 
   // Get an iterator for the end of the map.
   const_iterator end() const
   {
-    return values_.end();
+    return const_iterator(ctrl_ + capacity_, slots_ + capacity_, false);
   }
 
   // Check whether the map is empty.
   bool empty() const
   {
-    return values_.empty();
+    return size_ == 0;
+  }
+
+  // Get the number of entries in the map.
+  std::size_t size() const
+  {
+    return size_;
   }
 
   // Find an entry in the map.
   iterator find(const K& k)
   {
-    if (num_buckets_)
-    {
-      size_t bucket = calculate_hash_value(k) % num_buckets_;
-      iterator it = buckets_[bucket].first;
-      if (it == values_.end())
-        return values_.end();
-      iterator end_it = buckets_[bucket].last;
-      ++end_it;
-      while (it != end_it)
-      {
-        if (it->first == k)
-          return it;
-        ++it;
-      }
-    }
-    return values_.end();
+    std::size_t i = find_index(k);
+    return iterator(ctrl_ + i, slots_ + i, false);
   }
 
   // Find an entry in the map.
   const_iterator find(const K& k) const
   {
-    if (num_buckets_)
-    {
-      size_t bucket = calculate_hash_value(k) % num_buckets_;
-      const_iterator it = buckets_[bucket].first;
-      if (it == values_.end())
-        return it;
-      const_iterator end_it = buckets_[bucket].last;
-      ++end_it;
-      while (it != end_it)
-      {
-        if (it->first == k)
-          return it;
-        ++it;
-      }
-    }
-    return values_.end();
+    std::size_t i = find_index(k);
+    return const_iterator(ctrl_ + i, slots_ + i, false);
   }
 
   // Insert a new entry into the map.
   std::pair<iterator, bool> insert(const value_type& v)
   {
-    if (size_ + 1 >= num_buckets_)
-      rehash(hash_size(size_ + 1));
-    size_t bucket = calculate_hash_value(v.first) % num_buckets_;
-    iterator it = buckets_[bucket].first;
-    if (it == values_.end())
-    {
-      buckets_[bucket].first = buckets_[bucket].last =
-        values_insert(values_.end(), v);
-      ++size_;
-      return std::pair<iterator, bool>(buckets_[bucket].last, true);
-    }
-    iterator end_it = buckets_[bucket].last;
-    ++end_it;
-    while (it != end_it)
-    {
-      if (it->first == v.first)
-        return std::pair<iterator, bool>(it, false);
-      ++it;
-    }
-    buckets_[bucket].last = values_insert(end_it, v);
+    std::size_t i = find_index(v.first);
+    if (i != capacity_)
+      return std::pair<iterator, bool>(
+          iterator(ctrl_ + i, slots_ + i, false), false);
+
+    if (growth_left_ == 0)
+      grow();
+
+    std::size_t hash = hash_value(v.first);
+    i = find_insert_slot(hash);
+    new (static_cast<void*>(slots_ + i)) value_type(v);
+    if (ctrl_[i] == ctrl_empty)
+      --growth_left_;
+    ctrl_[i] = hash_bits(hash);
     ++size_;
-    return std::pair<iterator, bool>(buckets_[bucket].last, true);
+
+    return std::pair<iterator, bool>(
+        iterator(ctrl_ + i, slots_ + i, false), true);
   }
 
   // Erase an entry from the map.
   void erase(iterator it)
   {
-    ASIO_ASSERT(it != values_.end());
-    ASIO_ASSERT(num_buckets_ != 0);
-
-    size_t bucket = calculate_hash_value(it->first) % num_buckets_;
-    bool is_first = (it == buckets_[bucket].first);
-    bool is_last = (it == buckets_[bucket].last);
-    if (is_first && is_last)
-      buckets_[bucket].first = buckets_[bucket].last = values_.end();
-    else if (is_first)
-      ++buckets_[bucket].first;
-    else if (is_last)
-      --buckets_[bucket].last;
-
-    values_erase(it);
+    ASIO_ASSERT(it != end());
+    ASIO_ASSERT(capacity_ != 0);
+
+    std::size_t i = it.slot_ - slots_;
+    slots_[i].~value_type();
     --size_;
+
+    // A probe that reaches a group containing an empty slot stops there, so
+    // the erased slot may be marked empty if its group already has one.
+    // Otherwise it must remain a tombstone to keep later probes going.
+    if (match_empty(ctrl_ + (i - i % group_width)) != 0)
+    {
+      ctrl_[i] = ctrl_empty;
+      ++growth_left_;
+    }
+    else
+      ctrl_[i] = ctrl_deleted;
   }
 
   // Erase a key from the map.
   void erase(const K& k)
   {
     iterator it = find(k);
-    if (it != values_.end())
+    if (it != end())
       erase(it);
   }
 
   // Remove all entries from the map.
   void clear()
   {
-    // Clear the values.
-    values_.clear();
+    destroy_all();
+    if (capacity_)
+    {
+      std::memset(ctrl_, ctrl_empty, capacity_);
+      growth_left_ = max_load(capacity_);
+    }
     size_ = 0;
-
-    // Initialise all buckets to empty.
-    iterator end_it = values_.end();
-    for (size_t i = 0; i < num_buckets_; ++i)
-      buckets_[i].first = buckets_[i].last = end_it;
   }
 
 private:
-  // Calculate the hash size for the specified number of elements.
-  static std::size_t hash_size(std::size_t num_elems)
+  template <typename Value>
+  class iterator_base
   {
-    static std::size_t sizes[] =
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename hash_map::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Value* pointer;
+    typedef Value& reference;
+
+    iterator_base()
+      : ctrl_(0),
+        slot_(0)
     {
-#if defined(ASIO_HASH_MAP_BUCKETS)
-      ASIO_HASH_MAP_BUCKETS
-#else // ASIO_HASH_MAP_BUCKETS
-      3, 13, 23, 53, 97, 193, 389, 769, 1543, 3079, 6151, 12289, 24593,
-      49157, 98317, 196613, 393241, 786433, 1572869, 3145739, 6291469,
-      12582917, 25165843
-#endif // ASIO_HASH_MAP_BUCKETS
-    };
-    const std::size_t nth_size = sizeof(sizes) / sizeof(std::size_t) - 1;
-    for (std::size_t i = 0; i < nth_size; ++i)
-      if (num_elems < sizes[i])
-        return sizes[i];
-    return sizes[nth_size];
-  }
+    }
 
-  // Re-initialise the hash from the values already contained in the list.
-  void rehash(std::size_t num_buckets)
-  {
-    if (num_buckets == num_buckets_)
-      return;
-    ASIO_ASSERT(num_buckets != 0);
-
-    iterator end_iter = values_.end();
-
-    // Update number of buckets and initialise all buckets to empty.
-    bucket_type* tmp = new bucket_type[num_buckets];
-    delete[] buckets_;
-    buckets_ = tmp;
-    num_buckets_ = num_buckets;
-    for (std::size_t i = 0; i < num_buckets_; ++i)
-      buckets_[i].first = buckets_[i].last = end_iter;
-
-    // Put all values back into the hash.
-    iterator iter = values_.begin();
-    while (iter != end_iter)
+    // Converts a non-const iterator to a const iterator.
+    template <typename OtherValue>
+    iterator_base(const iterator_base<OtherValue>& other)
+      : ctrl_(other.ctrl_),
+        slot_(other.slot_)
     {
-      std::size_t bucket = calculate_hash_value(iter->first) % num_buckets_;
-      if (buckets_[bucket].last == end_iter)
-      {
-        buckets_[bucket].first = buckets_[bucket].last = iter++;
-      }
-      else if (++buckets_[bucket].last == iter)
+    }
+
+    Value& operator*() const
+    {
+      return *slot_;
+    }
+
+    Value* operator->() const
+    {
+      return slot_;
+    }
+
+    iterator_base& operator++()
+    {
+      ++ctrl_;
+      ++slot_;
+      skip_unused();
+      return *this;
+    }
+
+    iterator_base operator++(int)
+    {
+      iterator_base tmp(*this);
+      ++*this;
+      return tmp;
+    }
+
+    friend bool operator==(const iterator_base& a, const iterator_base& b)
+    {
+      return a.ctrl_ == b.ctrl_;
+    }
+
+    friend bool operator!=(const iterator_base& a, const iterator_base& b)
+    {
+      return a.ctrl_ != b.ctrl_;
+    }
+
+  private:
+    friend class hash_map;
+    template <typename> friend class iterator_base;
+
+    iterator_base(const signed char* ctrl, Value* slot, bool skip)
+      : ctrl_(ctrl),
+        slot_(slot)
+    {
+      if (skip && ctrl_)
+        skip_unused();
+    }
+
+    // Advance past empty and deleted slots. Stops at the sentinel.
+    void skip_unused()
+    {
+      while (*ctrl_ < ctrl_sentinel)
       {
-        ++iter;
+        ++ctrl_;
+        ++slot_;
       }
-      else
+    }
+
+    const signed char* ctrl_;
+    Value* slot_;
+  };
+
+  // Mix the bits of the hash value, so that both the group index and the
+  // 7 bits stored in the control byte are well distributed.
+  static std::size_t hash_value(const K& k)
+  {
+    uint64_t x = static_cast<uint64_t>(calculate_hash_value(k));
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return static_cast<std::size_t>(x);
+  }
+
+  // Get the hash bits that are stored in the control byte.
+  static signed char hash_bits(std::size_t hash)
+  {
+    return static_cast<signed char>(hash & 0x7F);
+  }
+
+  // Get the maximum number of slots in use, including tombstones, before the
+  // map must grow. At least one slot in eight is kept empty.
+  static std::size_t max_load(std::size_t capacity)
+  {
+    return capacity - capacity / 8;
+  }
+
+  // Get a bitmask of the slots in a group whose control byte has the
+  // specified value.
+  static unsigned int match(const signed char* group, signed char value)
+  {
+#if defined(ASIO_HAS_SSE2)
+    __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<unsigned int>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+#else // defined(ASIO_HAS_SSE2)
+    unsigned int mask = 0;
+    for (int i = 0; i < group_width; ++i)
+      if (group[i] == value)
+        mask |= 1u << i;
+    return mask;
+#endif // defined(ASIO_HAS_SSE2)
+  }
+
+  // Get a bitmask of the empty slots in a group.
+  static unsigned int match_empty(const signed char* group)
+  {
+    return match(group, ctrl_empty);
+  }
+
+  // Get a bitmask of the empty and deleted slots in a group.
+  static unsigned int match_unused(const signed char* group)
+  {
+#if defined(ASIO_HAS_SSE2)
+    __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<unsigned int>(_mm_movemask_epi8(
+          _mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), ctrl)));
+#else // defined(ASIO_HAS_SSE2)
+    unsigned int mask = 0;
+    for (int i = 0; i < group_width; ++i)
+      if (group[i] < ctrl_sentinel)
+        mask |= 1u << i;
+    return mask;
+#endif // defined(ASIO_HAS_SSE2)
+  }
+
+  // Get the position of the lowest set bit in a non-zero mask.
+  static std::size_t lowest_bit(unsigned int mask)
+  {
+    ASIO_ASSERT(mask != 0);
+#if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctz(mask));
+#elif defined(ASIO_MSVC)
+    unsigned long index = 0;
+    _BitScanForward(&index, mask);
+    return static_cast<std::size_t>(index);
+#else
+    std::size_t index = 0;
+    while ((mask & 1) == 0)
+    {
+      mask >>= 1;
+      ++index;
+    }
+    return index;
+#endif
+  }
+
+  // Find the slot that holds the specified key. Returns the capacity if the
+  // key is not found.
+  std::size_t find_index(const K& k) const
+  {
+    if (size_ == 0)
+      return capacity_;
+
+    std::size_t hash = hash_value(k);
+    signed char bits = hash_bits(hash);
+    std::size_t group_mask = capacity_ / group_width - 1;
+    std::size_t group = (hash >> 7) & group_mask;
+
+    // Triangular probing over a power of two number of groups visits every
+    // group, and there is always at least one empty slot.
+    for (std::size_t step = 1;; ++step)
+    {
+      const signed char* ctrl = ctrl_ + group * group_width;
+      for (unsigned int m = match(ctrl, bits); m != 0; m &= m - 1)
       {
-        values_.splice(buckets_[bucket].last, values_, iter++);
-        --buckets_[bucket].last;
+        std::size_t i = group * group_width + lowest_bit(m);
+        if (slots_[i].first == k)
+          return i;
       }
+      if (match_empty(ctrl) != 0)
+        return capacity_;
+      group = (group + step) & group_mask;
     }
   }
 
-  // Insert an element into the values list by splicing from the spares list,
-  // if a spare is available, and otherwise by inserting a new element.
-  iterator values_insert(iterator it, const value_type& v)
+  // Find the first empty or deleted slot in the probe sequence for a hash.
+  std::size_t find_insert_slot(std::size_t hash) const
   {
-    if (spares_.empty())
+    std::size_t group_mask = capacity_ / group_width - 1;
+    std::size_t group = (hash >> 7) & group_mask;
+    for (std::size_t step = 1;; ++step)
     {
-      return values_.insert(it, v);
+      unsigned int m = match_unused(ctrl_ + group * group_width);
+      if (m != 0)
+        return group * group_width + lowest_bit(m);
+      group = (group + step) & group_mask;
     }
+  }
+
+  // Make room for a new element, by growing the map or by reclaiming the
+  // slots used by tombstones.
+  void grow()
+  {
+    if (capacity_ == 0)
+      rehash(initial_capacity());
+    else if (size_ * 16 <= capacity_ * 7)
+      rehash(capacity_);
     else
+      rehash(capacity_ * 2);
+  }
+
+  // Get the capacity used when the first element is inserted.
+  static std::size_t initial_capacity()
+  {
+    std::size_t capacity = group_width;
+#if defined(ASIO_HASH_MAP_BUCKETS)
+    static const std::size_t sizes[] = { ASIO_HASH_MAP_BUCKETS };
+    while (capacity < sizes[0])
+      capacity *= 2;
+#endif // defined(ASIO_HASH_MAP_BUCKETS)
+    return capacity;
+  }
+
+  // Move all elements into new storage with the specified capacity.
+  void rehash(std::size_t capacity)
+  {
+    ASIO_ASSERT(capacity % group_width == 0);
+    ASIO_ASSERT(max_load(capacity) > size_);
+
+    // The slots and control bytes share a single allocation.
+    value_type* new_slots = static_cast<value_type*>(
+        ::operator new(capacity * (sizeof(value_type) + 1) + 1));
+    signed char* new_ctrl = reinterpret_cast<signed char*>(
+        new_slots + capacity);
+    std::memset(new_ctrl, ctrl_empty, capacity);
+    new_ctrl[capacity] = ctrl_sentinel;
+
+    signed char* old_ctrl = ctrl_;
+    value_type* old_slots = slots_;
+    std::size_t old_capacity = capacity_;
+    ctrl_ = new_ctrl;
+    slots_ = new_slots;
+    capacity_ = capacity;
+
+    for (std::size_t i = 0; i < old_capacity; ++i)
     {
-      spares_.front() = v;
-      values_.splice(it, spares_, spares_.begin());
-      return --it;
+      if (old_ctrl[i] >= 0)
+      {
+        std::size_t j = find_insert_slot(hash_value(old_slots[i].first));
+        new (static_cast<void*>(slots_ + j))
+          value_type(std::move(old_slots[i]));
+        ctrl_[j] = old_ctrl[i];
+        old_slots[i].~value_type();
+      }
     }
+
+    growth_left_ = max_load(capacity_) - size_;
+    ::operator delete(static_cast<void*>(old_slots));
   }
 
-  // Erase an element from the values list by splicing it to the spares list.
-  void values_erase(iterator it)
+  // Destroy all elements without changing the control bytes.
+  void destroy_all()
   {
-    *it = value_type();
-    spares_.splice(spares_.begin(), values_, it);
+    for (std::size_t i = 0; i < capacity_; ++i)
+      if (ctrl_[i] >= 0)
+        slots_[i].~value_type();
   }
 
-  // The number of elements in the hash.
-  std::size_t size_;
+  // The control bytes, followed by a sentinel that stops iteration. These are
+  // stored in the same allocation as the slots, after the last slot.
+  signed char* ctrl_;
 
-  // The list of all values in the hash map.
-  std::list<value_type> values_;
+  // The storage for the elements.
+  value_type* slots_;
 
-  // The list of spare nodes waiting to be recycled. Assumes that POD types only
-  // are stored in the hash map.
-  std::list<value_type> spares_;
+  // The number of slots. Always zero or a power of two multiple of the group
+  // width.
+  std::size_t capacity_;
 
-  // The type for a bucket in the hash table.
-  struct bucket_type
-  {
-    iterator first;
-    iterator last;
-  };
-
-  // The buckets in the hash.
-  bucket_type* buckets_;
+  // The number of elements in the map.
+  std::size_t size_;
 
-  // The number of buckets in the hash.
-  std::size_t num_buckets_;
+  // The number of empty slots that may be used before the map must grow.
+  std::size_t growth_left_;
 };
 
 } // namespace detail
@@ -20,6 +20,7 @@
 #if defined(ASIO_HAS_EPOLL)
 
 #include <cstddef>
+#include <functional>
 #include <sys/epoll.h>
 #include "asio/config.hpp"
 #include "asio/detail/epoll_reactor.hpp"
@@ -50,7 +51,13 @@ epoll_reactor::epoll_reactor(asio::execution_context& ctx)
     io_locking_(config(ctx).get("reactor", "io_locking", true)),
     io_locking_spin_count_(
         config(ctx).get("reactor", "io_locking_spin_count", 0)),
-    registered_descriptors_mutex_(mutex_.enabled(), mutex_.spin_count()),
+    speculative_policy_(config(ctx).get("reactor", "speculative_io", -1)),
+    exclusive_accept_(
+        config(ctx).get("reactor", "epoll_exclusive_accept", false)),
+    events_(max_events(ctx), epoll_event(),
+        execution_context::allocator<epoll_event>(ctx)),
+    shards_(execution_context::allocator<shard>(ctx)),
+    next_shard_(0),
     registered_descriptors_(execution_context::allocator<void>(ctx),
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
         io_locking_, io_locking_spin_count_)
@@ -69,10 +76,15 @@ epoll_reactor::epoll_reactor(asio::execution_context& ctx)
     ev.data.ptr = &timer_fd_;
     epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, timer_fd_, &ev);
   }
+
+  create_shards(ctx);
 }
 
 epoll_reactor::~epoll_reactor()
 {
+  for (std::size_t i = 0; i < shards_.size(); ++i)
+    if (shards_[i].epoll_fd_ != -1)
+      close(shards_[i].epoll_fd_);
   if (epoll_fd_ != -1)
     close(epoll_fd_);
   if (timer_fd_ != -1)
@@ -87,12 +99,15 @@ void epoll_reactor::shutdown()
 
   op_queue<operation> ops;
 
-  while (descriptor_state* state = registered_descriptors_.first())
+  descriptor_state* state = registered_descriptors_.first();
+  while (state)
   {
+    descriptor_state* next_state = registered_descriptors_.next(state);
     for (int i = 0; i < max_ops; ++i)
       ops.push(state->op_queue_[i]);
     state->shutdown_ = true;
     registered_descriptors_.free(state);
+    state = next_state;
   }
 
   timer_queues_.get_all_timers(ops);
@@ -136,16 +151,27 @@ void epoll_reactor::notify_fork(
 
     update_timeout();
 
+    // Recreate the shards. A shard that is queued is added disarmed, and is
+    // rearmed once its operation has run.
+    for (std::size_t i = 0; i < shards_.size(); ++i)
+    {
+      if (shards_[i].epoll_fd_ != -1)
+        ::close(shards_[i].epoll_fd_);
+      shards_[i].epoll_fd_ = -1;
+      shards_[i].epoll_fd_ = do_epoll_create();
+      add_shard(shards_[i],
+          !shards_[i].queued_.load(std::memory_order_relaxed));
+    }
+
     // Re-register all descriptors with epoll.
-    mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
     for (descriptor_state* state = registered_descriptors_.first();
-        state != 0; state = state->next_)
+        state != 0; state = registered_descriptors_.next(state))
     {
       if (state->registered_events_ != 0)
       {
         ev.events = state->registered_events_;
         ev.data.ptr = state;
-        int result = epoll_ctl(epoll_fd_,
+        int result = epoll_ctl(epoll_fd(state),
             EPOLL_CTL_ADD, state->descriptor_, &ev);
         if (result != 0)
         {
@@ -177,16 +203,21 @@ int epoll_reactor::register_descriptor(socket_type descriptor,
 
     descriptor_data->reactor_ = this;
     descriptor_data->descriptor_ = descriptor;
+    descriptor_data->shard_ = choose_shard();
     descriptor_data->shutdown_ = false;
     for (int i = 0; i < max_ops; ++i)
+    {
       descriptor_data->try_speculative_[i] = true;
+      descriptor_data->speculative_history_[i] = 0;
+    }
   }
 
   epoll_event ev = { 0, { 0 } };
   ev.events = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLPRI | EPOLLET;
   descriptor_data->registered_events_ = ev.events;
   ev.data.ptr = descriptor_data;
-  int result = epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, descriptor, &ev);
+  int result = epoll_ctl(epoll_fd(descriptor_data),
+      EPOLL_CTL_ADD, descriptor, &ev);
   if (result != 0)
   {
     if (errno == EPERM)
@@ -219,10 +250,14 @@ int epoll_reactor::register_internal_descriptor(
 
     descriptor_data->reactor_ = this;
     descriptor_data->descriptor_ = descriptor;
+    descriptor_data->shard_ = 0;
     descriptor_data->shutdown_ = false;
     descriptor_data->op_queue_[op_type].push(op);
     for (int i = 0; i < max_ops; ++i)
+    {
       descriptor_data->try_speculative_[i] = true;
+      descriptor_data->speculative_history_[i] = 0;
+    }
   }
 
   epoll_event ev = { 0, { 0 } };
@@ -240,6 +275,50 @@ int epoll_reactor::register_internal_descriptor(
   return 0;
 }
 
+void epoll_reactor::register_listener(socket_type descriptor,
+    epoll_reactor::per_descriptor_data& descriptor_data)
+{
+#if defined(EPOLLEXCLUSIVE)
+  if (!exclusive_accept_ || !descriptor_data)
+    return;
+
+  int listening = 0;
+  socklen_t len = sizeof(listening);
+  if (::getsockopt(descriptor, SOL_SOCKET,
+        SO_ACCEPTCONN, &listening, &len) != 0 || !listening)
+    return;
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  if (descriptor_data->registered_events_ == 0
+      || (descriptor_data->registered_events_ & EPOLLEXCLUSIVE) != 0)
+    return;
+
+  // EPOLLEXCLUSIVE may only be specified when a descriptor is added, and may
+  // not be combined with EPOLLPRI. Connections that arrive between removing
+  // and re-adding the descriptor are reported when it is re-added.
+  epoll_event ev = { 0, { 0 } };
+  ev.events = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLET | EPOLLEXCLUSIVE;
+  ev.data.ptr = descriptor_data;
+  epoll_ctl(epoll_fd(descriptor_data), EPOLL_CTL_DEL, descriptor, &ev);
+  if (epoll_ctl(epoll_fd(descriptor_data),
+        EPOLL_CTL_ADD, descriptor, &ev) == 0)
+  {
+    descriptor_data->registered_events_ = ev.events;
+  }
+  else
+  {
+    // Exclusive wakeups are not supported by the kernel, so restore the
+    // original registration.
+    ev.events = descriptor_data->registered_events_;
+    epoll_ctl(epoll_fd(descriptor_data), EPOLL_CTL_ADD, descriptor, &ev);
+  }
+#else // defined(EPOLLEXCLUSIVE)
+  (void)descriptor;
+  (void)descriptor_data;
+#endif // defined(EPOLLEXCLUSIVE)
+}
+
 void epoll_reactor::move_descriptor(socket_type,
     epoll_reactor::per_descriptor_data& target_descriptor_data,
     epoll_reactor::per_descriptor_data& source_descriptor_data)
@@ -276,15 +355,68 @@ void epoll_reactor::start_op(int op_type, socket_type descriptor,
     return;
   }
 
+#if defined(EPOLLEXCLUSIVE)
+  // An exclusive registration cannot be modified to wait for writability.
+  if (op_type == write_op
+      && (descriptor_data->registered_events_ & EPOLLEXCLUSIVE) != 0)
+  {
+    op->ec_ = asio::error::operation_not_supported;
+    on_immediate(op, is_continuation, immediate_arg);
+    return;
+  }
+#endif // defined(EPOLLEXCLUSIVE)
+
   if (descriptor_data->op_queue_[op_type].empty())
   {
     if (allow_speculative
         && (op_type != read_op
           || descriptor_data->op_queue_[except_op].empty()))
     {
-      if (descriptor_data->try_speculative_[op_type])
+      bool try_speculative;
+      switch (descriptor_data->registered_events_ != 0
+          ? speculative_policy_.get() : speculative_policy::always)
       {
-        if (reactor_op::status status = op->perform())
+      case speculative_policy::never:
+        try_speculative = false;
+        break;
+      case speculative_policy::always:
+        try_speculative = true;
+        break;
+      case speculative_policy::adaptive:
+        try_speculative = speculative_policy::should_try(
+            descriptor_data->speculative_history_[op_type]);
+        break;
+      default:
+        try_speculative = descriptor_data->try_speculative_[op_type];
+        break;
+      }
+
+      // When try_speculative_ is set, the descriptor may already have been
+      // reported as ready, and with edge-triggered notification it will not be
+      // reported again. An attempt that the policy skips must then be followed
+      // by a rearm, which is not possible for an exclusive registration.
+      bool rearm = !try_speculative
+        && descriptor_data->try_speculative_[op_type];
+#if defined(EPOLLEXCLUSIVE)
+      if (rearm
+          && (descriptor_data->registered_events_ & EPOLLEXCLUSIVE) != 0)
+      {
+        try_speculative = true;
+        rearm = false;
+      }
+#endif // defined(EPOLLEXCLUSIVE)
+
+      if (try_speculative)
+      {
+        reactor_op::status status = op->perform();
+        if (speculative_policy_.get() == speculative_policy::adaptive)
+        {
+          speculative_policy::record(
+              descriptor_data->speculative_history_[op_type],
+              status == reactor_op::not_done);
+        }
+
+        if (status)
         {
           if (status == reactor_op::done_and_exhausted)
             if (descriptor_data->registered_events_ != 0)
@@ -309,7 +441,8 @@ void epoll_reactor::start_op(int op_type, socket_type descriptor,
           epoll_event ev = { 0, { 0 } };
           ev.events = descriptor_data->registered_events_ | EPOLLOUT;
           ev.data.ptr = descriptor_data;
-          if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, descriptor, &ev) == 0)
+          if (epoll_ctl(epoll_fd(descriptor_data),
+                EPOLL_CTL_MOD, descriptor, &ev) == 0)
           {
             descriptor_data->registered_events_ |= ev.events;
           }
@@ -320,8 +453,17 @@ void epoll_reactor::start_op(int op_type, socket_type descriptor,
             on_immediate(op, is_continuation, immediate_arg);
             return;
           }
+          rearm = false;
         }
       }
+
+      if (rearm)
+      {
+        epoll_event ev = { 0, { 0 } };
+        ev.events = descriptor_data->registered_events_;
+        ev.data.ptr = descriptor_data;
+        epoll_ctl(epoll_fd(descriptor_data), EPOLL_CTL_MOD, descriptor, &ev);
+      }
     }
     else if (descriptor_data->registered_events_ == 0)
     {
@@ -339,7 +481,7 @@ void epoll_reactor::start_op(int op_type, socket_type descriptor,
       epoll_event ev = { 0, { 0 } };
       ev.events = descriptor_data->registered_events_;
       ev.data.ptr = descriptor_data;
-      epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, descriptor, &ev);
+      epoll_ctl(epoll_fd(descriptor_data), EPOLL_CTL_MOD, descriptor, &ev);
     }
   }
 
@@ -418,7 +560,7 @@ void epoll_reactor::deregister_descriptor(socket_type descriptor,
     else if (descriptor_data->registered_events_ != 0)
     {
       epoll_event ev = { 0, { 0 } };
-      epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, descriptor, &ev);
+      epoll_ctl(epoll_fd(descriptor_data), EPOLL_CTL_DEL, descriptor, &ev);
     }
 
     op_queue<operation> ops;
@@ -524,8 +666,9 @@ void epoll_reactor::run(long usec, op_queue<operation>& ops)
   }
 
   // Block on the epoll descriptor.
-  epoll_event events[128];
-  int num_events = epoll_wait(epoll_fd_, events, 128, timeout);
+  epoll_event* events = &events_[0];
+  int num_events = epoll_wait(epoll_fd_, events,
+      static_cast<int>(events_.size()), timeout);
 
 #if defined(ASIO_ENABLE_HANDLER_TRACKING)
   // Trace the waiting events.
@@ -542,6 +685,10 @@ void epoll_reactor::run(long usec, op_queue<operation>& ops)
       // Ignore.
     }
 # endif // defined(ASIO_HAS_TIMERFD)
+    else if (event_shard(ptr))
+    {
+      // Ignore.
+    }
     else
     {
       unsigned event_mask = 0;
@@ -587,6 +734,14 @@ void epoll_reactor::run(long usec, op_queue<operation>& ops)
       check_timers = true;
     }
 #endif // defined(ASIO_HAS_TIMERFD)
+    else if (shard* s = event_shard(ptr))
+    {
+      // The shard's events are retrieved when its operation runs. Like a
+      // descriptor operation, it does not count as work.
+      s->rearm_ = false;
+      s->queued_.store(true, std::memory_order_relaxed);
+      ops.push(s);
+    }
     else
     {
       // The descriptor operation doesn't count as work in and of itself, so we
@@ -630,6 +785,13 @@ void epoll_reactor::interrupt()
   epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, interrupter_.read_descriptor(), &ev);
 }
 
+std::size_t epoll_reactor::max_events(asio::execution_context& ctx)
+{
+  int n = config(ctx).get("reactor", "epoll_max_events",
+      static_cast<int>(default_max_events));
+  return static_cast<std::size_t>(n < 1 ? 1 : n);
+}
+
 int epoll_reactor::do_epoll_create()
 {
 #if defined(EPOLL_CLOEXEC)
@@ -656,6 +818,58 @@ int epoll_reactor::do_epoll_create()
   return fd;
 }
 
+void epoll_reactor::create_shards(asio::execution_context& ctx)
+{
+  int count = config(ctx).get("reactor", "epoll_count", 1);
+  if (count <= 1)
+    return;
+
+  shards_.reserve(count - 1);
+  for (int i = 1; i < count; ++i)
+  {
+    shard& s = shards_.emplace_back(this, events_.size());
+    s.epoll_fd_ = do_epoll_create();
+    add_shard(s, true);
+  }
+}
+
+void epoll_reactor::add_shard(shard& s, bool armed)
+{
+  epoll_event ev = { 0, { 0 } };
+  ev.events = EPOLLONESHOT;
+  if (armed)
+    ev.events |= EPOLLIN;
+  ev.data.ptr = &s;
+  int result = epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, s.epoll_fd_, &ev);
+  if (result != 0)
+  {
+    asio::error_code ec(errno,
+        asio::error::get_system_category());
+    asio::detail::throw_error(ec, "epoll shard");
+  }
+}
+
+epoll_reactor::shard* epoll_reactor::choose_shard()
+{
+  if (shards_.empty())
+    return 0;
+
+  std::size_t n = next_shard_.fetch_add(1, std::memory_order_relaxed);
+  n %= shards_.size() + 1;
+  return n == 0 ? 0 : &shards_[n - 1];
+}
+
+epoll_reactor::shard* epoll_reactor::event_shard(void* ptr)
+{
+  if (shards_.empty())
+    return 0;
+
+  std::less<const void*> less;
+  if (less(ptr, &shards_[0]) || less(&shards_[shards_.size() - 1], ptr))
+    return 0;
+  return static_cast<shard*>(ptr);
+}
+
 int epoll_reactor::do_timerfd_create()
 {
 #if defined(ASIO_HAS_TIMERFD)
@@ -681,13 +895,11 @@ int epoll_reactor::do_timerfd_create()
 
 epoll_reactor::descriptor_state* epoll_reactor::allocate_descriptor_state()
 {
-  mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
   return registered_descriptors_.alloc(io_locking_, io_locking_spin_count_);
 }
 
 void epoll_reactor::free_descriptor_state(epoll_reactor::descriptor_state* s)
 {
-  mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
   registered_descriptors_.free(s);
 }
 
@@ -774,6 +986,72 @@ struct epoll_reactor::perform_io_cleanup_on_block_exit
   operation* first_op_;
 };
 
+epoll_reactor::shard::shard(epoll_reactor* r, std::size_t max_events,
+    const execution_context::allocator<epoll_event>& a)
+  : operation(&epoll_reactor::shard::do_complete),
+    reactor_(r),
+    epoll_fd_(-1),
+    rearm_(false),
+    queued_(false),
+    events_(max_events, epoll_event(), a)
+{
+}
+
+void epoll_reactor::shard::do_complete(void* owner, operation* base,
+    const asio::error_code& /*ec*/, std::size_t /*bytes_transferred*/)
+{
+  if (!owner)
+    return;
+
+  shard* s = static_cast<shard*>(base);
+  epoll_reactor* r = s->reactor_;
+
+  // Neither running the shard nor rearming it counts as work, so we need to
+  // compensate for the work_finished() call that the scheduler will make once
+  // this operation returns.
+  r->scheduler_.compensating_work_started();
+
+  if (s->rearm_)
+  {
+    // The descriptor operations returned by the previous poll were queued
+    // ahead of this operation, and so have already been dequeued. It is now
+    // safe to poll the shard again.
+    s->rearm_ = false;
+    s->queued_.store(false, std::memory_order_relaxed);
+    epoll_event ev = { 0, { 0 } };
+    ev.events = EPOLLIN | EPOLLONESHOT;
+    ev.data.ptr = s;
+    epoll_ctl(r->epoll_fd_, EPOLL_CTL_MOD, s->epoll_fd_, &ev);
+    return;
+  }
+
+  epoll_event* events = &s->events_[0];
+  int num_events = epoll_wait(s->epoll_fd_, events,
+      static_cast<int>(s->events_.size()), 0);
+
+  op_queue<operation> ops;
+  for (int i = 0; i < num_events; ++i)
+  {
+    descriptor_state* descriptor_data =
+      static_cast<descriptor_state*>(events[i].data.ptr);
+    if (!ops.is_enqueued(descriptor_data))
+    {
+      descriptor_data->set_ready_events(events[i].events);
+      ops.push(descriptor_data);
+    }
+    else
+    {
+      descriptor_data->add_ready_events(events[i].events);
+    }
+  }
+
+  // Queue the shard behind its descriptor operations so that it is rearmed
+  // only after they have been dequeued.
+  s->rearm_ = true;
+  ops.push(s);
+  r->scheduler_.post_deferred_completions(ops);
+}
+
 epoll_reactor::descriptor_state::descriptor_state(bool locking, int spin_count)
   : operation(&epoll_reactor::descriptor_state::do_complete),
     mutex_(locking, spin_count)
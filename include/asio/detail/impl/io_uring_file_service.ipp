@@ -20,7 +20,9 @@
 #if defined(ASIO_HAS_FILE) \
   && defined(ASIO_HAS_IO_URING)
 
+#include <cstdio>
 #include <cstring>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include "asio/detail/io_uring_file_service.hpp"
 
@@ -33,6 +35,7 @@ namespace detail {
 io_uring_file_service::io_uring_file_service(
     execution_context& context)
   : execution_context_service_base<io_uring_file_service>(context),
+    io_uring_service_(asio::use_service<io_uring_service>(context)),
     descriptor_service_(context)
 {
 }
@@ -54,6 +57,8 @@ asio::error_code io_uring_file_service::open(
     return ec;
   }
 
+  impl.read_ahead_.reset();
+
   descriptor_ops::state_type state = 0;
   int fd = descriptor_ops::open(path, static_cast<int>(open_flags), 0777, ec);
   if (fd < 0)
@@ -72,10 +77,50 @@ asio::error_code io_uring_file_service::open(
   (void)::posix_fadvise(native_handle(impl), 0, 0,
       impl.is_stream_ ? POSIX_FADV_SEQUENTIAL : POSIX_FADV_RANDOM);
 
+  // Requests that do not meet the alignment required for direct I/O are
+  // performed using a second descriptor that goes through the page cache.
+  if (!ec && (open_flags & file_base::direct) != 0)
+  {
+    asio::error_code ignored_ec;
+    std::size_t align = alignment(impl, ignored_ec);
+    if (align > 0)
+    {
+      impl.direct_memory_alignment_ = align;
+      impl.direct_offset_alignment_ = align;
+      open_buffered(impl);
+    }
+  }
+
   ASIO_ERROR_LOCATION(ec);
   return ec;
 }
 
+std::size_t io_uring_file_service::alignment(
+    const io_uring_file_service::implementation_type& impl,
+    asio::error_code& ec) const
+{
+#if defined(STATX_DIOALIGN)
+  // Linux 6.1 and later report the alignment required for direct I/O. Older
+  // kernels and filesystems that do not report it fall back to the preferred
+  // block size, which is a multiple of the logical block size.
+  struct statx sx;
+  if (::statx(native_handle(impl), "", AT_EMPTY_PATH,
+        STATX_DIOALIGN, &sx) == 0 && (sx.stx_mask & STATX_DIOALIGN) != 0
+      && sx.stx_dio_offset_align != 0)
+  {
+    ec = success_ec_;
+    return sx.stx_dio_mem_align > sx.stx_dio_offset_align
+      ? sx.stx_dio_mem_align : sx.stx_dio_offset_align;
+  }
+#endif // defined(STATX_DIOALIGN)
+
+  struct stat s;
+  int result = ::fstat(native_handle(impl), &s);
+  descriptor_ops::get_last_error(ec, result != 0);
+  ASIO_ERROR_LOCATION(ec);
+  return !ec ? static_cast<std::size_t>(s.st_blksize) : 0;
+}
+
 uint64_t io_uring_file_service::size(
     const io_uring_file_service::implementation_type& impl,
     asio::error_code& ec) const
@@ -120,16 +165,142 @@ asio::error_code io_uring_file_service::sync_data(
   return ec;
 }
 
+asio::error_code io_uring_file_service::set_read_ahead(
+    io_uring_file_service::implementation_type& impl,
+    std::size_t depth, std::size_t chunk_size, asio::error_code& ec)
+{
+  if (depth > 0 && chunk_size == 0)
+  {
+    ec = asio::error::invalid_argument;
+    ASIO_ERROR_LOCATION(ec);
+    return ec;
+  }
+
+  discard_read_ahead(impl);
+  release_read_ahead_impls(impl);
+  impl.read_ahead_depth_ = depth;
+  impl.read_ahead_chunk_size_ = chunk_size;
+  ec = success_ec_;
+  return ec;
+}
+
 uint64_t io_uring_file_service::seek(
     io_uring_file_service::implementation_type& impl, int64_t offset,
     file_base::seek_basis whence, asio::error_code& ec)
 {
+  discard_read_ahead(impl);
   int64_t result = ::lseek(native_handle(impl), offset, whence);
   descriptor_ops::get_last_error(ec, result < 0);
   ASIO_ERROR_LOCATION(ec);
   return !ec ? static_cast<uint64_t>(result) : 0;
 }
 
+bool io_uring_file_service::start_read_ahead(
+    io_uring_file_service::implementation_type& impl,
+    asio::error_code& ec)
+{
+  if (impl.read_ahead_)
+    return true;
+
+  if (!is_open(impl))
+  {
+    ec = asio::error::bad_descriptor;
+    return false;
+  }
+
+  int64_t position = ::lseek(native_handle(impl), 0, SEEK_CUR);
+  descriptor_ops::get_last_error(ec, position < 0);
+  if (ec)
+    return false;
+
+  if (!impl.read_ahead_impls_)
+  {
+    impl.read_ahead_impls_ = new descriptor_service::implementation_type[
+      impl.read_ahead_depth_];
+    for (std::size_t i = 0; i < impl.read_ahead_depth_; ++i)
+    {
+      descriptor_service_.construct(impl.read_ahead_impls_[i]);
+      descriptor_service_.assign(impl.read_ahead_impls_[i],
+          native_handle(impl), ec);
+    }
+  }
+
+  impl.read_ahead_.reset(new file_read_ahead(impl.read_ahead_depth_,
+        impl.read_ahead_chunk_size_, static_cast<uint64_t>(position)));
+
+  // Ask the kernel to start populating the page cache for the whole window.
+  (void)::posix_fadvise(native_handle(impl), position,
+      impl.read_ahead_depth_ * impl.read_ahead_chunk_size_,
+      POSIX_FADV_WILLNEED);
+
+  return true;
+}
+
+void io_uring_file_service::open_buffered(
+    io_uring_file_service::implementation_type& impl)
+{
+  int flags = ::fcntl(native_handle(impl), F_GETFL, 0);
+  if (flags == -1)
+    return;
+
+  // Reopen the file through its descriptor, rather than by path, so that the
+  // buffered descriptor always refers to the same file.
+  char path[64];
+  std::snprintf(path, sizeof(path), "/proc/self/fd/%d", native_handle(impl));
+
+  asio::error_code ec;
+  descriptor_ops::state_type state = 0;
+  int fd = descriptor_ops::open(path,
+      (flags & ~O_DIRECT) | O_CLOEXEC, ec);
+  if (fd < 0)
+    return;
+
+  if (descriptor_service_.assign(impl.buffered_, fd, ec))
+  {
+    asio::error_code ignored_ec;
+    descriptor_ops::close(fd, state, ignored_ec);
+  }
+}
+
+void io_uring_file_service::discard_read_ahead(
+    io_uring_file_service::implementation_type& impl)
+{
+  if (impl.read_ahead_)
+  {
+    // Outstanding chunk reads keep the state alive until they complete, and
+    // are cancelled so that they do not delay reads for the next state.
+    ::lseek(native_handle(impl),
+        static_cast<off_t>(impl.read_ahead_->position()), SEEK_SET);
+    impl.read_ahead_.reset();
+    cancel_read_ahead_impls(impl);
+  }
+}
+
+void io_uring_file_service::cancel_read_ahead_impls(
+    io_uring_file_service::implementation_type& impl)
+{
+  if (impl.read_ahead_impls_)
+  {
+    for (std::size_t i = 0; i < impl.read_ahead_depth_; ++i)
+    {
+      asio::error_code ignored_ec;
+      descriptor_service_.cancel(impl.read_ahead_impls_[i], ignored_ec);
+    }
+  }
+}
+
+void io_uring_file_service::release_read_ahead_impls(
+    io_uring_file_service::implementation_type& impl)
+{
+  if (impl.read_ahead_impls_)
+  {
+    for (std::size_t i = 0; i < impl.read_ahead_depth_; ++i)
+      descriptor_service_.release(impl.read_ahead_impls_[i]);
+    delete[] impl.read_ahead_impls_;
+    impl.read_ahead_impls_ = 0;
+  }
+}
+
 } // namespace detail
 ASIO_INLINE_NAMESPACE_END
 } // namespace asio
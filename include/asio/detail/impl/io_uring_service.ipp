@@ -83,12 +83,11 @@ io_uring_service::io_uring_service(asio::execution_context& ctx)
     iowait_(config(ctx).get("reactor", "io_uring_iowait", true)),
     submit_batch_size_(
         config(ctx).get("reactor", "io_uring_submit_batch_size", 128)),
+    speculative_policy_(config(ctx).get("reactor", "speculative_io", -1)),
     ring_size_(config(ctx).get("reactor",
           "io_uring_ring_size", static_cast<unsigned int>(default_ring_size))),
     unflushed_submits_(0),
     timeout_(),
-    registration_mutex_(
-        config(ctx).get("reactor", "registration_locking", true)),
     registered_io_objects_(execution_context::allocator<void>(ctx),
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
         io_locking_, io_locking_spin_count_),
@@ -128,22 +127,25 @@ void io_uring_service::shutdown()
   op_queue<operation> ops;
 
   // Cancel all outstanding operations.
-  while (io_object* io_obj = registered_io_objects_.first())
+  io_object* io_obj = registered_io_objects_.first();
+  while (io_obj)
   {
+    io_object* next_io_obj = registered_io_objects_.next(io_obj);
     for (int i = 0; i < max_ops; ++i)
     {
       if (!io_obj->queues_[i].op_queue_.empty())
       {
-        ops.push(io_obj->queues_[i].op_queue_);
         std::size_t ring_index = io_obj->queues_[i].first_op_ring_index_;
         mutex::scoped_lock cancel_lock(rings_[ring_index].mutex_);
-        if (::io_uring_sqe* sqe = get_sqe(ring_index))
-          ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
+        prepare_cancel(ring_index, &io_obj->queues_[i]);
         submit_sqes(ring_index);
+        cancel_lock.unlock();
+        ops.push(io_obj->queues_[i].op_queue_);
       }
     }
     io_obj->shutdown_ = true;
     registered_io_objects_.free(io_obj);
+    io_obj = next_io_obj;
   }
 
   // Cancel the timeout operation.
@@ -188,9 +190,10 @@ void io_uring_service::notify_fork(
       // Cancel all outstanding operations. They will be restarted after the
       // fork completes. Each queue's in-flight operation may be on any ring
       // and io_uring_prep_cancel() is ring-scoped, so target that same ring.
-      mutex::scoped_lock registration_lock(registration_mutex_);
+      // A batch is not restarted, as some of its entries may already have
+      // been performed, so its cancelled entries fail with operation_aborted.
       for (io_object* io_obj = registered_io_objects_.first();
-          io_obj != 0; io_obj = io_obj->next_)
+          io_obj != 0; io_obj = registered_io_objects_.next(io_obj))
       {
         mutex::scoped_lock io_object_lock(io_obj->mutex_);
         for (int i = 0; i < max_ops; ++i)
@@ -200,8 +203,7 @@ void io_uring_service::notify_fork(
           {
             std::size_t ring_index = io_obj->queues_[i].first_op_ring_index_;
             mutex::scoped_lock lock(rings_[ring_index].mutex_);
-            if (::io_uring_sqe* sqe = get_sqe(ring_index))
-              ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
+            prepare_cancel(ring_index, &io_obj->queues_[i]);
             submit_sqes(ring_index);
           }
         }
@@ -241,9 +243,8 @@ void io_uring_service::notify_fork(
 #endif // defined(ASIO_HAS_THREAD_SANITIZER)
           if (ptr != this && ptr != &timer_queues_ && ptr != &timeout_)
           {
-            io_queue* io_q = static_cast<io_queue*>(ptr);
-            io_q->set_result(cqe->res);
-            ops.push(io_q);
+            if (io_queue* io_q = io_queue_for_result(ptr, cqe->res))
+              ops.push(io_q);
           }
         }
         ::io_uring_cqe_seen(&rings_[s].ring_, cqe);
@@ -294,6 +295,7 @@ void io_uring_service::register_io_object(
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
     io_obj->queues_[i].first_op_ring_index_ = 0;
+    io_obj->queues_[i].speculative_history_ = 0;
   }
 }
 
@@ -312,18 +314,14 @@ void io_uring_service::register_internal_io_object(
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
     io_obj->queues_[i].first_op_ring_index_ = 0;
+    io_obj->queues_[i].speculative_history_ = 0;
   }
 
   io_obj->queues_[op_type].op_queue_.push(op);
   io_object_lock.unlock();
   mutex::scoped_lock lock(rings_[0].mutex_);
-  if (::io_uring_sqe* sqe = get_sqe(0))
+  if (prepare_op(0, &io_obj->queues_[op_type], op))
   {
-    op->prepare(sqe);
-    ::io_uring_sqe_set_data(sqe, &io_obj->queues_[op_type]);
-#if defined(ASIO_HAS_THREAD_SANITIZER)
-    __tsan_release(&io_obj->queues_[op_type]);
-#endif // defined(ASIO_HAS_THREAD_SANITIZER)
     post_submit_sqes_op(lock, 0);
   }
   else
@@ -356,7 +354,7 @@ void io_uring_service::unregister_buffers()
 
 void io_uring_service::start_op(int op_type,
     io_uring_service::per_io_object_data& io_obj,
-    io_uring_operation* op, bool is_continuation)
+    io_uring_operation* op, bool is_continuation, bool allow_speculative)
 {
   if (!io_obj)
   {
@@ -376,7 +374,34 @@ void io_uring_service::start_op(int op_type,
 
   if (io_obj->queues_[op_type].op_queue_.empty())
   {
-    if (op->perform(false))
+    if (allow_speculative)
+    {
+      switch (speculative_policy_.get())
+      {
+      case speculative_policy::always:
+        op->try_speculative_ = true;
+        break;
+      case speculative_policy::adaptive:
+        op->try_speculative_ = speculative_policy::should_try(
+            io_obj->queues_[op_type].speculative_history_);
+        break;
+      default:
+        break;
+      }
+    }
+
+    bool performed = op->perform(false);
+    if (op->try_speculative_)
+    {
+      op->try_speculative_ = false;
+      if (speculative_policy_.get() == speculative_policy::adaptive)
+      {
+        speculative_policy::record(
+            io_obj->queues_[op_type].speculative_history_, !performed);
+      }
+    }
+
+    if (performed)
     {
       io_object_lock.unlock();
       scheduler_.post_immediate_completion(op, is_continuation);
@@ -388,13 +413,8 @@ void io_uring_service::start_op(int op_type,
       io_obj->queues_[op_type].first_op_ring_index_ = ring_index;
       io_object_lock.unlock();
       mutex::scoped_lock lock(rings_[ring_index].mutex_);
-      if (::io_uring_sqe* sqe = get_sqe(ring_index))
+      if (prepare_op(ring_index, &io_obj->queues_[op_type], op))
       {
-        op->prepare(sqe);
-        ::io_uring_sqe_set_data(sqe, &io_obj->queues_[op_type]);
-#if defined(ASIO_HAS_THREAD_SANITIZER)
-        __tsan_release(&io_obj->queues_[op_type]);
-#endif // defined(ASIO_HAS_THREAD_SANITIZER)
         scheduler_.work_started();
         post_submit_sqes_op(lock, ring_index);
       }
@@ -451,11 +471,8 @@ void io_uring_service::cancel_ops_by_key(
           std::size_t ring_index =
             io_obj->queues_[op_type].first_op_ring_index_;
           mutex::scoped_lock lock(rings_[ring_index].mutex_);
-          if (::io_uring_sqe* sqe = get_sqe(ring_index))
-          {
-            ::io_uring_prep_cancel(sqe, &io_obj->queues_[op_type], 0);
-            submit_sqes(ring_index);
-          }
+          prepare_cancel(ring_index, &io_obj->queues_[op_type]);
+          submit_sqes(ring_index);
         }
       }
       else
@@ -606,9 +623,8 @@ void io_uring_service::run_single_ring(long usec, op_queue<operation>& ops)
         }
         else
         {
-          io_queue* io_q = static_cast<io_queue*>(ptr);
-          io_q->set_result(cqe->res);
-          ops.push(io_q);
+          if (io_queue* io_q = io_queue_for_result(ptr, cqe->res))
+            ops.push(io_q);
         }
       }
       ::io_uring_cqe_seen(ring, cqe);
@@ -747,9 +763,8 @@ void io_uring_service::run_multi_ring(long usec, op_queue<operation>& ops)
           }
           else
           {
-            io_queue* io_q = static_cast<io_queue*>(ptr);
-            io_q->set_result(cqe->res);
-            ops.push(io_q);
+            if (io_queue* io_q = io_queue_for_result(ptr, cqe->res))
+              ops.push(io_q);
           }
         }
         ::io_uring_cqe_seen(ring, cqe);
@@ -885,6 +900,21 @@ public:
     o->service_->run(0, ops);
     o->service_->scheduler_.post_deferred_completions(ops);
 
+    // Each call to run() processes a limited number of completions. Signal the
+    // eventfd again if any remain, as the kernel will not do so until another
+    // completion is posted.
+    for (std::size_t i = 0; i < o->service_->rings_.size(); ++i)
+    {
+      if (::io_uring_cq_ready(&o->service_->rings_[i].ring_) != 0)
+      {
+        uint64_t counter(1);
+        ssize_t result = ::write(o->service_->event_fd_,
+            &counter, sizeof(uint64_t));
+        (void)result;
+        break;
+      }
+    }
+
     return not_done;
   }
 
@@ -911,13 +941,11 @@ void io_uring_service::register_with_reactor()
 
 io_uring_service::io_object* io_uring_service::allocate_io_object()
 {
-  mutex::scoped_lock registration_lock(registration_mutex_);
   return registered_io_objects_.alloc(io_locking_, io_locking_spin_count_);
 }
 
 void io_uring_service::free_io_object(io_uring_service::io_object* io_obj)
 {
-  mutex::scoped_lock registration_lock(registration_mutex_);
   registered_io_objects_.free(io_obj);
 }
 
@@ -952,8 +980,7 @@ bool io_uring_service::do_cancel_ops(
         io_obj->queues_[i].cancel_requested_ = true;
         std::size_t ring_index = io_obj->queues_[i].first_op_ring_index_;
         mutex::scoped_lock lock(rings_[ring_index].mutex_);
-        if (::io_uring_sqe* sqe = get_sqe(ring_index))
-          ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
+        prepare_cancel(ring_index, &io_obj->queues_[i]);
         submit_sqes(ring_index);
       }
     }
@@ -1050,6 +1077,94 @@ void io_uring_service::submit_sqes(std::size_t ring_index)
   }
 }
 
+bool io_uring_service::prepare_op(std::size_t ring_index,
+    io_uring_service::io_queue* io_q, io_uring_operation* op)
+{
+  if (!op->is_batch_)
+  {
+    if (::io_uring_sqe* sqe = get_sqe(ring_index))
+    {
+      op->prepare(sqe);
+      ::io_uring_sqe_set_data(sqe, io_q);
+#if defined(ASIO_HAS_THREAD_SANITIZER)
+      __tsan_release(io_q);
+#endif // defined(ASIO_HAS_THREAD_SANITIZER)
+      return true;
+    }
+    return false;
+  }
+
+  // The entries of a batch are prepared without flushing the submission queue,
+  // so that none can complete before the count of remaining entries is set.
+  // Entries that do not fit in the submission queue fail immediately.
+  io_uring_batch_operation* batch = static_cast<io_uring_batch_operation*>(op);
+  ::io_uring* ring = &rings_[ring_index].ring_;
+  std::size_t prepared = 0;
+  for (std::size_t i = 0; i < batch->size(); ++i)
+  {
+    ::io_uring_sqe* sqe = (i == 0)
+      ? get_sqe(ring_index) : ::io_uring_get_sqe(ring);
+    if (!sqe)
+    {
+      if (i == 0)
+        return false;
+      batch->entries_[i].result_ = -ENOBUFS;
+      continue;
+    }
+    if (i != 0)
+      ++rings_[ring_index].pending_sqes_;
+    batch->prepare_entry(i, sqe);
+    void* data = batch->entry_user_data(i);
+    ::io_uring_sqe_set_data(sqe, data);
+#if defined(ASIO_HAS_THREAD_SANITIZER)
+    __tsan_release(data);
+#endif // defined(ASIO_HAS_THREAD_SANITIZER)
+    ++prepared;
+  }
+  batch->remaining_ = prepared;
+  batch->io_queue_ = io_q;
+  return true;
+}
+
+void io_uring_service::prepare_cancel(
+    std::size_t ring_index, io_uring_service::io_queue* io_q)
+{
+  io_uring_operation* op = io_q->op_queue_.front();
+  if (op && op->is_batch_)
+  {
+    io_uring_batch_operation* batch =
+      static_cast<io_uring_batch_operation*>(op);
+    for (std::size_t i = 0; i < batch->size(); ++i)
+      if (::io_uring_sqe* sqe = get_sqe(ring_index))
+        ::io_uring_prep_cancel(sqe, batch->entry_user_data(i), 0);
+  }
+  else if (::io_uring_sqe* sqe = get_sqe(ring_index))
+    ::io_uring_prep_cancel(sqe, io_q, 0);
+}
+
+io_uring_service::io_queue* io_uring_service::io_queue_for_result(
+    void* ptr, int result)
+{
+  uintptr_t value = reinterpret_cast<uintptr_t>(ptr);
+  if ((value & io_uring_batch_operation::entry_tag) != 0)
+  {
+    io_uring_batch_operation::entry* e =
+      reinterpret_cast<io_uring_batch_operation::entry*>(
+          value & ~static_cast<uintptr_t>(io_uring_batch_operation::entry_tag));
+    e->result_ = result;
+    io_uring_batch_operation* batch = e->batch_;
+    if (--batch->remaining_ != 0)
+      return 0;
+    io_queue* io_q = static_cast<io_queue*>(batch->io_queue_);
+    io_q->set_result(0);
+    return io_q;
+  }
+
+  io_queue* io_q = static_cast<io_queue*>(ptr);
+  io_q->set_result(result);
+  return io_q;
+}
+
 void io_uring_service::post_submit_sqes_op(
     mutex::scoped_lock& lock, std::size_t ring_index)
 {
@@ -1195,13 +1310,8 @@ operation* io_uring_service::io_queue::perform_io(int result)
     std::size_t ring_index = service->current_ring_index();
     first_op_ring_index_ = ring_index;
     mutex::scoped_lock lock(service->rings_[ring_index].mutex_);
-    if (::io_uring_sqe* sqe = service->get_sqe(ring_index))
+    if (service->prepare_op(ring_index, this, op_queue_.front()))
     {
-      op_queue_.front()->prepare(sqe);
-      ::io_uring_sqe_set_data(sqe, this);
-#if defined(ASIO_HAS_THREAD_SANITIZER)
-      __tsan_release(this);
-#endif // defined(ASIO_HAS_THREAD_SANITIZER)
       service->post_submit_sqes_op(lock, ring_index);
     }
     else
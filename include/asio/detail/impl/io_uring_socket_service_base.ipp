@@ -214,12 +214,13 @@ asio::error_code io_uring_socket_service_base::do_assign(
 
 void io_uring_socket_service_base::start_op(
     io_uring_socket_service_base::base_implementation_type& impl,
-    int op_type, io_uring_operation* op, bool is_continuation, bool noop)
+    int op_type, io_uring_operation* op, bool is_continuation, bool noop,
+    bool allow_speculative)
 {
   if (!noop)
   {
     io_uring_service_.start_op(op_type,
-        impl.io_object_data_, op, is_continuation);
+        impl.io_object_data_, op, is_continuation, allow_speculative);
   }
   else
   {
@@ -56,7 +56,6 @@ kqueue_reactor::kqueue_reactor(asio::execution_context& ctx)
     io_locking_(config(ctx).get("reactor", "io_locking", true)),
     io_locking_spin_count_(
         config(ctx).get("reactor", "io_locking_spin_count", 0)),
-    registered_descriptors_mutex_(mutex_.enabled()),
     registered_descriptors_(execution_context::allocator<void>(ctx),
         config(ctx).get("reactor", "preallocated_io_objects", 0U),
         io_locking_, io_locking_spin_count_)
@@ -85,12 +84,15 @@ void kqueue_reactor::shutdown()
 
   op_queue<operation> ops;
 
-  while (descriptor_state* state = registered_descriptors_.first())
+  descriptor_state* state = registered_descriptors_.first();
+  while (state)
   {
+    descriptor_state* next_state = registered_descriptors_.next(state);
     for (int i = 0; i < max_ops; ++i)
       ops.push(state->op_queue_[i]);
     state->shutdown_ = true;
     registered_descriptors_.free(state);
+    state = next_state;
   }
 
   timer_queues_.get_all_timers(ops);
@@ -120,9 +122,8 @@ void kqueue_reactor::notify_fork(
     }
 
     // Re-register all descriptors with kqueue.
-    mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
     for (descriptor_state* state = registered_descriptors_.first();
-        state != 0; state = state->next_)
+        state != 0; state = registered_descriptors_.next(state))
     {
       if (state->num_kevents_ > 0)
       {
@@ -572,7 +573,6 @@ int kqueue_reactor::do_kqueue_create()
 
 kqueue_reactor::descriptor_state* kqueue_reactor::allocate_descriptor_state()
 {
-  mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
   auto* s = registered_descriptors_.alloc(io_locking_, io_locking_spin_count_);
   ref_count_up_release(allocation_counter_);
   return s;
@@ -580,7 +580,6 @@ kqueue_reactor::descriptor_state* kqueue_reactor::allocate_descriptor_state()
 
 void kqueue_reactor::free_descriptor_state(kqueue_reactor::descriptor_state* s)
 {
-  mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
   registered_descriptors_.free(s);
 }
 
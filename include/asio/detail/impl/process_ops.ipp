@@ -0,0 +1,161 @@
+//
+// detail/impl/process_ops.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IMPL_PROCESS_OPS_IPP
+#define ASIO_DETAIL_IMPL_PROCESS_OPS_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_PROCESS)
+
+#include <cerrno>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "asio/detail/process_ops.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+extern char** environ;
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+namespace process_ops {
+
+int spawn(const char* path, char* const argv[], int flags,
+    int parent_fds[3], int& pidfd, asio::error_code& ec)
+{
+  int child_fds[3] = { -1, -1, -1 };
+  int result = 0;
+  for (int i = 0; i < 3; ++i)
+  {
+    parent_fds[i] = -1;
+    if (result == 0 && (flags & (1 << i)) != 0)
+    {
+      // Pipes are created close-on-exec so that they do not leak into other
+      // children. The child's end is duplicated onto its standard stream,
+      // which clears the flag for that descriptor only.
+      int fds[2];
+      result = ::pipe2(fds, O_CLOEXEC);
+      if (result == 0)
+      {
+        parent_fds[i] = i == 0 ? fds[1] : fds[0];
+        child_fds[i] = i == 0 ? fds[0] : fds[1];
+      }
+      else
+        result = errno;
+    }
+  }
+
+  posix_spawn_file_actions_t actions;
+  bool have_actions = false;
+  if (result == 0)
+  {
+    result = ::posix_spawn_file_actions_init(&actions);
+    have_actions = (result == 0);
+  }
+  for (int i = 0; i < 3 && result == 0; ++i)
+    if (child_fds[i] != -1)
+      result = ::posix_spawn_file_actions_adddup2(&actions, child_fds[i], i);
+
+  pid_t pid = -1;
+  if (result == 0)
+    result = ::posix_spawn(&pid, path, &actions, 0, argv, environ);
+  if (have_actions)
+    ::posix_spawn_file_actions_destroy(&actions);
+
+  for (int i = 0; i < 3; ++i)
+    if (child_fds[i] != -1)
+      ::close(child_fds[i]);
+
+  // The pidfd refers to the child itself, so it remains valid even if the
+  // process id is reused after the child has been reaped.
+  pidfd = -1;
+  if (result == 0)
+  {
+    pidfd = static_cast<int>(::syscall(__NR_pidfd_open, pid, 0));
+    if (pidfd == -1)
+    {
+      result = errno;
+      ::kill(pid, SIGKILL);
+      int status = 0;
+      while (::waitpid(pid, &status, 0) == -1 && errno == EINTR) {}
+    }
+  }
+
+  if (result != 0)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      if (parent_fds[i] != -1)
+        ::close(parent_fds[i]);
+      parent_fds[i] = -1;
+    }
+    ec = asio::error_code(result, asio::error::get_system_category());
+    return -1;
+  }
+
+  ec = asio::error_code();
+  return pid;
+}
+
+int send_signal(int pidfd, int signal_number, asio::error_code& ec)
+{
+  int result = static_cast<int>(
+      ::syscall(__NR_pidfd_send_signal, pidfd, signal_number, 0, 0));
+  if (result != 0)
+    ec = asio::error_code(errno, asio::error::get_system_category());
+  else
+    ec = asio::error_code();
+  return result;
+}
+
+bool reap(int pid, bool block, int& exit_code, asio::error_code& ec)
+{
+  int status = 0;
+  pid_t result = 0;
+  do
+    result = ::waitpid(pid, &status, block ? 0 : WNOHANG);
+  while (result == -1 && errno == EINTR);
+
+  if (result == -1)
+  {
+    ec = asio::error_code(errno, asio::error::get_system_category());
+    return false;
+  }
+
+  ec = asio::error_code();
+  if (result == 0)
+    return false;
+
+  if (WIFSIGNALED(status))
+    exit_code = 128 + WTERMSIG(status);
+  else
+    exit_code = WEXITSTATUS(status);
+  return true;
+}
+
+} // namespace process_ops
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_PROCESS)
+
+#endif // ASIO_DETAIL_IMPL_PROCESS_OPS_IPP
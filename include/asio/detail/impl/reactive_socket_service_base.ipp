@@ -36,7 +36,16 @@ reactive_socket_service_base::reactive_socket_service_base(
     extra_state_(
         asio::config(context).get(
           "reactor", "reset_edge_on_partial_read", 0)
-        ? socket_ops::reset_edge_on_partial_read : 0)
+        ? socket_ops::reset_edge_on_partial_read : 0),
+    busy_poll_usec_(
+        asio::config(context).get(
+          "reactor", "socket_busy_poll_usec", 0)),
+    op_slots_(
+        asio::config(context).get(
+          "reactor", "socket_op_slots", false))
+#if defined(ASIO_HAS_IO_URING)
+    , io_uring_service_(0)
+#endif // defined(ASIO_HAS_IO_URING)
 {
   reactor_.init_task();
 }
@@ -51,6 +60,11 @@ void reactive_socket_service_base::construct(
   impl.socket_ = invalid_socket;
   impl.state_ = 0;
   impl.reactor_data_ = reactor::per_descriptor_data();
+  impl.read_slot_ = 0;
+  impl.write_slot_ = 0;
+#if defined(ASIO_HAS_IO_URING)
+  impl.io_object_data_ = 0;
+#endif // defined(ASIO_HAS_IO_URING)
 }
 
 void reactive_socket_service_base::base_move_construct(
@@ -64,6 +78,17 @@ void reactive_socket_service_base::base_move_construct(
   impl.state_ = other_impl.state_;
   other_impl.state_ = 0;
 
+  impl.read_slot_ = other_impl.read_slot_;
+  other_impl.read_slot_ = 0;
+
+  impl.write_slot_ = other_impl.write_slot_;
+  other_impl.write_slot_ = 0;
+
+#if defined(ASIO_HAS_IO_URING)
+  impl.io_object_data_ = other_impl.io_object_data_;
+  other_impl.io_object_data_ = 0;
+#endif // defined(ASIO_HAS_IO_URING)
+
   reactor_.move_descriptor(impl.socket_,
       impl.reactor_data_, other_impl.reactor_data_);
 }
@@ -81,6 +106,27 @@ void reactive_socket_service_base::base_move_assign(
   impl.state_ = other_impl.state_;
   other_impl.state_ = 0;
 
+  impl.read_slot_ = other_impl.read_slot_;
+  other_impl.read_slot_ = 0;
+
+  impl.write_slot_ = other_impl.write_slot_;
+  other_impl.write_slot_ = 0;
+
+#if defined(ASIO_HAS_IO_URING)
+  if (&other_service == this)
+  {
+    impl.io_object_data_ = other_impl.io_object_data_;
+    other_impl.io_object_data_ = 0;
+  }
+  else
+  {
+    // The io_uring registration belongs to the other service's execution
+    // context. It will be re-created here by the next io_uring send.
+    other_service.deregister_io_uring_object(other_impl);
+    other_service.cleanup_io_uring_object(other_impl);
+  }
+#endif // defined(ASIO_HAS_IO_URING)
+
   other_service.reactor_.move_descriptor(impl.socket_,
       impl.reactor_data_, other_impl.reactor_data_);
 }
@@ -95,12 +141,17 @@ void reactive_socket_service_base::destroy(
 
     reactor_.deregister_descriptor(impl.socket_, impl.reactor_data_,
         (impl.state_ & socket_ops::possible_dup) == 0);
+    deregister_io_uring_object(impl);
 
     asio::error_code ignored_ec;
     socket_ops::close(impl.socket_, impl.state_, true, ignored_ec);
 
     reactor_.cleanup_descriptor_data(impl.reactor_data_);
+    cleanup_io_uring_object(impl);
   }
+
+  op_slot::release(impl.read_slot_);
+  op_slot::release(impl.write_slot_);
 }
 
 asio::error_code reactive_socket_service_base::close(
@@ -114,10 +165,12 @@ asio::error_code reactive_socket_service_base::close(
 
     reactor_.deregister_descriptor(impl.socket_, impl.reactor_data_,
         (impl.state_ & socket_ops::possible_dup) == 0);
+    deregister_io_uring_object(impl);
 
     socket_ops::close(impl.socket_, impl.state_, false, ec);
 
     reactor_.cleanup_descriptor_data(impl.reactor_data_);
+    cleanup_io_uring_object(impl);
   }
   else
   {
@@ -132,6 +185,8 @@ asio::error_code reactive_socket_service_base::close(
   // We'll just have to assume that other OSes follow the same behaviour. The
   // known exception is when Windows's closesocket() function fails with
   // WSAEWOULDBLOCK, but this case is handled inside socket_ops::close().
+  op_slot::release(impl.read_slot_);
+  op_slot::release(impl.write_slot_);
   construct(impl);
 
   return ec;
@@ -152,7 +207,11 @@ socket_type reactive_socket_service_base::release(
 
   reactor_.deregister_descriptor(impl.socket_, impl.reactor_data_, false);
   reactor_.cleanup_descriptor_data(impl.reactor_data_);
+  deregister_io_uring_object(impl);
+  cleanup_io_uring_object(impl);
   socket_type sock = impl.socket_;
+  op_slot::release(impl.read_slot_);
+  op_slot::release(impl.write_slot_);
   construct(impl);
   ec = asio::error_code();
   return sock;
@@ -172,6 +231,10 @@ asio::error_code reactive_socket_service_base::cancel(
         "socket", &impl, impl.socket_, "cancel"));
 
   reactor_.cancel_ops(impl.socket_, impl.reactor_data_);
+#if defined(ASIO_HAS_IO_URING)
+  if (impl.io_object_data_)
+    io_uring_service_.load()->cancel_ops(impl.io_object_data_);
+#endif // defined(ASIO_HAS_IO_URING)
   ec = asio::error_code();
   return ec;
 }
@@ -210,6 +273,7 @@ asio::error_code reactive_socket_service_base::do_open(
     impl.state_ = 0;
     break;
   }
+  apply_busy_poll(impl);
   ec = asio::error_code();
   return ec;
 }
@@ -247,10 +311,32 @@ asio::error_code reactive_socket_service_base::do_assign(
     break;
   }
   impl.state_ |= socket_ops::possible_dup;
+  apply_busy_poll(impl);
+#if defined(ASIO_HAS_EPOLL)
+  if (type == SOCK_STREAM)
+    reactor_.register_listener(impl.socket_, impl.reactor_data_);
+#endif // defined(ASIO_HAS_EPOLL)
   ec = asio::error_code();
   return ec;
 }
 
+void reactive_socket_service_base::apply_busy_poll(
+    reactive_socket_service_base::base_implementation_type& impl)
+{
+#if defined(SO_BUSY_POLL)
+  if (busy_poll_usec_ > 0)
+  {
+    // Failure is not an error, as raising the value above the system-wide
+    // default requires additional privileges.
+    asio::error_code ignored_ec;
+    socket_ops::setsockopt(impl.socket_, impl.state_, SOL_SOCKET,
+        SO_BUSY_POLL, &busy_poll_usec_, sizeof(busy_poll_usec_), ignored_ec);
+  }
+#else // defined(SO_BUSY_POLL)
+  (void)impl;
+#endif // defined(SO_BUSY_POLL)
+}
+
 void reactive_socket_service_base::do_start_op(
     reactive_socket_service_base::base_implementation_type& impl,
     int op_type, reactor_op* op, bool is_continuation,
@@ -318,6 +404,42 @@ void reactive_socket_service_base::do_start_connect_op(
   on_immediate(op, is_continuation, immediate_arg);
 }
 
+#if defined(ASIO_HAS_IO_URING)
+io_uring_service& reactive_socket_service_base::get_io_uring_service()
+{
+  io_uring_service* service = io_uring_service_.load();
+  if (!service)
+  {
+    service = &asio::use_service<io_uring_service>(reactor_.context());
+    service->init_task();
+    io_uring_service_.store(service);
+  }
+  return *service;
+}
+#endif // defined(ASIO_HAS_IO_URING)
+
+void reactive_socket_service_base::deregister_io_uring_object(
+    reactive_socket_service_base::base_implementation_type& impl)
+{
+#if defined(ASIO_HAS_IO_URING)
+  if (impl.io_object_data_)
+    io_uring_service_.load()->deregister_io_object(impl.io_object_data_);
+#else // defined(ASIO_HAS_IO_URING)
+  (void)impl;
+#endif // defined(ASIO_HAS_IO_URING)
+}
+
+void reactive_socket_service_base::cleanup_io_uring_object(
+    reactive_socket_service_base::base_implementation_type& impl)
+{
+#if defined(ASIO_HAS_IO_URING)
+  if (impl.io_object_data_)
+    io_uring_service_.load()->cleanup_io_object(impl.io_object_data_);
+#else // defined(ASIO_HAS_IO_URING)
+  (void)impl;
+#endif // defined(ASIO_HAS_IO_URING)
+}
+
 } // namespace detail
 ASIO_INLINE_NAMESPACE_END
 } // namespace asio
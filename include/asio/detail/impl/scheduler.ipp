@@ -18,6 +18,7 @@
 #include "asio/detail/config.hpp"
 
 #include "asio/config.hpp"
+#include "asio/detail/chrono.hpp"
 #include "asio/detail/event.hpp"
 #include "asio/detail/limits.hpp"
 #include "asio/detail/scheduler.hpp"
@@ -69,7 +70,7 @@ struct scheduler::task_cleanup
     // Enqueue the completed operations and reinsert the task at the end of
     // the operation queue.
     lock_->lock();
-    scheduler_->task_interrupted_ = true;
+    scheduler_->task_interrupted_.store(true, std::memory_order_relaxed);
     scheduler_->op_queue_.push(this_thread_->private_op_queue);
     scheduler_->op_queue_.push(&scheduler_->task_operation_);
   }
@@ -125,6 +126,13 @@ scheduler::scheduler(asio::execution_context& ctx,
     outstanding_work_(0),
     task_usec_(config(ctx).get("scheduler", "task_usec", -1L)),
     wait_usec_(config(ctx).get("scheduler", "wait_usec", -1L)),
+    busy_poll_usec_(config(ctx).get("scheduler", "busy_poll_usec", 0L)),
+    busy_poll_adaptive_(config(ctx).get("scheduler",
+          "busy_poll_adaptive", true)),
+    busy_poll_budget_usec_(busy_poll_usec_),
+    busy_poll_idle_usec_(0),
+    memory_limit_(config(ctx).get("scheduler", "recycling_memory_limit",
+          static_cast<std::size_t>(ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT))),
     thread_()
 {
   ASIO_HANDLER_TRACKING_INIT;
@@ -149,7 +157,12 @@ scheduler::scheduler(scheduler::internal, asio::execution_context& ctx)
     shutdown_(false),
     outstanding_work_(0),
     task_usec_(-1L),
-    wait_usec_(-1L)
+    wait_usec_(-1L),
+    busy_poll_usec_(0),
+    busy_poll_adaptive_(false),
+    busy_poll_budget_usec_(0),
+    busy_poll_idle_usec_(0),
+    memory_limit_(ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT)
 {
   ASIO_HANDLER_TRACKING_INIT;
 }
@@ -212,6 +225,7 @@ std::size_t scheduler::run(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -234,6 +248,7 @@ std::size_t scheduler::run_one(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -252,6 +267,7 @@ std::size_t scheduler::wait_one(long usec, asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -270,6 +286,7 @@ std::size_t scheduler::poll(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -301,6 +318,7 @@ std::size_t scheduler::poll_one(asio::error_code& ec)
 
   thread_info this_thread;
   this_thread.private_outstanding_work = 0;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   mutex::scoped_lock lock(mutex_);
@@ -471,7 +489,8 @@ std::size_t scheduler::do_run_one(mutex::scoped_lock& lock,
 
       if (o == &task_operation_)
       {
-        task_interrupted_ = more_handlers || task_usec_ == 0;
+        task_interrupted_.store(more_handlers || task_usec_ == 0,
+            std::memory_order_relaxed);
 
         if (more_handlers && !one_thread_ && wait_usec_ != 0)
           wakeup_event_.unlock_and_signal_one(lock);
@@ -484,8 +503,11 @@ std::size_t scheduler::do_run_one(mutex::scoped_lock& lock,
         // Run the task. May throw an exception. Only block if the operation
         // queue is empty and we're not polling, otherwise we want to return
         // as soon as possible.
-        task_->run(more_handlers ? 0 : task_usec_,
-            this_thread.private_op_queue);
+        if (!more_handlers && task_usec_ != 0 && busy_poll_usec_ > 0)
+          run_task_with_busy_poll(this_thread.private_op_queue);
+        else
+          task_->run(more_handlers ? 0 : task_usec_,
+              this_thread.private_op_queue);
       }
       else
       {
@@ -551,7 +573,8 @@ std::size_t scheduler::do_wait_one(mutex::scoped_lock& lock,
     bool more_handlers = (!op_queue_.empty());
 
     usec = (task_usec_ >= 0 && task_usec_ < usec) ? task_usec_ : usec;
-    task_interrupted_ = more_handlers || usec == 0;
+    task_interrupted_.store(more_handlers || usec == 0,
+        std::memory_order_relaxed);
 
     if (more_handlers && !one_thread_ && wait_usec_ != 0)
       wakeup_event_.unlock_and_signal_one(lock);
@@ -657,15 +680,65 @@ std::size_t scheduler::do_poll_one(mutex::scoped_lock& lock,
   return 1;
 }
 
+void scheduler::run_task_with_busy_poll(op_queue<operation>& ops)
+{
+  typedef chrono::steady_clock clock;
+  clock::time_point start = clock::now();
+
+  // Poll the task without blocking until it produces some operations, it is
+  // interrupted because handlers have been queued or the scheduler has been
+  // stopped, or the budget is exhausted. The interruption flag is checked
+  // without taking the lock, which is needed only once there is work to
+  // dequeue and is then acquired by the task_cleanup object.
+  if (busy_poll_budget_usec_ > 0)
+  {
+    clock::time_point end = start
+      + chrono::microseconds(busy_poll_budget_usec_);
+    for (;;)
+    {
+      task_->run(0, ops);
+      if (!ops.empty())
+        break;
+
+      if (task_interrupted_.load(std::memory_order_relaxed))
+        return;
+
+      if (clock::now() >= end)
+        break;
+    }
+  }
+
+  // Fall back to blocking on the task.
+  if (ops.empty())
+    task_->run(task_usec_, ops);
+
+  // Adapt the budget to cover the typical idle period between operations, or
+  // stop spinning if operations are arriving too infrequently for the spin to
+  // pay off. The idle period continues to be measured while blocking, so the
+  // budget recovers once operations start arriving frequently again. Long idle
+  // periods are clamped so that a single one does not dominate the average.
+  if (busy_poll_adaptive_ && !ops.empty())
+  {
+    long idle_usec = static_cast<long>(
+        chrono::duration_cast<chrono::microseconds>(
+          clock::now() - start).count());
+    if (idle_usec > 4 * busy_poll_usec_)
+      idle_usec = 4 * busy_poll_usec_;
+    busy_poll_idle_usec_ += (idle_usec - busy_poll_idle_usec_) / 8;
+    long budget = 2 * busy_poll_idle_usec_ + 1;
+    busy_poll_budget_usec_ = budget <= busy_poll_usec_ ? budget : 0;
+  }
+}
+
 void scheduler::stop_all_threads(
     mutex::scoped_lock& lock)
 {
   stopped_ = true;
   wakeup_event_.signal_all(lock);
 
-  if (!task_interrupted_ && task_)
+  if (!task_interrupted_.load(std::memory_order_relaxed) && task_)
   {
-    task_interrupted_ = true;
+    task_interrupted_.store(true, std::memory_order_relaxed);
     task_->interrupt();
   }
 }
@@ -675,9 +748,9 @@ void scheduler::wake_one_thread_and_unlock(
 {
   if (wait_usec_ == 0 || !wakeup_event_.maybe_unlock_and_signal_one(lock))
   {
-    if (!task_interrupted_ && task_)
+    if (!task_interrupted_.load(std::memory_order_relaxed) && task_)
     {
-      task_interrupted_ = true;
+      task_interrupted_.store(true, std::memory_order_relaxed);
       task_->interrupt();
     }
     lock.unlock();
@@ -24,6 +24,10 @@
 #include "asio/detail/static_mutex.hpp"
 #include "asio/detail/throw_exception.hpp"
 
+#if defined(ASIO_HAS_SIGNALFD)
+# include <sys/signalfd.h>
+#endif // defined(ASIO_HAS_SIGNALFD)
+
 #if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 # include "asio/detail/io_uring_service.hpp"
 #else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
@@ -47,6 +51,13 @@ struct signal_state
   // The write end of the pipe used for signal notifications.
   int write_descriptor_;
 
+#if defined(ASIO_HAS_SIGNALFD)
+  // The signalfd descriptor used for notifications of signals that are blocked
+  // in every thread. Signals that are delivered to a thread where they are not
+  // blocked are still written to the pipe by the signal handler.
+  int signalfd_descriptor_;
+#endif // defined(ASIO_HAS_SIGNALFD)
+
   // Whether the signal state has been prepared for a fork.
   bool fork_prepared_;
 
@@ -58,13 +69,26 @@ struct signal_state
 
   // The flags used for each registered signal.
   signal_set_base::flags_t flags_[max_signal_number];
+
+#if defined(ASIO_HAS_SIGNALFD)
+  // Whether each signal was blocked by the service, rather than having already
+  // been blocked by the application when it was first registered.
+  bool blocked_by_service_[max_signal_number];
+#endif // defined(ASIO_HAS_SIGNALFD)
 };
 
 signal_state* get_signal_state()
 {
   static signal_state state = {
-    ASIO_STATIC_MUTEX_INIT, -1, -1, false, 0,
-    { 0 }, { signal_set_base::flags_t() } };
+    ASIO_STATIC_MUTEX_INIT, -1, -1,
+#if defined(ASIO_HAS_SIGNALFD)
+    -1,
+#endif // defined(ASIO_HAS_SIGNALFD)
+    false, 0, { 0 }, { signal_set_base::flags_t() },
+#if defined(ASIO_HAS_SIGNALFD)
+    { false },
+#endif // defined(ASIO_HAS_SIGNALFD)
+  };
   return &state;
 }
 
@@ -104,8 +128,9 @@ class signal_set_service::pipe_read_op :
 {
 public:
 # if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
-  pipe_read_op()
-    : io_uring_operation(asio::error_code(), &pipe_read_op::do_prepare,
+  explicit pipe_read_op(
+      prepare_func_type prepare_func = &pipe_read_op::do_prepare)
+    : io_uring_operation(asio::error_code(), prepare_func,
         &pipe_read_op::do_perform, pipe_read_op::do_complete)
   {
   }
@@ -118,16 +143,19 @@ public:
     ::io_uring_prep_poll_add(sqe, fd, POLLIN);
   }
 
-  static bool do_perform(io_uring_operation*, bool)
+#  if defined(ASIO_HAS_SIGNALFD)
+  static void do_prepare_signalfd(io_uring_operation*, ::io_uring_sqe* sqe)
   {
     signal_state* state = get_signal_state();
 
-    int fd = state->read_descriptor_;
-    int signal_number = 0;
-    while (::read(fd, &signal_number, sizeof(int)) == sizeof(int))
-      if (signal_number >= 0 && signal_number < max_signal_number)
-        signal_set_service::deliver_signal(signal_number);
+    int fd = state->signalfd_descriptor_;
+    ::io_uring_prep_poll_add(sqe, fd, POLLIN);
+  }
+#  endif // defined(ASIO_HAS_SIGNALFD)
 
+  static bool do_perform(io_uring_operation*, bool)
+  {
+    read_signals();
     return false;
   }
 # else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
@@ -138,6 +166,13 @@ public:
   }
 
   static status do_perform(reactor_op*)
+  {
+    read_signals();
+    return not_done;
+  }
+# endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+
+  static void read_signals()
   {
     signal_state* state = get_signal_state();
 
@@ -147,9 +182,23 @@ public:
       if (signal_number >= 0 && signal_number < max_signal_number)
         signal_set_service::deliver_signal(signal_number);
 
-    return not_done;
+# if defined(ASIO_HAS_SIGNALFD)
+    // Each read drains as many pending signals as fit in the buffer.
+    signalfd_siginfo info[16];
+    signed_size_type bytes = 0;
+    while ((bytes = ::read(state->signalfd_descriptor_,
+            info, sizeof(info))) > 0)
+    {
+      std::size_t count = static_cast<std::size_t>(bytes) / sizeof(info[0]);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        signal_number = static_cast<int>(info[i].ssi_signo);
+        if (signal_number >= 0 && signal_number < max_signal_number)
+          signal_set_service::deliver_signal(signal_number);
+      }
+    }
+# endif // defined(ASIO_HAS_SIGNALFD)
   }
-# endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 
   static void do_complete(void* /*owner*/, operation* base,
       const asio::error_code& /*ec*/,
@@ -237,15 +286,28 @@ void signal_set_service::notify_fork(execution_context::fork_event fork_ev)
   case execution_context::fork_prepare:
     {
       int read_descriptor = state->read_descriptor_;
+# if defined(ASIO_HAS_SIGNALFD)
+      int signalfd_descriptor = state->signalfd_descriptor_;
+# endif // defined(ASIO_HAS_SIGNALFD)
       state->fork_prepared_ = true;
       lock.unlock();
 # if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
       (void)read_descriptor;
       io_uring_service_.deregister_io_object(io_object_data_);
       io_uring_service_.cleanup_io_object(io_object_data_);
+#  if defined(ASIO_HAS_SIGNALFD)
+      (void)signalfd_descriptor;
+      io_uring_service_.deregister_io_object(signalfd_io_object_data_);
+      io_uring_service_.cleanup_io_object(signalfd_io_object_data_);
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
       reactor_.deregister_internal_descriptor(read_descriptor, reactor_data_);
       reactor_.cleanup_descriptor_data(reactor_data_);
+#  if defined(ASIO_HAS_SIGNALFD)
+      reactor_.deregister_internal_descriptor(
+          signalfd_descriptor, signalfd_reactor_data_);
+      reactor_.cleanup_descriptor_data(signalfd_reactor_data_);
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
     }
     break;
@@ -253,15 +315,28 @@ void signal_set_service::notify_fork(execution_context::fork_event fork_ev)
     if (state->fork_prepared_)
     {
       int read_descriptor = state->read_descriptor_;
+# if defined(ASIO_HAS_SIGNALFD)
+      int signalfd_descriptor = state->signalfd_descriptor_;
+# endif // defined(ASIO_HAS_SIGNALFD)
       state->fork_prepared_ = false;
       lock.unlock();
 # if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
       (void)read_descriptor;
       io_uring_service_.register_internal_io_object(io_object_data_,
           io_uring_service::read_op, new pipe_read_op);
+#  if defined(ASIO_HAS_SIGNALFD)
+      (void)signalfd_descriptor;
+      io_uring_service_.register_internal_io_object(signalfd_io_object_data_,
+          io_uring_service::read_op,
+          new pipe_read_op(&pipe_read_op::do_prepare_signalfd));
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
       reactor_.register_internal_descriptor(reactor::read_op,
           read_descriptor, reactor_data_, new pipe_read_op);
+#  if defined(ASIO_HAS_SIGNALFD)
+      reactor_.register_internal_descriptor(reactor::read_op,
+          signalfd_descriptor, signalfd_reactor_data_, new pipe_read_op);
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
     }
     break;
@@ -272,15 +347,28 @@ void signal_set_service::notify_fork(execution_context::fork_event fork_ev)
       close_descriptors();
       open_descriptors();
       int read_descriptor = state->read_descriptor_;
+# if defined(ASIO_HAS_SIGNALFD)
+      int signalfd_descriptor = state->signalfd_descriptor_;
+# endif // defined(ASIO_HAS_SIGNALFD)
       state->fork_prepared_ = false;
       lock.unlock();
 # if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
       (void)read_descriptor;
       io_uring_service_.register_internal_io_object(io_object_data_,
           io_uring_service::read_op, new pipe_read_op);
+#  if defined(ASIO_HAS_SIGNALFD)
+      (void)signalfd_descriptor;
+      io_uring_service_.register_internal_io_object(signalfd_io_object_data_,
+          io_uring_service::read_op,
+          new pipe_read_op(&pipe_read_op::do_prepare_signalfd));
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
       reactor_.register_internal_descriptor(reactor::read_op,
           read_descriptor, reactor_data_, new pipe_read_op);
+#  if defined(ASIO_HAS_SIGNALFD)
+      reactor_.register_internal_descriptor(reactor::read_op,
+          signalfd_descriptor, signalfd_reactor_data_, new pipe_read_op);
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
     }
     break;
@@ -351,6 +439,13 @@ asio::error_code signal_set_service::add(
     // Register for the signal if we're the first.
     if (state->registration_count_[signal_number] == 0)
     {
+# if defined(ASIO_HAS_SIGNALFD)
+      if (update_signalfd(signal_number, true, ec))
+      {
+        delete new_registration;
+        return ec;
+      }
+# endif // defined(ASIO_HAS_SIGNALFD)
 # if defined(ASIO_HAS_SIGACTION)
       using namespace std; // For memset.
       struct sigaction sa;
@@ -371,6 +466,10 @@ asio::error_code signal_set_service::add(
         ec = asio::error_code(errno,
             asio::error::get_system_category());
 # endif // defined(ASIO_WINDOWS) || defined(ASIO_CYGWIN_W32_SOCKETS)
+# if defined(ASIO_HAS_SIGNALFD)
+        asio::error_code ignored_ec;
+        update_signalfd(signal_number, false, ignored_ec);
+# endif // defined(ASIO_HAS_SIGNALFD)
         delete new_registration;
         return ec;
       }
@@ -457,6 +556,12 @@ asio::error_code signal_set_service::remove(
     // Set signal handler back to the default if we're the last.
     if (state->registration_count_[signal_number] == 1)
     {
+# if defined(ASIO_HAS_SIGNALFD)
+      // Unblock the signal while the handler is still installed, so that a
+      // pending instance is consumed by the handler.
+      if (update_signalfd(signal_number, false, ec))
+        return ec;
+# endif // defined(ASIO_HAS_SIGNALFD)
 # if defined(ASIO_HAS_SIGACTION)
       using namespace std; // For memset.
       struct sigaction sa;
@@ -514,6 +619,12 @@ asio::error_code signal_set_service::clear(
     // Set signal handler back to the default if we're the last.
     if (state->registration_count_[reg->signal_number_] == 1)
     {
+# if defined(ASIO_HAS_SIGNALFD)
+      // Unblock the signal while the handler is still installed, so that a
+      // pending instance is consumed by the handler.
+      if (update_signalfd(reg->signal_number_, false, ec))
+        return ec;
+# endif // defined(ASIO_HAS_SIGNALFD)
 # if defined(ASIO_HAS_SIGACTION)
       using namespace std; // For memset.
       struct sigaction sa;
@@ -685,14 +796,28 @@ void signal_set_service::add_service(signal_set_service* service)
   && !defined(ASIO_CYGWIN_W32_SOCKETS)
   // Register for pipe readiness notifications.
   int read_descriptor = state->read_descriptor_;
+# if defined(ASIO_HAS_SIGNALFD)
+  int signalfd_descriptor = state->signalfd_descriptor_;
+# endif // defined(ASIO_HAS_SIGNALFD)
   lock.unlock();
 # if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
   (void)read_descriptor;
   service->io_uring_service_.register_internal_io_object(
       service->io_object_data_, io_uring_service::read_op, new pipe_read_op);
+#  if defined(ASIO_HAS_SIGNALFD)
+  (void)signalfd_descriptor;
+  service->io_uring_service_.register_internal_io_object(
+      service->signalfd_io_object_data_, io_uring_service::read_op,
+      new pipe_read_op(&pipe_read_op::do_prepare_signalfd));
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
   service->reactor_.register_internal_descriptor(reactor::read_op,
       read_descriptor, service->reactor_data_, new pipe_read_op);
+#  if defined(ASIO_HAS_SIGNALFD)
+  service->reactor_.register_internal_descriptor(reactor::read_op,
+      signalfd_descriptor, service->signalfd_reactor_data_,
+      new pipe_read_op);
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 #endif // !defined(ASIO_WINDOWS)
        //   && !defined(ASIO_WINDOWS_RUNTIME)
@@ -711,16 +836,32 @@ void signal_set_service::remove_service(signal_set_service* service)
   && !defined(ASIO_CYGWIN_W32_SOCKETS)
     // Disable the pipe readiness notifications.
     int read_descriptor = state->read_descriptor_;
+# if defined(ASIO_HAS_SIGNALFD)
+    int signalfd_descriptor = state->signalfd_descriptor_;
+# endif // defined(ASIO_HAS_SIGNALFD)
     lock.unlock();
 # if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
     (void)read_descriptor;
     service->io_uring_service_.deregister_io_object(service->io_object_data_);
     service->io_uring_service_.cleanup_io_object(service->io_object_data_);
+#  if defined(ASIO_HAS_SIGNALFD)
+    (void)signalfd_descriptor;
+    service->io_uring_service_.deregister_io_object(
+        service->signalfd_io_object_data_);
+    service->io_uring_service_.cleanup_io_object(
+        service->signalfd_io_object_data_);
+#  endif // defined(ASIO_HAS_SIGNALFD)
     lock.lock();
 # else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
     service->reactor_.deregister_internal_descriptor(
         read_descriptor, service->reactor_data_);
     service->reactor_.cleanup_descriptor_data(service->reactor_data_);
+#  if defined(ASIO_HAS_SIGNALFD)
+    service->reactor_.deregister_internal_descriptor(
+        signalfd_descriptor, service->signalfd_reactor_data_);
+    service->reactor_.cleanup_descriptor_data(
+        service->signalfd_reactor_data_);
+#  endif // defined(ASIO_HAS_SIGNALFD)
     lock.lock();
 # endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 #endif // !defined(ASIO_WINDOWS)
@@ -774,6 +915,26 @@ void signal_set_service::open_descriptors()
         asio::error::get_system_category());
     asio::detail::throw_error(ec, "signal_set_service pipe");
   }
+
+# if defined(ASIO_HAS_SIGNALFD)
+  sigset_t mask;
+  sigemptyset(&mask);
+  state->signalfd_descriptor_ =
+    ::signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+
+  // Accept any signals that are already registered, such as after a fork.
+  asio::error_code ec;
+  if (state->signalfd_descriptor_ == -1)
+  {
+    ec = asio::error_code(errno,
+        asio::error::get_system_category());
+  }
+  else
+  {
+    update_signalfd(0, false, ec);
+  }
+  asio::detail::throw_error(ec, "signal_set_service signalfd");
+# endif // defined(ASIO_HAS_SIGNALFD)
 #endif // !defined(ASIO_WINDOWS)
        //   && !defined(ASIO_WINDOWS_RUNTIME)
        //   && !defined(ASIO_CYGWIN_W32_SOCKETS)
@@ -793,11 +954,68 @@ void signal_set_service::close_descriptors()
   if (state->write_descriptor_ != -1)
     ::close(state->write_descriptor_);
   state->write_descriptor_ = -1;
+
+# if defined(ASIO_HAS_SIGNALFD)
+  if (state->signalfd_descriptor_ != -1)
+    ::close(state->signalfd_descriptor_);
+  state->signalfd_descriptor_ = -1;
+# endif // defined(ASIO_HAS_SIGNALFD)
 #endif // !defined(ASIO_WINDOWS)
        //   && !defined(ASIO_WINDOWS_RUNTIME)
        //   && !defined(ASIO_CYGWIN_W32_SOCKETS)
 }
 
+#if defined(ASIO_HAS_SIGNALFD)
+asio::error_code signal_set_service::update_signalfd(
+    int signal_number, bool add, asio::error_code& ec)
+{
+  signal_state* state = get_signal_state();
+
+  sigset_t mask;
+  sigemptyset(&mask);
+  for (int i = 1; i < max_signal_number; ++i)
+    if (state->registration_count_[i] > 0 && i != signal_number)
+      sigaddset(&mask, i);
+  if (add)
+    sigaddset(&mask, signal_number);
+
+  if (::signalfd(state->signalfd_descriptor_, &mask, 0) == -1)
+  {
+    ec = asio::error_code(errno,
+        asio::error::get_system_category());
+    return ec;
+  }
+
+  // The signal must be blocked to be received through the signalfd descriptor.
+  // This blocks it in the calling thread only. Threads where it is not blocked
+  // receive it through the signal handler and the pipe instead. When a signal
+  // is removed, it is unblocked again only if it was the service that blocked
+  // it, so that a mask established by the application is left in place.
+  if (signal_number > 0)
+  {
+    sigset_t changed;
+    sigemptyset(&changed);
+    sigaddset(&changed, signal_number);
+    if (add)
+    {
+      sigset_t previous;
+      sigemptyset(&previous);
+      ::pthread_sigmask(SIG_BLOCK, &changed, &previous);
+      state->blocked_by_service_[signal_number]
+        = !sigismember(&previous, signal_number);
+    }
+    else if (state->blocked_by_service_[signal_number])
+    {
+      ::pthread_sigmask(SIG_UNBLOCK, &changed, 0);
+      state->blocked_by_service_[signal_number] = false;
+    }
+  }
+
+  ec = asio::error_code();
+  return ec;
+}
+#endif // defined(ASIO_HAS_SIGNALFD)
+
 void signal_set_service::start_wait_op(
     signal_set_service::implementation_type& impl, signal_op* op)
 {
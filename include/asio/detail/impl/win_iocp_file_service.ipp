@@ -116,6 +116,8 @@ asio::error_code win_iocp_file_service::open(
     flags |= FILE_FLAG_RANDOM_ACCESS;
   if ((open_flags & file_base::sync_all_on_write) != 0)
     flags |= FILE_FLAG_WRITE_THROUGH;
+  if ((open_flags & file_base::direct) != 0)
+    flags |= FILE_FLAG_NO_BUFFERING;
 
   impl.offset_ = 0;
   HANDLE handle = ::CreateFileW(wide_path.get(),
@@ -191,6 +193,33 @@ uint64_t win_iocp_file_service::size(
   }
 }
 
+std::size_t win_iocp_file_service::alignment(
+    const win_iocp_file_service::implementation_type& impl,
+    asio::error_code& ec) const
+{
+#if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+  FILE_STORAGE_INFO info;
+  if (::GetFileInformationByHandleEx(native_handle(impl),
+        FileStorageInfo, &info, sizeof(info)))
+  {
+    asio::error::clear(ec);
+    return info.PhysicalBytesPerSectorForPerformance;
+  }
+  else
+  {
+    DWORD last_error = ::GetLastError();
+    ec.assign(last_error, asio::error::get_system_category());
+    ASIO_ERROR_LOCATION(ec);
+    return 0;
+  }
+#else // defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+  (void)impl;
+  ec = asio::error::operation_not_supported;
+  ASIO_ERROR_LOCATION(ec);
+  return 0;
+#endif // defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+}
+
 asio::error_code win_iocp_file_service::resize(
     win_iocp_file_service::implementation_type& impl,
     uint64_t n, asio::error_code& ec)
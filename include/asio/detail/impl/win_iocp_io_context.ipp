@@ -89,7 +89,9 @@ win_iocp_io_context::win_iocp_io_context(
     shutdown_(0),
     gqcs_timeout_(get_gqcs_timeout()),
     dispatch_required_(0),
-    concurrency_hint_(config(ctx).get("scheduler", "concurrency_hint", -1))
+    concurrency_hint_(config(ctx).get("scheduler", "concurrency_hint", -1)),
+    memory_limit_(config(ctx).get("scheduler", "recycling_memory_limit",
+          static_cast<std::size_t>(ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT)))
 {
   ASIO_HANDLER_TRACKING_INIT;
 
@@ -121,7 +123,8 @@ win_iocp_io_context::win_iocp_io_context(
     shutdown_(0),
     gqcs_timeout_(get_gqcs_timeout()),
     dispatch_required_(0),
-    concurrency_hint_(-1)
+    concurrency_hint_(-1),
+    memory_limit_(ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT)
 {
   ASIO_HANDLER_TRACKING_INIT;
 
@@ -222,6 +225,7 @@ size_t win_iocp_io_context::run(asio::error_code& ec)
   }
 
   win_iocp_thread_info this_thread;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   size_t n = 0;
@@ -241,6 +245,7 @@ size_t win_iocp_io_context::run_one(asio::error_code& ec)
   }
 
   win_iocp_thread_info this_thread;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   return do_one(INFINITE, this_thread, ec);
@@ -256,6 +261,7 @@ size_t win_iocp_io_context::wait_one(long usec, asio::error_code& ec)
   }
 
   win_iocp_thread_info this_thread;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   return do_one(usec < 0 ? INFINITE : ((usec - 1) / 1000 + 1), this_thread, ec);
@@ -271,6 +277,7 @@ size_t win_iocp_io_context::poll(asio::error_code& ec)
   }
 
   win_iocp_thread_info this_thread;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   size_t n = 0;
@@ -290,6 +297,7 @@ size_t win_iocp_io_context::poll_one(asio::error_code& ec)
   }
 
   win_iocp_thread_info this_thread;
+  this_thread.set_memory_limit(memory_limit_);
   thread_call_stack::context ctx(this, this_thread);
 
   return do_one(0, this_thread, ec);
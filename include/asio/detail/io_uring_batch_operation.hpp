@@ -0,0 +1,127 @@
+//
+// detail/io_uring_batch_operation.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_BATCH_OPERATION_HPP
+#define ASIO_DETAIL_IO_URING_BATCH_OPERATION_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING)
+
+#include <vector>
+#include "asio/detail/io_uring_operation.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+class io_uring_service;
+
+// An operation that is made up of a number of independent submission queue
+// entries. All entries are submitted together and the operation is performed
+// once the last of them has completed.
+class io_uring_batch_operation
+  : public io_uring_operation
+{
+public:
+  // The state associated with a single submission queue entry. The address of
+  // the entry, tagged with entry_tag, is used as the entry's user data.
+  struct entry
+  {
+    io_uring_batch_operation* batch_;
+    int result_;
+  };
+
+  // The tag used to distinguish batch entries from I/O queues in the user
+  // data of a completion queue entry.
+  enum { entry_tag = 1 };
+
+  // Get the number of entries in the batch.
+  std::size_t size() const
+  {
+    return entries_.size();
+  }
+
+  // Prepare a single entry.
+  void prepare_entry(std::size_t index, ::io_uring_sqe* sqe)
+  {
+    prepare_entry_func_(this, index, sqe);
+  }
+
+  // Get the result of a single entry, as returned by the kernel.
+  int entry_result(std::size_t index) const
+  {
+    return entries_[index].result_;
+  }
+
+  // Get the user data used to identify a single entry.
+  void* entry_user_data(std::size_t index)
+  {
+    return reinterpret_cast<void*>(
+        reinterpret_cast<uintptr_t>(&entries_[index]) | entry_tag);
+  }
+
+protected:
+  typedef void (*prepare_entry_func_type)(
+      io_uring_batch_operation*, std::size_t, ::io_uring_sqe*);
+
+  io_uring_batch_operation(const asio::error_code& success_ec,
+      std::size_t size, prepare_entry_func_type prepare_entry_func,
+      perform_func_type perform_func, func_type complete_func)
+    : io_uring_operation(success_ec, &io_uring_batch_operation::do_prepare,
+        perform_func, complete_func),
+      entries_(size),
+      remaining_(0),
+      io_queue_(0),
+      prepare_entry_func_(prepare_entry_func)
+  {
+    is_batch_ = true;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      entries_[i].batch_ = this;
+      entries_[i].result_ = 0;
+    }
+  }
+
+private:
+  friend class io_uring_service;
+
+  // Batches are prepared one entry at a time by the io_uring_service.
+  static void do_prepare(io_uring_operation*, ::io_uring_sqe*)
+  {
+  }
+
+  std::vector<entry> entries_;
+
+  // The number of submitted entries that are yet to complete. Only accessed
+  // by the io_uring_service.
+  std::size_t remaining_;
+
+  // The I/O queue to be performed when the last entry completes.
+  void* io_queue_;
+
+  prepare_entry_func_type prepare_entry_func_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING)
+
+#endif // ASIO_DETAIL_IO_URING_BATCH_OPERATION_HPP
@@ -0,0 +1,198 @@
+//
+// detail/io_uring_descriptor_batch_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_DESCRIPTOR_BATCH_OP_HPP
+#define ASIO_DETAIL_IO_URING_DESCRIPTOR_BATCH_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING)
+
+#include "asio/buffer.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/io_uring_batch_operation.hpp"
+#include "asio/detail/memory.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// Performs a batch of reads or writes at explicit offsets. Each request must
+// provide offset(), buffer() and set_result(). Requests with a mutable buffer
+// are reads, and requests with a const buffer are writes.
+template <typename Request>
+class io_uring_descriptor_batch_op_base : public io_uring_batch_operation
+{
+public:
+  io_uring_descriptor_batch_op_base(
+      const asio::error_code& success_ec, int descriptor,
+      Request* requests, std::size_t count, func_type complete_func)
+    : io_uring_batch_operation(success_ec, count,
+        &io_uring_descriptor_batch_op_base::do_prepare_entry,
+        &io_uring_descriptor_batch_op_base::do_perform, complete_func),
+      descriptor_(descriptor),
+      requests_(requests)
+  {
+  }
+
+  static void do_prepare_entry(io_uring_batch_operation* base,
+      std::size_t index, ::io_uring_sqe* sqe)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_descriptor_batch_op_base* o(
+        static_cast<io_uring_descriptor_batch_op_base*>(base));
+
+    prepare(sqe, o->descriptor_,
+        o->requests_[index].buffer(), o->requests_[index].offset());
+  }
+
+  static bool do_perform(io_uring_operation* base, bool after_completion)
+  {
+    ASIO_ASSUME(base != 0);
+    io_uring_descriptor_batch_op_base* o(
+        static_cast<io_uring_descriptor_batch_op_base*>(base));
+
+    if (!after_completion)
+      return false;
+
+    // The batch reports the error of the first request that failed, if any,
+    // and the total number of bytes transferred.
+    o->bytes_transferred_ = 0;
+    for (std::size_t i = 0; i < o->size(); ++i)
+    {
+      asio::error_code ec;
+      std::size_t bytes_transferred = 0;
+      int result = o->entry_result(i);
+      if (result < 0)
+        ec.assign(-result, asio::error::get_system_category());
+      else if (result == 0 && is_read(o->requests_[i].buffer())
+          && o->requests_[i].buffer().size() != 0)
+        ec = asio::error::eof;
+      else
+        bytes_transferred = static_cast<std::size_t>(result);
+
+      o->requests_[i].set_result(ec, bytes_transferred);
+      o->bytes_transferred_ += bytes_transferred;
+      if (ec && !o->ec_)
+        o->ec_ = ec;
+    }
+
+    return true;
+  }
+
+private:
+  static void prepare(::io_uring_sqe* sqe, int descriptor,
+      const asio::mutable_buffer& buffer, uint64_t offset)
+  {
+    ::io_uring_prep_read(sqe, descriptor, buffer.data(),
+        static_cast<unsigned>(buffer.size()), offset);
+  }
+
+  static void prepare(::io_uring_sqe* sqe, int descriptor,
+      const asio::const_buffer& buffer, uint64_t offset)
+  {
+    ::io_uring_prep_write(sqe, descriptor, buffer.data(),
+        static_cast<unsigned>(buffer.size()), offset);
+  }
+
+  static bool is_read(const asio::mutable_buffer&)
+  {
+    return true;
+  }
+
+  static bool is_read(const asio::const_buffer&)
+  {
+    return false;
+  }
+
+  int descriptor_;
+  Request* requests_;
+};
+
+template <typename Request, typename Handler, typename IoExecutor>
+class io_uring_descriptor_batch_op
+  : public io_uring_descriptor_batch_op_base<Request>
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(io_uring_descriptor_batch_op);
+
+  io_uring_descriptor_batch_op(const asio::error_code& success_ec,
+      int descriptor, Request* requests, std::size_t count,
+      Handler& handler, const IoExecutor& io_ex)
+    : io_uring_descriptor_batch_op_base<Request>(success_ec,
+        descriptor, requests, count,
+        &io_uring_descriptor_batch_op::do_complete),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    io_uring_descriptor_batch_op* o
+      (static_cast<io_uring_descriptor_batch_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING)
+
+#endif // ASIO_DETAIL_IO_URING_DESCRIPTOR_BATCH_OP_HPP
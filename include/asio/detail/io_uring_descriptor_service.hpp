@@ -25,6 +25,7 @@
 #include "asio/execution_context.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/detail/descriptor_ops.hpp"
+#include "asio/detail/io_uring_descriptor_batch_op.hpp"
 #include "asio/detail/io_uring_descriptor_read_at_op.hpp"
 #include "asio/detail/io_uring_descriptor_read_op.hpp"
 #include "asio/detail/io_uring_descriptor_write_at_op.hpp"
@@ -633,6 +634,42 @@ public:
     return async_read_some(impl, buffers, handler, io_ex);
   }
 
+  // Start an asynchronous batch of reads or writes at the specified offsets.
+  // The requests are submitted together and may complete in any order. The
+  // requests must be valid for the lifetime of the asynchronous operation.
+  template <typename Request, typename Handler, typename IoExecutor>
+  void async_batch_at(implementation_type& impl, int op_type,
+      Request* requests, std::size_t count,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      ASIO_VERSIONED_NAME(handler_cont_helpers)::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_descriptor_batch_op<Request, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.descriptor_,
+        requests, count, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, op_type);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "descriptor", &impl, impl.descriptor_, "async_batch_at"));
+
+    start_op(impl, op_type, p.p, is_continuation, count == 0);
+    p.v = p.p = 0;
+  }
+
 private:
   // Start the asynchronous operation.
   ASIO_DECL void start_op(implementation_type& impl, int op_type,
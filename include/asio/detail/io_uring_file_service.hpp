@@ -23,10 +23,14 @@
 #include <string>
 #include "asio/detail/cstdint.hpp"
 #include "asio/detail/descriptor_ops.hpp"
+#include "asio/detail/file_read_ahead.hpp"
+#include "asio/detail/file_read_ahead_op.hpp"
 #include "asio/detail/io_uring_descriptor_service.hpp"
+#include "asio/detail/memory.hpp"
 #include "asio/error.hpp"
 #include "asio/execution_context.hpp"
 #include "asio/file_base.hpp"
+#include "asio/file_request.hpp"
 
 #include "asio/detail/push_options.hpp"
 
@@ -52,6 +56,22 @@ public:
     friend class io_uring_file_service;
 
     bool is_stream_;
+    std::size_t read_ahead_depth_;
+    std::size_t read_ahead_chunk_size_;
+    shared_ptr<file_read_ahead> read_ahead_;
+
+    // Descriptors for the same file, one per read-ahead chunk. Each has its
+    // own operation queue, so that the chunk reads are in flight concurrently.
+    descriptor_service::implementation_type* read_ahead_impls_;
+
+    // The alignment required for direct I/O, or zero if the file was not
+    // opened for direct I/O.
+    std::size_t direct_memory_alignment_;
+    std::size_t direct_offset_alignment_;
+
+    // A descriptor for the same file that does not bypass the page cache, used
+    // to perform requests that do not meet the direct I/O alignment.
+    descriptor_service::implementation_type buffered_;
   };
 
   ASIO_DECL io_uring_file_service(execution_context& context);
@@ -63,7 +83,13 @@ public:
   void construct(implementation_type& impl)
   {
     descriptor_service_.construct(impl);
+    descriptor_service_.construct(impl.buffered_);
     impl.is_stream_ = false;
+    impl.read_ahead_depth_ = 0;
+    impl.read_ahead_chunk_size_ = 0;
+    impl.read_ahead_impls_ = 0;
+    impl.direct_memory_alignment_ = 0;
+    impl.direct_offset_alignment_ = 0;
   }
 
   // Move-construct a new file implementation.
@@ -71,7 +97,16 @@ public:
       implementation_type& other_impl)
   {
     descriptor_service_.move_construct(impl, other_impl);
+    descriptor_service_.move_construct(impl.buffered_, other_impl.buffered_);
     impl.is_stream_ = other_impl.is_stream_;
+    impl.read_ahead_depth_ = other_impl.read_ahead_depth_;
+    impl.read_ahead_chunk_size_ = other_impl.read_ahead_chunk_size_;
+    impl.read_ahead_ = static_cast<shared_ptr<file_read_ahead>&&>(
+        other_impl.read_ahead_);
+    impl.read_ahead_impls_ = other_impl.read_ahead_impls_;
+    other_impl.read_ahead_impls_ = 0;
+    impl.direct_memory_alignment_ = other_impl.direct_memory_alignment_;
+    impl.direct_offset_alignment_ = other_impl.direct_offset_alignment_;
   }
 
   // Move-assign from another file implementation.
@@ -79,14 +114,28 @@ public:
       io_uring_file_service& other_service,
       implementation_type& other_impl)
   {
+    release_read_ahead_impls(impl);
     descriptor_service_.move_assign(impl,
         other_service.descriptor_service_, other_impl);
+    descriptor_service_.move_assign(impl.buffered_,
+        other_service.descriptor_service_, other_impl.buffered_);
     impl.is_stream_ = other_impl.is_stream_;
+    impl.read_ahead_depth_ = other_impl.read_ahead_depth_;
+    impl.read_ahead_chunk_size_ = other_impl.read_ahead_chunk_size_;
+    impl.read_ahead_ = static_cast<shared_ptr<file_read_ahead>&&>(
+        other_impl.read_ahead_);
+    impl.read_ahead_impls_ = other_impl.read_ahead_impls_;
+    other_impl.read_ahead_impls_ = 0;
+    impl.direct_memory_alignment_ = other_impl.direct_memory_alignment_;
+    impl.direct_offset_alignment_ = other_impl.direct_offset_alignment_;
   }
 
   // Destroy a file implementation.
   void destroy(implementation_type& impl)
   {
+    impl.read_ahead_.reset();
+    release_read_ahead_impls(impl);
+    descriptor_service_.destroy(impl.buffered_);
     descriptor_service_.destroy(impl);
   }
 
@@ -100,6 +149,7 @@ public:
       const native_handle_type& native_descriptor,
       asio::error_code& ec)
   {
+    impl.read_ahead_.reset();
     return descriptor_service_.assign(impl, native_descriptor, ec);
   }
 
@@ -119,6 +169,9 @@ public:
   asio::error_code close(implementation_type& impl,
       asio::error_code& ec)
   {
+    impl.read_ahead_.reset();
+    release_read_ahead_impls(impl);
+    close_buffered(impl);
     return descriptor_service_.close(impl, ec);
   }
 
@@ -132,6 +185,9 @@ public:
   native_handle_type release(implementation_type& impl,
       asio::error_code& ec)
   {
+    discard_read_ahead(impl);
+    release_read_ahead_impls(impl);
+    close_buffered(impl);
     return descriptor_service_.release(impl, ec);
   }
 
@@ -139,6 +195,9 @@ public:
   asio::error_code cancel(implementation_type& impl,
       asio::error_code& ec)
   {
+    cancel_read_ahead_impls(impl);
+    if (descriptor_service_.is_open(impl.buffered_))
+      descriptor_service_.cancel(impl.buffered_, ec);
     return descriptor_service_.cancel(impl, ec);
   }
 
@@ -146,6 +205,10 @@ public:
   ASIO_DECL uint64_t size(const implementation_type& impl,
       asio::error_code& ec) const;
 
+  // Get the alignment required for direct I/O.
+  ASIO_DECL std::size_t alignment(const implementation_type& impl,
+      asio::error_code& ec) const;
+
   // Alter the size of the file.
   ASIO_DECL asio::error_code resize(implementation_type& impl,
       uint64_t n, asio::error_code& ec);
@@ -158,6 +221,10 @@ public:
   ASIO_DECL asio::error_code sync_data(implementation_type& impl,
       asio::error_code& ec);
 
+  // Set the read-ahead used for stream reads.
+  ASIO_DECL asio::error_code set_read_ahead(implementation_type& impl,
+      std::size_t depth, std::size_t chunk_size, asio::error_code& ec);
+
   // Seek to a position in the file.
   ASIO_DECL uint64_t seek(implementation_type& impl, int64_t offset,
       file_base::seek_basis whence, asio::error_code& ec);
@@ -167,6 +234,7 @@ public:
   size_t write_some(implementation_type& impl,
       const ConstBufferSequence& buffers, asio::error_code& ec)
   {
+    discard_read_ahead(impl);
     return descriptor_service_.write_some(impl, buffers, ec);
   }
 
@@ -177,6 +245,7 @@ public:
       const ConstBufferSequence& buffers,
       Handler& handler, const IoExecutor& io_ex)
   {
+    discard_read_ahead(impl);
     descriptor_service_.async_write_some(impl, buffers, handler, io_ex);
   }
 
@@ -186,7 +255,8 @@ public:
   size_t write_some_at(implementation_type& impl, uint64_t offset,
       const ConstBufferSequence& buffers, asio::error_code& ec)
   {
-    return descriptor_service_.write_some_at(impl, offset, buffers, ec);
+    return descriptor_service_.write_some_at(
+        impl_for(impl, offset, buffers), offset, buffers, ec);
   }
 
   // Start an asynchronous write at the specified location. The data being
@@ -197,7 +267,7 @@ public:
       Handler& handler, const IoExecutor& io_ex)
   {
     descriptor_service_.async_write_some_at(
-        impl, offset, buffers, handler, io_ex);
+        impl_for(impl, offset, buffers), offset, buffers, handler, io_ex);
   }
 
   // Read some data. Returns the number of bytes read.
@@ -205,6 +275,7 @@ public:
   size_t read_some(implementation_type& impl,
       const MutableBufferSequence& buffers, asio::error_code& ec)
   {
+    discard_read_ahead(impl);
     return descriptor_service_.read_some(impl, buffers, ec);
   }
 
@@ -216,7 +287,10 @@ public:
       const MutableBufferSequence& buffers,
       Handler& handler, const IoExecutor& io_ex)
   {
-    descriptor_service_.async_read_some(impl, buffers, handler, io_ex);
+    if (impl.read_ahead_depth_ > 0)
+      async_read_some_ahead(impl, buffers, handler, io_ex);
+    else
+      descriptor_service_.async_read_some(impl, buffers, handler, io_ex);
   }
 
   // Read some data. Returns the number of bytes read.
@@ -224,7 +298,8 @@ public:
   size_t read_some_at(implementation_type& impl, uint64_t offset,
       const MutableBufferSequence& buffers, asio::error_code& ec)
   {
-    return descriptor_service_.read_some_at(impl, offset, buffers, ec);
+    return descriptor_service_.read_some_at(
+        impl_for(impl, offset, buffers), offset, buffers, ec);
   }
 
   // Start an asynchronous read. The buffer for the data being read must be
@@ -236,10 +311,242 @@ public:
       Handler& handler, const IoExecutor& io_ex)
   {
     descriptor_service_.async_read_some_at(
-        impl, offset, buffers, handler, io_ex);
+        impl_for(impl, offset, buffers), offset, buffers, handler, io_ex);
+  }
+
+  // Perform a batch of reads or writes. Returns the total number of bytes
+  // transferred, and sets ec to the error of the first request that failed.
+  template <typename Buffer>
+  size_t batch_at(implementation_type& impl,
+      basic_file_request<Buffer>* requests, std::size_t count,
+      asio::error_code& ec)
+  {
+    ec = asio::error_code();
+    size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      asio::error_code request_ec;
+      size_t n = batch_request_at(impl, requests[i].offset(),
+          requests[i].buffer(), request_ec);
+      requests[i].set_result(request_ec, n);
+      total += n;
+      if (request_ec && !ec)
+        ec = request_ec;
+    }
+    return total;
+  }
+
+  // Start an asynchronous batch of reads or writes. The requests are submitted
+  // to the io_uring together and performed concurrently.
+  template <typename Buffer, typename Handler, typename IoExecutor>
+  void async_batch_at(implementation_type& impl,
+      basic_file_request<Buffer>* requests, std::size_t count,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    descriptor_service_.async_batch_at(impl, batch_op_type(Buffer()),
+        requests, count, handler, io_ex);
   }
 
 private:
+  // Helper function to select the descriptor used for a request. Requests that
+  // do not meet the direct I/O alignment are performed using the buffered
+  // descriptor, if one is available.
+  template <typename BufferSequence>
+  descriptor_service::implementation_type& impl_for(
+      implementation_type& impl, uint64_t offset,
+      const BufferSequence& buffers)
+  {
+    if (impl.direct_offset_alignment_ == 0
+        || !descriptor_service_.is_open(impl.buffered_))
+      return impl;
+
+    if (offset % impl.direct_offset_alignment_ != 0)
+      return impl.buffered_;
+
+    for (auto iter = asio::buffer_sequence_begin(buffers),
+        end = asio::buffer_sequence_end(buffers); iter != end; ++iter)
+    {
+      const std::size_t address = reinterpret_cast<std::size_t>(
+          static_cast<const void*>(asio::const_buffer(*iter).data()));
+      if (address % impl.direct_memory_alignment_ != 0
+          || asio::const_buffer(*iter).size()
+            % impl.direct_offset_alignment_ != 0)
+        return impl.buffered_;
+    }
+
+    return impl;
+  }
+
+  // Helper function to open the buffered descriptor for a direct file.
+  ASIO_DECL void open_buffered(implementation_type& impl);
+
+  // Helper function to close the buffered descriptor, if open.
+  void close_buffered(implementation_type& impl)
+  {
+    if (descriptor_service_.is_open(impl.buffered_))
+    {
+      asio::error_code ignored_ec;
+      descriptor_service_.close(impl.buffered_, ignored_ec);
+    }
+    impl.direct_memory_alignment_ = 0;
+    impl.direct_offset_alignment_ = 0;
+  }
+
+  // Helper functions to select the synchronous operation for a request.
+  size_t batch_request_at(implementation_type& impl, uint64_t offset,
+      const asio::mutable_buffer& buffer, asio::error_code& ec)
+  {
+    return read_some_at(impl, offset, buffer, ec);
+  }
+
+  size_t batch_request_at(implementation_type& impl, uint64_t offset,
+      const asio::const_buffer& buffer, asio::error_code& ec)
+  {
+    return write_some_at(impl, offset, buffer, ec);
+  }
+
+  // Helper functions to select the operation queue for a batch.
+  static int batch_op_type(const asio::mutable_buffer&)
+  {
+    return io_uring_service::read_op;
+  }
+
+  static int batch_op_type(const asio::const_buffer&)
+  {
+    return io_uring_service::write_op;
+  }
+
+  // Start an asynchronous read that is satisfied from read-ahead data.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_read_some_ahead(implementation_type& impl,
+      const MutableBufferSequence& buffers,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      ASIO_VERSIONED_NAME(handler_cont_helpers)::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef file_read_ahead_op<MutableBufferSequence, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(buffers, handler, io_ex);
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p, "file",
+          &impl, native_handle(impl), "async_read_some"));
+
+    if (p.p->buffer_.size() > 0 && start_read_ahead(impl, p.p->ec_))
+    {
+      file_read_ahead::fill(impl.read_ahead_,
+          chunk_starter<IoExecutor>(descriptor_service_,
+            impl.read_ahead_impls_, io_ex));
+
+      // Optionally register for per-operation cancellation.
+      if (slot.is_connected())
+      {
+        slot.template emplace<read_ahead_cancellation>(
+            &io_uring_service_, impl.read_ahead_, p.p);
+      }
+
+      if (!impl.read_ahead_->complete_or_wait(p.p))
+      {
+        p.v = p.p = 0;
+        return;
+      }
+    }
+
+    op::do_immediate(p.p, is_continuation, &io_ex);
+    p.v = p.p = 0;
+  }
+
+  // Function object used to start a read into a read-ahead chunk. Each chunk
+  // is read using its own descriptor, so that the reads are not serialised
+  // behind one another in a single operation queue.
+  template <typename IoExecutor>
+  class chunk_starter
+  {
+  public:
+    chunk_starter(descriptor_service& service,
+        descriptor_service::implementation_type* impls,
+        const IoExecutor& io_ex)
+      : service_(service),
+        impls_(impls),
+        io_ex_(io_ex)
+    {
+    }
+
+    void operator()(std::size_t index, uint64_t offset,
+        const asio::mutable_buffer& buffer,
+        file_read_ahead::chunk_handler handler)
+    {
+      service_.async_read_some_at(impls_[index],
+          offset, buffer, handler, io_ex_);
+    }
+
+  private:
+    descriptor_service& service_;
+    descriptor_service::implementation_type* impls_;
+    const IoExecutor& io_ex_;
+  };
+
+  // Helper class used to implement per-operation cancellation of reads that
+  // are waiting for read-ahead data.
+  class read_ahead_cancellation
+  {
+  public:
+    read_ahead_cancellation(io_uring_service* s,
+        const shared_ptr<file_read_ahead>& r, file_read_ahead::waiter* w)
+      : io_uring_service_(s),
+        read_ahead_(r),
+        waiter_(w)
+    {
+    }
+
+    void operator()(cancellation_type_t type)
+    {
+      if (!!(type &
+            (cancellation_type::terminal
+              | cancellation_type::partial
+              | cancellation_type::total)))
+      {
+        if (shared_ptr<file_read_ahead> r = read_ahead_.lock())
+        {
+          if (file_read_ahead::waiter* w = r->take_waiter(waiter_))
+          {
+            w->ec_ = asio::error::operation_aborted;
+            io_uring_service_->post_immediate_completion(w, false);
+          }
+        }
+      }
+    }
+
+  private:
+    io_uring_service* io_uring_service_;
+    weak_ptr<file_read_ahead> read_ahead_;
+    file_read_ahead::waiter* waiter_;
+  };
+
+  // Create the read-ahead state, if required, at the current file position.
+  ASIO_DECL bool start_read_ahead(implementation_type& impl,
+      asio::error_code& ec);
+
+  // Discard any read-ahead state, moving the file position to the next byte
+  // that would have been delivered by a stream read.
+  ASIO_DECL void discard_read_ahead(implementation_type& impl);
+
+  // Cancel the outstanding reads into the read-ahead chunks.
+  ASIO_DECL void cancel_read_ahead_impls(implementation_type& impl);
+
+  // Release the descriptors used for the read-ahead chunks, without closing
+  // the file. Outstanding chunk reads are cancelled.
+  ASIO_DECL void release_read_ahead_impls(implementation_type& impl);
+
+  // The io_uring service used by the descriptor service.
+  io_uring_service& io_uring_service_;
+
   // The implementation used for initiating asynchronous operations.
   descriptor_service descriptor_service_;
 
@@ -42,6 +42,14 @@ public:
   // The operation key used for targeted cancellation.
   void* cancellation_key_;
 
+  // Whether the operation may be attempted without blocking when it is
+  // performed before submission.
+  bool try_speculative_;
+
+  // Whether the operation is an io_uring_batch_operation, which is submitted
+  // as a number of independent submission queue entries.
+  bool is_batch_;
+
   // Prepare the operation.
   void prepare(::io_uring_sqe* sqe)
   {
@@ -65,6 +73,8 @@ protected:
       ec_(success_ec),
       bytes_transferred_(0),
       cancellation_key_(0),
+      try_speculative_(false),
+      is_batch_(false),
       prepare_func_(prepare_func),
       perform_func_(perform_func)
   {
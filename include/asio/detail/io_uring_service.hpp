@@ -26,6 +26,7 @@
 #include "asio/detail/atomic_count.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/detail/conditionally_enabled_mutex.hpp"
+#include "asio/detail/io_uring_batch_operation.hpp"
 #include "asio/detail/io_uring_operation.hpp"
 #include "asio/detail/limits.hpp"
 #include "asio/detail/object_pool.hpp"
@@ -33,6 +34,7 @@
 #include "asio/detail/reactor.hpp"
 #include "asio/detail/scheduler_task.hpp"
 #include "asio/detail/slim_mutex.hpp"
+#include "asio/detail/speculative_policy.hpp"
 #include "asio/detail/timer_queue_base.hpp"
 #include "asio/detail/timer_queue_set.hpp"
 #include "asio/detail/tss_ptr.hpp"
@@ -81,6 +83,7 @@ public:
     op_queue<io_uring_operation> op_queue_;
     bool cancel_requested_;
     std::size_t first_op_ring_index_;
+    speculative_policy::history speculative_history_;
 
     ASIO_DECL io_queue();
     void set_result(int r) { task_result_ = static_cast<unsigned>(r); }
@@ -92,9 +95,6 @@ public:
   // Per I/O object state.
   struct io_object
   {
-    io_object* next_;
-    io_object* prev_;
-
     mutex mutex_;
     io_uring_service* service_;
     io_queue queues_[max_ops];
@@ -139,9 +139,12 @@ public:
   void post_immediate_completion(operation* op, bool is_continuation);
 
   // Start a new operation. The operation will be prepared and submitted to the
-  // io_uring when it is at the head of its I/O operation queue.
+  // io_uring when it is at the head of its I/O operation queue. If speculation
+  // is allowed, the operation may first be attempted without blocking,
+  // according to the configured policy.
   ASIO_DECL void start_op(int op_type, per_io_object_data& io_obj,
-      io_uring_operation* op, bool is_continuation);
+      io_uring_operation* op, bool is_continuation,
+      bool allow_speculative = false);
 
   // Cancel all operations associated with the given I/O object. The handlers
   // associated with the I/O object will be invoked with the operation_aborted
@@ -266,6 +269,22 @@ private:
   // Submit pending submission queue entries.
   ASIO_DECL void submit_sqes(std::size_t ring_index);
 
+  // Prepare the submission queue entries for the operation at the front of an
+  // I/O queue. Must be called with the ring's mutex held. Returns false if no
+  // submission queue entry is available.
+  ASIO_DECL bool prepare_op(std::size_t ring_index,
+      io_queue* io_q, io_uring_operation* op);
+
+  // Prepare the submission queue entries needed to cancel the operation at
+  // the front of an I/O queue. A batch is cancelled one entry at a time, as
+  // each entry is submitted with its own user data. Must be called with the
+  // ring's mutex held.
+  ASIO_DECL void prepare_cancel(std::size_t ring_index, io_queue* io_q);
+
+  // Record the result of a completion queue entry. Returns the I/O queue that
+  // is ready to be performed, if any.
+  ASIO_DECL static io_queue* io_queue_for_result(void* ptr, int result);
+
   // Post an operation to submit the pending submission queue entries.
   ASIO_DECL void post_submit_sqes_op(
       mutex::scoped_lock& lock, std::size_t ring_index);
@@ -318,6 +337,9 @@ private:
   // The number of operations to submit in a batch.
   const int submit_batch_size_;
 
+  // When to attempt operations before submitting them.
+  const speculative_policy speculative_policy_;
+
   // The number of entries used to size each io_uring.
   const unsigned int ring_size_;
 
@@ -331,10 +353,8 @@ private:
   // operation is outstanding.
   __kernel_timespec timeout_;
 
-  // Mutex to protect access to the registered I/O objects.
-  mutex registration_mutex_;
-
-  // Keep track of all registered I/O objects.
+  // Keep track of all registered I/O objects. Allocation and deallocation of
+  // I/O object states do not require locking.
   object_pool<io_object, execution_context::allocator<void>>
     registered_io_objects_;
 
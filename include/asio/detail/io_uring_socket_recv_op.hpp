@@ -107,6 +107,31 @@ public:
         }
       }
     }
+    else if (!after_completion && o->try_speculative_)
+    {
+      bool done;
+      if (o->bufs_.is_single_buffer)
+      {
+        done = socket_ops::non_blocking_recv1(o->socket_,
+            o->bufs_.first(o->buffers_).data(),
+            o->bufs_.first(o->buffers_).size(), o->flags_,
+            (o->state_ & socket_ops::stream_oriented) != 0,
+            o->ec_, o->bytes_transferred_);
+      }
+      else
+      {
+        done = socket_ops::non_blocking_recv(o->socket_,
+            o->bufs_.buffers(), o->bufs_.count(), o->flags_,
+            (o->state_ & socket_ops::stream_oriented) != 0,
+            o->ec_, o->bytes_transferred_);
+      }
+
+      // The socket is in blocking mode, so the operation is submitted as
+      // normal if the attempt would have blocked.
+      if (!done)
+        o->ec_.assign(0, o->ec_.category());
+      return done;
+    }
     else if (after_completion)
     {
       if (!o->ec_ && o->bytes_transferred_ == 0)
@@ -100,6 +100,29 @@ public:
             o->ec_, o->bytes_transferred_);
       }
     }
+    else if (!after_completion && o->try_speculative_)
+    {
+      bool done;
+      if (o->bufs_.is_single_buffer)
+      {
+        done = socket_ops::non_blocking_send1(o->socket_,
+            o->bufs_.first(o->buffers_).data(),
+            o->bufs_.first(o->buffers_).size(), o->flags_,
+            o->ec_, o->bytes_transferred_);
+      }
+      else
+      {
+        done = socket_ops::non_blocking_send(o->socket_,
+            o->bufs_.buffers(), o->bufs_.count(), o->flags_,
+            o->ec_, o->bytes_transferred_);
+      }
+
+      // The socket is in blocking mode, so the operation is submitted as
+      // normal if the attempt would have blocked.
+      if (!done)
+        o->ec_.assign(0, o->ec_.category());
+      return done;
+    }
 
     if (o->ec_ && o->ec_ == asio::error::would_block)
     {
@@ -315,7 +315,7 @@ public:
     start_op(impl, io_uring_service::write_op, p.p, is_continuation,
         ((impl.state_ & socket_ops::stream_oriented)
           && buffer_sequence_adapter<asio::const_buffer,
-            ConstBufferSequence>::all_empty(buffers)));
+            ConstBufferSequence>::all_empty(buffers)), true);
     p.v = p.p = 0;
   }
 
@@ -423,7 +423,8 @@ public:
     start_op(impl, op_type, p.p, is_continuation,
         ((impl.state_ & socket_ops::stream_oriented)
           && buffer_sequence_adapter<asio::mutable_buffer,
-            MutableBufferSequence>::all_empty(buffers)));
+            MutableBufferSequence>::all_empty(buffers)),
+        op_type == io_uring_service::read_op);
     p.v = p.p = 0;
   }
 
@@ -608,7 +609,8 @@ protected:
 
   // Start the asynchronous read or write operation.
   ASIO_DECL void start_op(base_implementation_type& impl, int op_type,
-      io_uring_operation* op, bool is_continuation, bool noop);
+      io_uring_operation* op, bool is_continuation, bool noop,
+      bool allow_speculative = false);
 
   // Start the asynchronous accept operation.
   ASIO_DECL void start_accept_op(base_implementation_type& impl,
@@ -70,8 +70,6 @@ public:
     descriptor_state(bool locking, int spin_count)
       : mutex_(locking, spin_count) {}
 
-    descriptor_state* next_;
-    descriptor_state* prev_;
 
     mutex mutex_;
     int descriptor_;
@@ -256,10 +254,8 @@ private:
   // How any times to spin waiting for the I/O mutex.
   const int io_locking_spin_count_;
 
-  // Mutex to protect access to the registered descriptors.
-  mutex registered_descriptors_mutex_;
-
-  // Keep track of all registered descriptors.
+  // Keep track of all registered descriptors. Allocation and deallocation of
+  // descriptor states do not require locking.
   object_pool<descriptor_state, execution_context::allocator<void>>
     registered_descriptors_;
 
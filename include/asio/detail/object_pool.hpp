@@ -16,7 +16,11 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/config.hpp"
+#include <atomic>
+#include <cstddef>
+#include "asio/detail/cstdint.hpp"
 #include "asio/detail/memory.hpp"
+#include "asio/detail/mutex.hpp"
 
 #include "asio/detail/push_options.hpp"
 
@@ -24,6 +28,18 @@ namespace asio {
 ASIO_INLINE_NAMESPACE_BEGIN
 namespace detail {
 
+// A pool of objects that are recycled rather than destroyed, so that an object
+// remains valid, if unused, until the pool itself is destroyed. Objects may be
+// allocated and freed concurrently from any thread without locking.
+//
+// Each object is numbered when it is created, and an index maps the number
+// back to the object. Unused objects are kept on a lock-free stack of object
+// numbers, and the stack's head carries a tag that changes on every update to
+// prevent ABA. Each thread also keeps a small cache of unused objects, which
+// is used before the shared stack. Because objects are never deallocated
+// while the pool exists, a thread that reads a stale entry from the stack can
+// do no more than fail its compare-and-swap. A new object is created, under a
+// mutex, only when no unused object is available.
 template <typename Object, typename Allocator>
 class object_pool
 {
@@ -33,15 +49,11 @@ public:
   object_pool(const Allocator& allocator,
       unsigned int preallocated, Args... args)
     : allocator_(allocator),
-      live_list_(0),
-      free_list_(0)
+      state_(new state)
   {
     while (preallocated > 0)
     {
-      Object* o = allocate_object<Object>(allocator_, args...);
-      o->next_ = free_list_;
-      o->prev_ = 0;
-      free_list_ = o;
+      push(*state_, create(args...)->index_);
       --preallocated;
     }
   }
@@ -49,75 +61,287 @@ public:
   // Destructor destroys all objects.
   ~object_pool()
   {
-    destroy_list(live_list_);
-    destroy_list(free_list_);
+    std::size_t size = state_->size_.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < size; ++i)
+      deallocate_object(allocator_, state_->entry_at(i).node_);
+
+    // The calling thread's cache no longer needs the index. Caches held by
+    // other threads are released when they next change pools or exit.
+    thread_cache& cache = this_thread_cache();
+    if (cache.state_ == state_)
+    {
+      cache.count_ = 0;
+      cache.state_ = 0;
+      release(state_);
+    }
+
+    release(state_);
   }
 
-  // Get the object at the start of the live list.
+  // Get the first live object, or null if there are none.
   Object* first()
   {
-    return live_list_;
+    return find_live(0);
+  }
+
+  // Get the live object that follows the specified one, or null if there are
+  // no more. Objects allocated after iteration starts may not be visited.
+  Object* next(Object* o)
+  {
+    return find_live(static_cast<node*>(o)->index_ + 1);
   }
 
   // Allocate a new object with an argument.
   template <typename... Args>
   Object* alloc(Args... args)
   {
-    Object* o = free_list_;
-    if (o)
-      free_list_ = free_list_->next_;
+    node* n = 0;
+    thread_cache& cache = this_thread_cache();
+    if (cache.state_ == state_ && cache.count_ > 0)
+    {
+      n = state_->entry_at(cache.indexes_[--cache.count_]).node_;
+    }
     else
-      o = allocate_object<Object>(allocator_, args...);
-
-    o->next_ = live_list_;
-    o->prev_ = 0;
-    if (live_list_)
-      live_list_->prev_ = o;
-    live_list_ = o;
+    {
+      uint32_t index = pop(*state_);
+      n = index != no_index ? state_->entry_at(index).node_ : create(args...);
+    }
 
-    return o;
+    state_->entry_at(n->index_).live_.store(true, std::memory_order_release);
+    return n;
   }
 
   // Free an object. Moves it to the free list. No destructors are run.
   void free(Object* o)
   {
-    if (live_list_ == o)
-      live_list_ = o->next_;
-
-    if (o->prev_)
-      o->prev_->next_ = o->next_;
+    node* n = static_cast<node*>(o);
+    state_->entry_at(n->index_).live_.store(false, std::memory_order_release);
 
-    if (o->next_)
-      o->next_->prev_ = o->prev_;
+    thread_cache& cache = this_thread_cache();
+    if (cache.state_ != state_ && !cache.exited_)
+    {
+      flush(cache);
+      cache.state_ = state_;
+      state_->ref_count_.fetch_add(1, std::memory_order_relaxed);
+    }
 
-    o->next_ = free_list_;
-    o->prev_ = 0;
-    free_list_ = o;
+    if (cache.state_ == state_ && cache.count_ < cache_size)
+      cache.indexes_[cache.count_++] = n->index_;
+    else
+      push(*state_, n->index_);
   }
 
 private:
   object_pool(const object_pool&) = delete;
   object_pool& operator=(const object_pool&) = delete;
 
-  // Helper function to destroy all elements in a list.
-  void destroy_list(Object* list)
+  enum
+  {
+    // The number of unused objects cached by each thread.
+    cache_size = 32,
+
+    // The number of index entries in the first segment. Each subsequent
+    // segment is twice the size of the one before.
+    first_segment_size = 64,
+    max_segments = 26
+  };
+
+  static const uint32_t no_index = 0xFFFFFFFF;
+
+  // A pooled object, which records its own number.
+  struct node : Object
+  {
+    template <typename... Args>
+    explicit node(Args... args)
+      : Object(args...),
+        index_(0)
+    {
+    }
+
+    uint32_t index_;
+  };
+
+  // An entry in the index. The link to the next unused object is kept here,
+  // rather than in the object, so that a thread's cache may be flushed after
+  // the objects have been destroyed.
+  struct entry
+  {
+    node* node_;
+    std::atomic<uint32_t> next_;
+    std::atomic<bool> live_;
+  };
+
+  // The index and unused object stack, which are shared with the per-thread
+  // caches and so may outlive the pool.
+  struct state
+  {
+    state()
+      : free_head_(0),
+        size_(0),
+        ref_count_(1)
+    {
+      for (int i = 0; i < max_segments; ++i)
+        segments_[i] = 0;
+    }
+
+    ~state()
+    {
+      for (int i = 0; i < max_segments; ++i)
+        delete[] segments_[i];
+    }
+
+    entry& entry_at(std::size_t index)
+    {
+      int segment = segment_of(index);
+      return segments_[segment][index - segment_base(segment)];
+    }
+
+    static int segment_of(std::size_t index)
+    {
+      std::size_t n = index / first_segment_size + 1;
+      int segment = 0;
+      while (n >>= 1)
+        ++segment;
+      return segment;
+    }
+
+    static std::size_t segment_base(int segment)
+    {
+      return first_segment_size
+        * ((static_cast<std::size_t>(1) << segment) - 1);
+    }
+
+    // The object number plus one in the low word, and a tag in the high word.
+    std::atomic<uint64_t> free_head_;
+
+    // The number of objects created.
+    std::atomic<std::size_t> size_;
+
+    // The pool and each thread cache that refers to the state hold a
+    // reference.
+    std::atomic<long> ref_count_;
+
+    // Protects the creation of new objects.
+    mutex create_mutex_;
+
+    // The segments of the index.
+    entry* segments_[max_segments];
+  };
+
+  // A thread's cache of unused objects, which belong to a single pool.
+  struct thread_cache
   {
-    while (list)
+    ~thread_cache()
     {
-      Object* o = list;
-      list = o->next_;
-      deallocate_object(allocator_, o);
+      flush(*this);
+      exited_ = true;
     }
+
+    state* state_;
+    std::size_t count_;
+    bool exited_;
+    uint32_t indexes_[cache_size];
+  };
+
+  static thread_cache& this_thread_cache()
+  {
+    static thread_local thread_cache cache;
+    return cache;
+  }
+
+  // Return the cached objects to the stack of the pool they belong to.
+  static void flush(thread_cache& cache)
+  {
+    if (state* s = cache.state_)
+    {
+      while (cache.count_ > 0)
+        push(*s, cache.indexes_[--cache.count_]);
+      cache.state_ = 0;
+      release(s);
+    }
+  }
+
+  static void release(state* s)
+  {
+    if (s->ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      delete s;
+  }
+
+  static void push(state& s, uint32_t index)
+  {
+    entry& e = s.entry_at(index);
+    uint64_t head = s.free_head_.load(std::memory_order_relaxed);
+    uint64_t new_head;
+    do
+    {
+      e.next_.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+      new_head = ((head >> 32) + 1) << 32 | (index + static_cast<uint64_t>(1));
+    } while (!s.free_head_.compare_exchange_weak(head, new_head,
+          std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  static uint32_t pop(state& s)
+  {
+    uint64_t head = s.free_head_.load(std::memory_order_acquire);
+    uint64_t new_head;
+    do
+    {
+      uint32_t top = static_cast<uint32_t>(head);
+      if (top == 0)
+        return no_index;
+      uint32_t next = s.entry_at(top - 1).next_.load(std::memory_order_relaxed);
+      new_head = ((head >> 32) + 1) << 32 | next;
+    } while (!s.free_head_.compare_exchange_weak(head, new_head,
+          std::memory_order_acquire, std::memory_order_acquire));
+    return static_cast<uint32_t>(head) - 1;
+  }
+
+  // Create a new object and add it to the index.
+  template <typename... Args>
+  node* create(Args... args)
+  {
+    node* n = allocate_object<node>(allocator_, args...);
+
+    state& s = *state_;
+    mutex::scoped_lock lock(s.create_mutex_);
+    std::size_t index = s.size_.load(std::memory_order_relaxed);
+    int segment = state::segment_of(index);
+    if (s.segments_[segment] == 0)
+    {
+      std::size_t segment_size = first_segment_size
+        * (static_cast<std::size_t>(1) << segment);
+      s.segments_[segment] = new entry[segment_size];
+      for (std::size_t i = 0; i < segment_size; ++i)
+      {
+        s.segments_[segment][i].node_ = 0;
+        s.segments_[segment][i].next_.store(0, std::memory_order_relaxed);
+        s.segments_[segment][i].live_.store(false, std::memory_order_relaxed);
+      }
+    }
+
+    n->index_ = static_cast<uint32_t>(index);
+    s.entry_at(index).node_ = n;
+    s.size_.store(index + 1, std::memory_order_release);
+    return n;
+  }
+
+  Object* find_live(std::size_t index)
+  {
+    std::size_t size = state_->size_.load(std::memory_order_acquire);
+    for (; index < size; ++index)
+    {
+      entry& e = state_->entry_at(index);
+      if (e.live_.load(std::memory_order_acquire))
+        return e.node_;
+    }
+    return 0;
   }
 
   // The execution_context allocator used to manage pooled object memory.
   Allocator allocator_;
 
-  // The list of live objects.
-  Object* live_list_;
-
-  // The free list.
-  Object* free_list_;
+  // The index and stack of unused objects.
+  state* state_;
 };
 
 } // namespace detail
@@ -0,0 +1,127 @@
+//
+// detail/op_slot.hpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_OP_SLOT_HPP
+#define ASIO_DETAIL_OP_SLOT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include "asio/detail/noncopyable.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// Memory retained by an I/O object for reuse by successive operations of the
+// same kind, such as the reads on a socket. Only one operation at a time may
+// occupy the slot. The slot is sized for the most recent operation to use it.
+// An operation may outlive the I/O object, in which case the slot is freed
+// when the operation is.
+class op_slot
+  : private noncopyable
+{
+public:
+  // Obtain memory from the slot, creating or resizing the slot if necessary.
+  // Returns 0 if the slot is occupied or cannot satisfy the alignment, in
+  // which case the memory must be allocated by some other means.
+  static void* allocate(op_slot*& slot, std::size_t size, std::size_t align)
+  {
+    if (align > ASIO_DEFAULT_ALIGN)
+      return 0;
+
+    if (slot)
+    {
+      if (slot->state_.load(std::memory_order_acquire) & in_use)
+        return 0;
+
+      if (slot->size_ >= size)
+      {
+        slot->state_.store(in_use, std::memory_order_relaxed);
+        return slot->data();
+      }
+
+      destroy(slot);
+      slot = 0;
+    }
+
+    // The slot needs only the default alignment, so its memory comes from the
+    // global operator new, where applications can observe it.
+    void* mem = ::operator new(header_size() + size);
+    slot = new (mem) op_slot(size);
+    return slot->data();
+  }
+
+  // Return the memory to the slot. May be called from any thread.
+  static void deallocate(op_slot* slot)
+  {
+    if (slot->state_.fetch_and(~in_use, std::memory_order_acq_rel) & released)
+      destroy(slot);
+  }
+
+  // Called by the owning I/O object to give up the slot.
+  static void release(op_slot*& slot)
+  {
+    if (slot)
+    {
+      if (!(slot->state_.fetch_or(released,
+              std::memory_order_acq_rel) & in_use))
+        destroy(slot);
+      slot = 0;
+    }
+  }
+
+private:
+  enum { in_use = 1, released = 2 };
+
+  explicit op_slot(std::size_t size)
+    : size_(size),
+      state_(in_use)
+  {
+  }
+
+  static std::size_t header_size()
+  {
+    return (sizeof(op_slot) + ASIO_DEFAULT_ALIGN - 1)
+      / ASIO_DEFAULT_ALIGN * ASIO_DEFAULT_ALIGN;
+  }
+
+  static void destroy(op_slot* slot)
+  {
+    slot->~op_slot();
+    ::operator delete(slot);
+  }
+
+  void* data()
+  {
+    return reinterpret_cast<unsigned char*>(this) + header_size();
+  }
+
+  // The number of bytes available to an operation.
+  std::size_t size_;
+
+  // Whether the slot is occupied, and whether the I/O object has released it.
+  std::atomic<int> state_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_OP_SLOT_HPP
@@ -0,0 +1,71 @@
+//
+// detail/process_ops.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_PROCESS_OPS_HPP
+#define ASIO_DETAIL_PROCESS_OPS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_PROCESS)
+
+#include "asio/error.hpp"
+#include "asio/error_code.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+namespace process_ops {
+
+// Flags used to select the standard streams that are connected to pipes.
+enum
+{
+  pipe_stdin = 1,
+  pipe_stdout = 2,
+  pipe_stderr = 4
+};
+
+// Spawn a child process running the program at the specified path. On return,
+// parent_fds holds the parent's end of the pipe for each standard stream that
+// was selected in the flags, or -1 otherwise, and pidfd holds a descriptor
+// that becomes readable when the child exits. Returns the child's process id,
+// or -1 on failure.
+ASIO_DECL int spawn(const char* path, char* const argv[], int flags,
+    int parent_fds[3], int& pidfd, asio::error_code& ec);
+
+// Send a signal to the process referred to by a pidfd descriptor.
+ASIO_DECL int send_signal(int pidfd, int signal_number,
+    asio::error_code& ec);
+
+// Reap the child process, if it has exited. The exit code is set to the exit
+// status for a normal exit, or to 128 plus the signal number if the child was
+// terminated by a signal. Returns true if the child has been reaped.
+ASIO_DECL bool reap(int pid, bool block, int& exit_code,
+    asio::error_code& ec);
+
+} // namespace process_ops
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/detail/impl/process_ops.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
+#endif // defined(ASIO_HAS_PROCESS)
+
+#endif // ASIO_DETAIL_PROCESS_OPS_HPP
@@ -121,16 +121,17 @@ public:
   typedef Handler handler_type;
   typedef IoExecutor io_executor_type;
 
-  ASIO_DEFINE_HANDLER_PTR(reactive_socket_recv_op);
+  ASIO_DEFINE_HANDLER_SLOT_PTR(reactive_socket_recv_op);
 
   reactive_socket_recv_op(const asio::error_code& success_ec,
       socket_type socket, socket_ops::state_type state,
       const MutableBufferSequence& buffers, socket_base::message_flags flags,
-      Handler& handler, const IoExecutor& io_ex)
+      Handler& handler, const IoExecutor& io_ex, op_slot* slot)
     : reactive_socket_recv_op_base<MutableBufferSequence>(success_ec, socket,
         state, buffers, flags, &reactive_socket_recv_op::do_complete),
       handler_(static_cast<Handler&&>(handler)),
-      work_(handler_, io_ex)
+      work_(handler_, io_ex),
+      slot_(slot)
   {
   }
 
@@ -141,7 +142,7 @@ public:
     // Take ownership of the handler object.
     ASIO_ASSUME(base != 0);
     reactive_socket_recv_op* o(static_cast<reactive_socket_recv_op*>(base));
-    ptr p = { asio::detail::addressof(o->handler_), o, o };
+    ptr p = { asio::detail::addressof(o->handler_), o, o, o->slot_ };
 
     ASIO_HANDLER_COMPLETION((*o));
 
@@ -178,7 +179,7 @@ public:
     // Take ownership of the handler object.
     ASIO_ASSUME(base != 0);
     reactive_socket_recv_op* o(static_cast<reactive_socket_recv_op*>(base));
-    ptr p = { asio::detail::addressof(o->handler_), o, o };
+    ptr p = { asio::detail::addressof(o->handler_), o, o, o->slot_ };
 
     ASIO_HANDLER_COMPLETION((*o));
 
@@ -208,6 +209,7 @@ public:
 private:
   Handler handler_;
   handler_work<Handler, IoExecutor> work_;
+  op_slot* slot_;
 };
 
 } // namespace detail
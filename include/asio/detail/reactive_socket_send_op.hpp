@@ -104,16 +104,17 @@ public:
   typedef Handler handler_type;
   typedef IoExecutor io_executor_type;
 
-  ASIO_DEFINE_HANDLER_PTR(reactive_socket_send_op);
+  ASIO_DEFINE_HANDLER_SLOT_PTR(reactive_socket_send_op);
 
   reactive_socket_send_op(const asio::error_code& success_ec,
       socket_type socket, socket_ops::state_type state,
       const ConstBufferSequence& buffers, socket_base::message_flags flags,
-      Handler& handler, const IoExecutor& io_ex)
+      Handler& handler, const IoExecutor& io_ex, op_slot* slot)
     : reactive_socket_send_op_base<ConstBufferSequence>(success_ec, socket,
         state, buffers, flags, &reactive_socket_send_op::do_complete),
       handler_(static_cast<Handler&&>(handler)),
-      work_(handler_, io_ex)
+      work_(handler_, io_ex),
+      slot_(slot)
   {
   }
 
@@ -124,7 +125,7 @@ public:
     // Take ownership of the handler object.
     ASIO_ASSUME(base != 0);
     reactive_socket_send_op* o(static_cast<reactive_socket_send_op*>(base));
-    ptr p = { asio::detail::addressof(o->handler_), o, o };
+    ptr p = { asio::detail::addressof(o->handler_), o, o, o->slot_ };
 
     ASIO_HANDLER_COMPLETION((*o));
 
@@ -161,7 +162,7 @@ public:
     // Take ownership of the handler object.
     ASIO_ASSUME(base != 0);
     reactive_socket_send_op* o(static_cast<reactive_socket_send_op*>(base));
-    ptr p = { asio::detail::addressof(o->handler_), o, o };
+    ptr p = { asio::detail::addressof(o->handler_), o, o, o->slot_ };
 
     ASIO_HANDLER_COMPLETION((*o));
 
@@ -191,6 +192,7 @@ public:
 private:
   Handler handler_;
   handler_work<Handler, IoExecutor> work_;
+  op_slot* slot_;
 };
 
 } // namespace detail
@@ -29,6 +29,7 @@
 #include "asio/socket_base.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/detail/memory.hpp"
+#include "asio/detail/op_slot.hpp"
 #include "asio/detail/reactive_null_buffers_op.hpp"
 #include "asio/detail/reactive_socket_recv_op.hpp"
 #include "asio/detail/reactive_socket_recvmsg_op.hpp"
@@ -40,6 +41,12 @@
 #include "asio/detail/socket_ops.hpp"
 #include "asio/detail/socket_types.hpp"
 
+#if defined(ASIO_HAS_IO_URING)
+# include <atomic>
+# include "asio/detail/io_uring_service.hpp"
+# include "asio/detail/io_uring_socket_send_op.hpp"
+#endif // defined(ASIO_HAS_IO_URING)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -63,6 +70,18 @@ public:
 
     // Per-descriptor data used by the reactor.
     reactor::per_descriptor_data reactor_data_;
+
+    // Memory retained for reuse by successive receive operations.
+    op_slot* read_slot_;
+
+    // Memory retained for reuse by successive send operations.
+    op_slot* write_slot_;
+
+#if defined(ASIO_HAS_IO_URING)
+    // Per-object data used by the io_uring service for send operations. Only
+    // registered once the socket performs a send using io_uring.
+    io_uring_service::per_io_object_data io_object_data_;
+#endif // defined(ASIO_HAS_IO_URING)
   };
 
   // Constructor.
@@ -129,6 +148,10 @@ public:
       int backlog, asio::error_code& ec)
   {
     socket_ops::listen(impl.socket_, backlog, ec);
+#if defined(ASIO_HAS_EPOLL)
+    if (!ec)
+      reactor_.register_listener(impl.socket_, impl.reactor_data_);
+#endif // defined(ASIO_HAS_EPOLL)
     return ec;
   }
 
@@ -288,6 +311,14 @@ public:
       const ConstBufferSequence& buffers, socket_base::message_flags flags,
       Handler& handler, const IoExecutor& io_ex)
   {
+#if defined(ASIO_HAS_IO_URING)
+    if (impl.state_ & socket_ops::io_uring_sends)
+    {
+      async_send_using_io_uring(impl, buffers, flags, handler, io_ex);
+      return;
+    }
+#endif // defined(ASIO_HAS_IO_URING)
+
     bool is_continuation =
       ASIO_VERSIONED_NAME(handler_cont_helpers)::is_continuation(handler);
 
@@ -297,10 +328,10 @@ public:
     // Allocate and construct an operation to wrap the handler.
     typedef reactive_socket_send_op<
         ConstBufferSequence, Handler, IoExecutor> op;
-    typename op::ptr p = { asio::detail::addressof(handler),
-      op::ptr::allocate(handler), 0 };
+    typename op::ptr p = { asio::detail::addressof(handler), 0, 0, 0 };
+    p.allocate(handler, op_slots_ ? &impl.write_slot_ : 0);
     p.p = new (p.v) op(success_ec_, impl.socket_,
-        impl.state_, buffers, flags, handler, io_ex);
+        impl.state_, buffers, flags, handler, io_ex, p.s);
 
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
@@ -404,10 +435,10 @@ public:
     // Allocate and construct an operation to wrap the handler.
     typedef reactive_socket_recv_op<
         MutableBufferSequence, Handler, IoExecutor> op;
-    typename op::ptr p = { asio::detail::addressof(handler),
-      op::ptr::allocate(handler), 0 };
+    typename op::ptr p = { asio::detail::addressof(handler), 0, 0, 0 };
+    p.allocate(handler, op_slots_ ? &impl.read_slot_ : 0);
     p.p = new (p.v) op(success_ec_, impl.socket_,
-        impl.state_, buffers, flags, handler, io_ex);
+        impl.state_, buffers, flags, handler, io_ex, p.s);
 
     // Optionally register for per-operation cancellation.
     if (slot.is_connected())
@@ -593,6 +624,9 @@ protected:
       base_implementation_type& impl, int type,
       const native_handle_type& native_socket, asio::error_code& ec);
 
+  // Apply the configured SO_BUSY_POLL value to a newly opened socket.
+  ASIO_DECL void apply_busy_poll(base_implementation_type& impl);
+
   // Start the asynchronous read or write operation.
   ASIO_DECL void do_start_op(base_implementation_type& impl,
       int op_type, reactor_op* op, bool is_continuation,
@@ -703,6 +737,102 @@ protected:
         addrlen, &reactor::call_post_immediate_completion, &reactor_);
   }
 
+#if defined(ASIO_HAS_IO_URING)
+  // Get the io_uring service, creating it on first use so that programs that
+  // never send using io_uring do not pay for a ring.
+  ASIO_DECL io_uring_service& get_io_uring_service();
+
+  // Start an asynchronous send using the io_uring service.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send_using_io_uring(base_implementation_type& impl,
+      const ConstBufferSequence& buffers, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    io_uring_service& service = get_io_uring_service();
+    if (!impl.io_object_data_)
+      service.register_io_object(impl.io_object_data_);
+
+    bool is_continuation =
+      ASIO_VERSIONED_NAME(handler_cont_helpers)::is_continuation(handler);
+
+    associated_cancellation_slot_t<Handler> slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler. The reactor
+    // puts the descriptor into non-blocking mode for its own operations, but
+    // IORING_OP_SENDMSG waits for the socket to become writable regardless,
+    // so the operation must not fall back to polling and sending itself.
+    typedef io_uring_socket_send_op<
+        ConstBufferSequence, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        static_cast<socket_ops::state_type>(
+          impl.state_ & ~socket_ops::internal_non_blocking),
+        buffers, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&service,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((service.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_send"));
+
+    if ((impl.state_ & socket_ops::stream_oriented)
+        && buffer_sequence_adapter<asio::const_buffer,
+          ConstBufferSequence>::all_empty(buffers))
+    {
+      service.post_immediate_completion(p.p, is_continuation);
+    }
+    else
+    {
+      service.start_op(io_uring_service::write_op,
+          impl.io_object_data_, p.p, is_continuation, true);
+    }
+    p.v = p.p = 0;
+  }
+
+  // Helper class used to implement per-operation cancellation of sends that
+  // use the io_uring service.
+  class io_uring_op_cancellation
+  {
+  public:
+    io_uring_op_cancellation(io_uring_service* s,
+        io_uring_service::per_io_object_data* p, int o)
+      : io_uring_service_(s),
+        io_object_data_(p),
+        op_type_(o)
+    {
+    }
+
+    void operator()(cancellation_type_t type)
+    {
+      if (!!(type &
+            (cancellation_type::terminal
+              | cancellation_type::partial
+              | cancellation_type::total)))
+      {
+        io_uring_service_->cancel_ops_by_key(*io_object_data_, op_type_, this);
+      }
+    }
+
+  private:
+    io_uring_service* io_uring_service_;
+    io_uring_service::per_io_object_data* io_object_data_;
+    int op_type_;
+  };
+#endif // defined(ASIO_HAS_IO_URING)
+
+  // Deregister the socket from the io_uring service, if it has been used.
+  ASIO_DECL void deregister_io_uring_object(base_implementation_type& impl);
+
+  // Release the io_uring service's resources for a deregistered socket.
+  ASIO_DECL void cleanup_io_uring_object(base_implementation_type& impl);
+
   // Helper class used to implement per-operation cancellation
   class reactor_op_cancellation
   {
@@ -743,6 +873,17 @@ protected:
 
   // Extra state flags to be applied to newly opened sockets.
   socket_ops::state_type extra_state_;
+
+  // The SO_BUSY_POLL value to be applied to newly opened sockets.
+  int busy_poll_usec_;
+
+  // Whether send and receive operations reuse memory retained by the socket.
+  const bool op_slots_;
+
+#if defined(ASIO_HAS_IO_URING)
+  // The io_uring service used for sends, once it has been created.
+  std::atomic<io_uring_service*> io_uring_service_;
+#endif // defined(ASIO_HAS_IO_URING)
 };
 
 } // namespace detail
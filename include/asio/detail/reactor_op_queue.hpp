@@ -39,6 +39,7 @@ public:
   {
     mapped_type() {}
     mapped_type(const mapped_type&) {}
+    mapped_type(mapped_type&& other) { this->push(other); }
     void operator=(const mapped_type&) {}
   };
 
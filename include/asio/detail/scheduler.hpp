@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/config.hpp"
+#include <atomic>
 
 #include "asio/error_code.hpp"
 #include "asio/execution_context.hpp"
@@ -109,6 +110,13 @@ public:
       stop();
   }
 
+  // Get the current count of unfinished work. The result is approximate if
+  // work is being started or finished concurrently in other threads.
+  long outstanding_work() const
+  {
+    return outstanding_work_;
+  }
+
   // Return whether a handler can be dispatched immediately.
   ASIO_DECL bool can_dispatch();
 
@@ -163,6 +171,11 @@ private:
   ASIO_DECL std::size_t do_poll_one(mutex::scoped_lock& lock,
       thread_info& this_thread, const asio::error_code& ec);
 
+  // Run the task when the operation queue is otherwise empty, first polling
+  // it without blocking for up to the busy-poll budget. Must be called without
+  // the lock held, and does not acquire it.
+  ASIO_DECL void run_task_with_busy_poll(op_queue<operation>& ops);
+
   // Stop the task and all idle threads.
   ASIO_DECL void stop_all_threads(mutex::scoped_lock& lock);
 
@@ -210,8 +223,9 @@ private:
     task_operation() : operation(0) {}
   } task_operation_;
 
-  // Whether the task has been interrupted.
-  bool task_interrupted_;
+  // Whether the task has been interrupted. Only modified while the lock is
+  // held, but may be read without it by a thread that is busy-polling the task.
+  std::atomic<bool> task_interrupted_;
 
   // Flag to indicate that the dispatcher has been stopped.
   bool stopped_;
@@ -231,6 +245,26 @@ private:
   // The time limit on waiting when the queue is empty, in microseconds.
   const long wait_usec_;
 
+  // The maximum time to poll the task without blocking before waiting on it,
+  // in microseconds.
+  const long busy_poll_usec_;
+
+  // Whether to adjust the busy-poll budget based on observed idle periods.
+  const bool busy_poll_adaptive_;
+
+  // The current busy-poll budget, in microseconds. Only accessed by the thread
+  // that is running the task.
+  long busy_poll_budget_usec_;
+
+  // The moving average of the time spent waiting for the task to produce
+  // operations, in microseconds. Only accessed by the thread that is running
+  // the task.
+  long busy_poll_idle_usec_;
+
+  // The maximum amount of memory that each thread may reserve for recycling
+  // handler allocations while running the scheduler.
+  const std::size_t memory_limit_;
+
   // The thread that is running the scheduler.
   asio::detail::thread thread_;
 };
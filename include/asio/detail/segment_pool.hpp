@@ -0,0 +1,156 @@
+//
+// detail/segment_pool.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_SEGMENT_POOL_HPP
+#define ASIO_DETAIL_SEGMENT_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <new>
+#include <vector>
+#include "asio/config.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/noncopyable.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// A thread-safe cache of fixed-size memory blocks.
+class segment_pool
+  : private noncopyable
+{
+public:
+  segment_pool(std::size_t block_size, std::size_t capacity)
+    : block_size_(block_size),
+      capacity_(capacity)
+  {
+    free_.reserve(capacity);
+  }
+
+  ~segment_pool()
+  {
+    for (std::size_t i = 0; i < free_.size(); ++i)
+      ::operator delete(free_[i]);
+  }
+
+  // Get the size of each block.
+  std::size_t block_size() const noexcept
+  {
+    return block_size_;
+  }
+
+  // Obtain a block, reusing a cached block if one is available.
+  char* allocate()
+  {
+    {
+      mutex::scoped_lock lock(mutex_);
+      if (!free_.empty())
+      {
+        char* block = free_.back();
+        free_.pop_back();
+        return block;
+      }
+    }
+
+    return static_cast<char*>(::operator new(block_size_));
+  }
+
+  // Return a block to the cache, or free it if the cache is full.
+  void deallocate(char* block) noexcept
+  {
+    {
+      mutex::scoped_lock lock(mutex_);
+      if (free_.size() < capacity_)
+      {
+        free_.push_back(block);
+        return;
+      }
+    }
+
+    ::operator delete(block);
+  }
+
+private:
+  mutex mutex_;
+  std::size_t block_size_;
+  std::size_t capacity_;
+  std::vector<char*> free_;
+};
+
+// Owns the segment pools for an execution context. The pools are shared with
+// the buffers that use them, so that blocks may be safely returned after the
+// execution context has been destroyed.
+class segment_pool_service
+  : public execution_context_service_base<segment_pool_service>
+{
+public:
+  segment_pool_service(execution_context& context)
+    : execution_context_service_base<segment_pool_service>(context),
+      capacity_(config(context).get(
+            "segmented_buffer", "pool_capacity", 256U)),
+      pool_(std::make_shared<segment_pool>(block_size(context), capacity_))
+  {
+  }
+
+  void shutdown()
+  {
+  }
+
+  // Get the pool for the configured block size.
+  const std::shared_ptr<segment_pool>& pool() const noexcept
+  {
+    return pool_;
+  }
+
+  // Get the pool for the specified block size, creating it if required.
+  std::shared_ptr<segment_pool> pool(std::size_t size)
+  {
+    if (size == pool_->block_size())
+      return pool_;
+
+    mutex::scoped_lock lock(mutex_);
+    std::shared_ptr<segment_pool>& p = sized_pools_[size];
+    if (!p)
+      p = std::make_shared<segment_pool>(size, capacity_);
+    return p;
+  }
+
+private:
+  // Get the configured block size, which must be non-zero.
+  static std::size_t block_size(execution_context& context)
+  {
+    std::size_t size = config(context).get(
+        "segmented_buffer", "block_size", 4096U);
+    return size > 0 ? size : 4096;
+  }
+
+  mutex mutex_;
+  std::size_t capacity_;
+  std::shared_ptr<segment_pool> pool_;
+  std::map<std::size_t, std::shared_ptr<segment_pool>> sized_pools_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_SEGMENT_POOL_HPP
@@ -216,6 +216,13 @@ private:
   // Helper function to close the pipe descriptors.
   ASIO_DECL static void close_descriptors();
 
+#if defined(ASIO_HAS_SIGNALFD)
+  // Helper function to update the set of signals accepted by the signalfd
+  // descriptor to match the registrations, after adding or removing a signal.
+  ASIO_DECL static asio::error_code update_signalfd(
+      int signal_number, bool add, asio::error_code& ec);
+#endif // defined(ASIO_HAS_SIGNALFD)
+
   // Helper function to start a wait operation.
   ASIO_DECL void start_wait_op(implementation_type& impl, signal_op* op);
 
@@ -265,12 +272,22 @@ private:
 
   // The per I/O object data used for the pipe.
   io_uring_service::per_io_object_data io_object_data_;
+
+#  if defined(ASIO_HAS_SIGNALFD)
+  // The per I/O object data used for the signalfd descriptor.
+  io_uring_service::per_io_object_data signalfd_io_object_data_;
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
   // The reactor used for waiting for pipe readiness.
   reactor& reactor_;
 
   // The per-descriptor reactor data used for the pipe.
   reactor::per_descriptor_data reactor_data_;
+
+#  if defined(ASIO_HAS_SIGNALFD)
+  // The per-descriptor reactor data used for the signalfd descriptor.
+  reactor::per_descriptor_data signalfd_reactor_data_;
+#  endif // defined(ASIO_HAS_SIGNALFD)
 # endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 #endif // !defined(ASIO_WINDOWS)
        //   && !defined(ASIO_WINDOWS_RUNTIME)
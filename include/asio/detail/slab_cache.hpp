@@ -0,0 +1,394 @@
+//
+// detail/slab_cache.hpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_SLAB_CACHE_HPP
+#define ASIO_DETAIL_SLAB_CACHE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <atomic>
+#include <cstddef>
+#include "asio/detail/memory.hpp"
+#include "asio/detail/noncopyable.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// A per-thread cache of small memory blocks, segregated into size classes and
+// carved from larger slabs. Blocks freed by the owning thread go straight back
+// onto the cache's free lists. Blocks freed by any other thread are collected
+// into batches, each of which is pushed onto a lock-free list that the owner
+// reclaims when its free lists run dry. A cache outlives its thread for as
+// long as any of its blocks remain in use.
+class slab_cache
+  : private noncopyable
+{
+public:
+  // Allocate a block of at least the specified size and alignment, using the
+  // calling thread's cache when possible. The cache may reserve at most limit
+  // bytes of slab memory, where 0 means no limit. Blocks that cannot come from
+  // the cache are allocated individually.
+  static void* allocate(std::size_t size,
+      std::size_t align, std::size_t limit)
+  {
+    if (align <= ASIO_DEFAULT_ALIGN)
+    {
+      int size_class = size_class_of(size);
+      if (size_class >= 0)
+        if (slab_cache* cache = thread_cache(true))
+          if (void* pointer = cache->allocate_block(size_class, limit))
+            return pointer;
+    }
+
+    return allocate_unowned(size, align);
+  }
+
+  // Deallocate a block obtained from allocate(). May be called from any thread.
+  static void deallocate(void* pointer)
+  {
+    block_header* header = header_of(pointer);
+    slab_cache* owner = header->owner_;
+    if (owner == 0)
+    {
+      aligned_delete(static_cast<unsigned char*>(pointer) - header->info_);
+    }
+    else if (owner == thread_cache(false))
+    {
+      owner->push_free(static_cast<int>(header->info_), pointer);
+      --owner->outstanding_;
+    }
+    else
+    {
+      defer_remote(owner, pointer);
+    }
+  }
+
+  // Determine whether a block obtained from allocate() belongs to a cache.
+  static bool is_cached(void* pointer)
+  {
+    return header_of(pointer)->owner_ != 0;
+  }
+
+  // Get the number of bytes of slab memory reserved by the calling thread's
+  // cache.
+  static std::size_t thread_reserved_bytes()
+  {
+    slab_cache* cache = thread_cache(false);
+    return cache ? cache->reserved_ : 0;
+  }
+
+private:
+  enum
+  {
+    num_size_classes = 16,
+    slab_size = 16384,
+    min_blocks_per_slab = 4,
+    remote_batch_size = 16
+  };
+
+  // The header that precedes every block. For blocks that belong to a cache,
+  // info_ holds the size class. Otherwise, owner_ is null and info_ holds the
+  // offset of the block from the start of its allocation.
+  struct block_header
+  {
+    slab_cache* owner_;
+    std::size_t info_;
+  };
+
+  enum
+  {
+    header_size = (sizeof(block_header) + ASIO_DEFAULT_ALIGN - 1)
+      / ASIO_DEFAULT_ALIGN * ASIO_DEFAULT_ALIGN
+  };
+
+  // Owns the calling thread's cache and closes it when the thread exits. Also
+  // holds the batch of blocks that the thread has freed on behalf of another
+  // cache, all of which belong to batch_owner_.
+  struct thread_cache_holder
+  {
+    ~thread_cache_holder()
+    {
+      exited_ = true;
+      flush_remote(*this);
+      if (slab_cache* cache = cache_)
+      {
+        cache_ = 0;
+        cache->close();
+      }
+    }
+
+    slab_cache* cache_;
+    bool exited_;
+    slab_cache* batch_owner_;
+    void* batch_head_;
+    void* batch_tail_;
+    long batch_count_;
+  };
+
+  slab_cache()
+    : slabs_(0),
+      reserved_(0),
+      outstanding_(0),
+      remote_head_(0),
+      orphaned_(0)
+  {
+    for (int i = 0; i < num_size_classes; ++i)
+      free_[i] = 0;
+  }
+
+  ~slab_cache()
+  {
+    while (slabs_)
+    {
+      void* slab = slabs_;
+      slabs_ = next(slab);
+      aligned_delete(slab);
+    }
+  }
+
+  static thread_cache_holder& thread_holder()
+  {
+    static thread_local thread_cache_holder holder;
+    return holder;
+  }
+
+  static slab_cache* thread_cache(bool create)
+  {
+    thread_cache_holder& holder = thread_holder();
+    if (holder.cache_ == 0 && create && !holder.exited_)
+      holder.cache_ = new slab_cache;
+    return holder.cache_;
+  }
+
+  // Add a block owned by another cache to the calling thread's batch, which
+  // is returned to the owner once full or when a block from a different
+  // owner is freed.
+  static void defer_remote(slab_cache* owner, void* pointer)
+  {
+    thread_cache_holder& holder = thread_holder();
+    if (holder.exited_)
+    {
+      owner->push_remote(pointer, pointer, 1);
+      return;
+    }
+
+    if (holder.batch_owner_ != owner)
+    {
+      flush_remote(holder);
+      holder.batch_owner_ = owner;
+      holder.batch_tail_ = pointer;
+    }
+
+    next(pointer) = holder.batch_head_;
+    holder.batch_head_ = pointer;
+    if (++holder.batch_count_ == remote_batch_size)
+      flush_remote(holder);
+  }
+
+  static void flush_remote(thread_cache_holder& holder)
+  {
+    if (slab_cache* owner = holder.batch_owner_)
+    {
+      owner->push_remote(holder.batch_head_,
+          holder.batch_tail_, holder.batch_count_);
+      holder.batch_owner_ = 0;
+      holder.batch_head_ = 0;
+      holder.batch_tail_ = 0;
+      holder.batch_count_ = 0;
+    }
+  }
+
+  static std::size_t size_of_class(int size_class)
+  {
+    static const std::size_t sizes[num_size_classes] =
+    {
+      16, 32, 48, 64, 96, 128, 192, 256,
+      384, 512, 768, 1024, 1536, 2048, 3072, 4096
+    };
+
+    return (sizes[size_class] + ASIO_DEFAULT_ALIGN - 1)
+      / ASIO_DEFAULT_ALIGN * ASIO_DEFAULT_ALIGN;
+  }
+
+  static int size_class_of(std::size_t size)
+  {
+    for (int size_class = 0; size_class < num_size_classes; ++size_class)
+      if (size <= size_of_class(size_class))
+        return size_class;
+    return -1;
+  }
+
+  static block_header* header_of(void* pointer)
+  {
+    return reinterpret_cast<block_header*>(
+        static_cast<unsigned char*>(pointer) - header_size);
+  }
+
+  static void*& next(void* pointer)
+  {
+    return *static_cast<void**>(pointer);
+  }
+
+  static void* allocate_unowned(std::size_t size, std::size_t align)
+  {
+    std::size_t offset = header_size;
+    if (align > ASIO_DEFAULT_ALIGN)
+      offset = (header_size + align - 1) / align * align;
+
+    unsigned char* mem = static_cast<unsigned char*>(
+        aligned_new(align, offset + size));
+    void* pointer = mem + offset;
+    block_header* header = header_of(pointer);
+    header->owner_ = 0;
+    header->info_ = offset;
+    return pointer;
+  }
+
+  void* allocate_block(int size_class, std::size_t limit)
+  {
+    if (free_[size_class] == 0)
+    {
+      if (remote_head_.load(std::memory_order_relaxed) != 0)
+        reclaim_remote();
+      if (free_[size_class] == 0 && !add_slab(size_class, limit))
+        return 0;
+    }
+
+    void* pointer = free_[size_class];
+    free_[size_class] = next(pointer);
+    ++outstanding_;
+    return pointer;
+  }
+
+  void push_free(int size_class, void* pointer)
+  {
+    next(pointer) = free_[size_class];
+    free_[size_class] = pointer;
+  }
+
+  bool add_slab(int size_class, std::size_t limit)
+  {
+    std::size_t stride = header_size + size_of_class(size_class);
+    std::size_t count = (static_cast<std::size_t>(slab_size) - header_size)
+      / stride;
+    if (count < static_cast<std::size_t>(min_blocks_per_slab))
+      count = min_blocks_per_slab;
+    std::size_t bytes = header_size + count * stride;
+    if (limit != 0 && reserved_ + bytes > limit)
+      return false;
+
+    unsigned char* slab = static_cast<unsigned char*>(
+        aligned_new(ASIO_DEFAULT_ALIGN, bytes));
+    next(slab) = slabs_;
+    slabs_ = slab;
+    reserved_ += bytes;
+
+    // Push the blocks in reverse so that they are handed out in address order.
+    for (std::size_t i = count; i > 0; --i)
+    {
+      void* pointer = slab + header_size + (i - 1) * stride + header_size;
+      block_header* header = header_of(pointer);
+      header->owner_ = this;
+      header->info_ = static_cast<std::size_t>(size_class);
+      push_free(size_class, pointer);
+    }
+
+    return true;
+  }
+
+  // Called by a thread other than the owner to return a linked list of
+  // blocks. Once the owner has exited, the remote list is closed and the
+  // blocks are simply released, with the last block to be released destroying
+  // the cache.
+  void push_remote(void* first, void* last, long count)
+  {
+    void* head = remote_head_.load(std::memory_order_relaxed);
+    do
+    {
+      if (head == closed_marker())
+      {
+        if (orphaned_.fetch_sub(count, std::memory_order_acq_rel) == count)
+          delete this;
+        return;
+      }
+      next(last) = head;
+    } while (!remote_head_.compare_exchange_weak(head, first,
+          std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  // Move blocks returned by other threads back onto the free lists.
+  void reclaim_remote()
+  {
+    void* pointer = remote_head_.exchange(0, std::memory_order_acquire);
+    while (pointer)
+    {
+      void* next_pointer = next(pointer);
+      push_free(static_cast<int>(header_of(pointer)->info_), pointer);
+      --outstanding_;
+      pointer = next_pointer;
+    }
+  }
+
+  // Called when the owning thread exits. Blocks that are still in use are
+  // counted in orphaned_, which may already have been decremented by threads
+  // that saw the closed list first.
+  void close()
+  {
+    void* pointer = remote_head_.exchange(
+        closed_marker(), std::memory_order_acquire);
+    while (pointer)
+    {
+      pointer = next(pointer);
+      --outstanding_;
+    }
+
+    long outstanding = outstanding_;
+    if (orphaned_.fetch_add(outstanding,
+          std::memory_order_acq_rel) + outstanding == 0)
+      delete this;
+  }
+
+  void* closed_marker()
+  {
+    return this;
+  }
+
+  // The free list for each size class.
+  void* free_[num_size_classes];
+
+  // The list of slabs owned by the cache.
+  void* slabs_;
+
+  // The number of bytes of slab memory owned by the cache.
+  std::size_t reserved_;
+
+  // The number of blocks in use. Only accessed by the owning thread.
+  long outstanding_;
+
+  // Blocks returned by other threads.
+  std::atomic<void*> remote_head_;
+
+  // The number of blocks still in use after the owning thread has exited.
+  std::atomic<long> orphaned_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_SLAB_CACHE_HPP
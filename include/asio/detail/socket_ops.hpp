@@ -57,10 +57,14 @@ enum
 
   // When using an edge-triggered reactor (epoll) the user wants the edge to be
   // reset following a partial read on a stream-oriented socket.
-  reset_edge_on_partial_read = 128
+  reset_edge_on_partial_read = 128,
+
+  // When the reactor is used for socket readiness, the user wants send
+  // operations to be performed by the io_uring service instead.
+  io_uring_sends = 256
 };
 
-typedef unsigned char state_type;
+typedef unsigned short state_type;
 
 struct noop_deleter { void operator()(void*) {} };
 typedef shared_ptr<void> shared_cancel_token_type;
@@ -440,6 +440,7 @@ ASIO_INLINE_VARIABLE const int max_iov_len = 16;
 ASIO_INLINE_VARIABLE const int custom_socket_option_level = 0xA5100000;
 ASIO_INLINE_VARIABLE const int enable_connection_aborted_option = 1;
 ASIO_INLINE_VARIABLE const int always_fail_option = 2;
+ASIO_INLINE_VARIABLE const int io_uring_sends_option = 3;
 
 } // namespace detail
 ASIO_INLINE_NAMESPACE_END
@@ -0,0 +1,93 @@
+//
+// detail/speculative_policy.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_SPECULATIVE_POLICY_HPP
+#define ASIO_DETAIL_SPECULATIVE_POLICY_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// Determines whether an I/O operation should be attempted before waiting for
+// the descriptor to become ready, according to the "reactor" /
+// "speculative_io" configuration option.
+class speculative_policy
+{
+public:
+  enum mode
+  {
+    // The backend's own behaviour.
+    backend_default = -1,
+
+    // Never attempt an operation before waiting.
+    never = 0,
+
+    // Always attempt an operation before waiting.
+    always = 1,
+
+    // Attempt an operation before waiting unless recent attempts on the same
+    // descriptor have mostly failed because the operation would block.
+    adaptive = 2
+  };
+
+  // The outcomes of the most recent attempts for a single descriptor and
+  // operation type. Each set bit records an attempt that would have blocked.
+  typedef unsigned char history;
+
+  explicit speculative_policy(int m)
+    : mode_(m >= never && m <= adaptive ? static_cast<mode>(m)
+        : backend_default)
+  {
+  }
+
+  mode get() const
+  {
+    return mode_;
+  }
+
+  // Determine whether to make an attempt under the adaptive policy. Skipped
+  // attempts are recorded as successes, so that attempts resume after a short
+  // while in case the traffic pattern has changed.
+  static bool should_try(history& h)
+  {
+    int would_block = 0;
+    for (history bits = h; bits != 0; bits &= bits - 1)
+      ++would_block;
+    if (would_block < 4)
+      return true;
+    h = static_cast<history>(h << 1);
+    return false;
+  }
+
+  // Record the outcome of an attempt.
+  static void record(history& h, bool would_block)
+  {
+    h = static_cast<history>((h << 1) | (would_block ? 1 : 0));
+  }
+
+private:
+  mode mode_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_SPECULATIVE_POLICY_HPP
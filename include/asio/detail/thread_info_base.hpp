@@ -20,6 +20,11 @@
 #include <cstddef>
 #include "asio/detail/memory.hpp"
 #include "asio/detail/noncopyable.hpp"
+#include "asio/handler_allocation_stats.hpp"
+
+#if !defined(ASIO_DISABLE_SLAB_RECYCLING)
+# include "asio/detail/slab_cache.hpp"
+#endif // !defined(ASIO_DISABLE_SLAB_RECYCLING)
 
 #if !defined(ASIO_NO_EXCEPTIONS)
 # include <exception>
@@ -36,6 +41,10 @@ namespace detail {
 # define ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE 2
 #endif // ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE
 
+#ifndef ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT
+# define ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT (1024 * 1024)
+#endif // ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT
+
 class thread_info_base
   : private noncopyable
 {
@@ -46,7 +55,8 @@ public:
     {
       cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
       begin_mem_index = 0,
-      end_mem_index = cache_size
+      end_mem_index = cache_size,
+      stats_purpose = handler_allocation_stats::operation
     };
   };
 
@@ -56,7 +66,8 @@ public:
     {
       cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
       begin_mem_index = default_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
+      end_mem_index = begin_mem_index + cache_size,
+      stats_purpose = handler_allocation_stats::awaitable_frame
     };
   };
 
@@ -66,7 +77,8 @@ public:
     {
       cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
       begin_mem_index = awaitable_frame_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
+      end_mem_index = begin_mem_index + cache_size,
+      stats_purpose = handler_allocation_stats::executor_function
     };
   };
 
@@ -76,7 +88,8 @@ public:
     {
       cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
       begin_mem_index = executor_function_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
+      end_mem_index = begin_mem_index + cache_size,
+      stats_purpose = handler_allocation_stats::cancellation_signal
     };
   };
 
@@ -86,7 +99,8 @@ public:
     {
       cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
       begin_mem_index = cancellation_signal_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
+      end_mem_index = begin_mem_index + cache_size,
+      stats_purpose = handler_allocation_stats::parallel_group
     };
   };
 
@@ -96,23 +110,28 @@ public:
     {
       cache_size = ASIO_RECYCLING_ALLOCATOR_CACHE_SIZE,
       begin_mem_index = parallel_group_tag::end_mem_index,
-      end_mem_index = begin_mem_index + cache_size
+      end_mem_index = begin_mem_index + cache_size,
+      stats_purpose = handler_allocation_stats::timed_cancel
     };
   };
 
   enum { max_mem_index = timed_cancel_tag::end_mem_index };
 
   thread_info_base()
+    : memory_limit_(ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT)
 #if !defined(ASIO_NO_EXCEPTIONS)
-    : has_pending_exception_(0)
+    , has_pending_exception_(0)
 #endif // !defined(ASIO_NO_EXCEPTIONS)
   {
+#if defined(ASIO_DISABLE_SLAB_RECYCLING)
     for (int i = 0; i < max_mem_index; ++i)
       reusable_memory_[i] = 0;
+#endif // defined(ASIO_DISABLE_SLAB_RECYCLING)
   }
 
   ~thread_info_base()
   {
+#if defined(ASIO_DISABLE_SLAB_RECYCLING)
     for (int i = 0; i < max_mem_index; ++i)
     {
       // The following test for non-null pointers is technically redundant, but
@@ -121,6 +140,14 @@ public:
       if (reusable_memory_[i])
         aligned_delete(reusable_memory_[i]);
     }
+#endif // defined(ASIO_DISABLE_SLAB_RECYCLING)
+  }
+
+  // Set the maximum number of bytes of slab memory that the thread's cache may
+  // reserve while this thread_info_base is at the top of the call stack.
+  void set_memory_limit(std::size_t limit)
+  {
+    memory_limit_ = limit;
   }
 
   static void* allocate(thread_info_base* this_thread,
@@ -135,6 +162,25 @@ public:
     deallocate(default_tag(), this_thread, pointer, size);
   }
 
+#if !defined(ASIO_DISABLE_SLAB_RECYCLING)
+  template <typename Purpose>
+  static void* allocate(Purpose, thread_info_base* this_thread,
+      std::size_t size, std::size_t align = ASIO_DEFAULT_ALIGN)
+  {
+    void* const pointer = slab_cache::allocate(size, align, this_thread
+        ? this_thread->memory_limit_ : ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT);
+    record_allocation(Purpose(), size, slab_cache::is_cached(pointer));
+    return pointer;
+  }
+
+  template <typename Purpose>
+  static void deallocate(Purpose, thread_info_base*,
+      void* pointer, std::size_t size)
+  {
+    record_deallocation(Purpose(), size);
+    slab_cache::deallocate(pointer);
+  }
+#else // !defined(ASIO_DISABLE_SLAB_RECYCLING)
   template <typename Purpose>
   static void* allocate(Purpose, thread_info_base* this_thread,
       std::size_t size, std::size_t align = ASIO_DEFAULT_ALIGN)
@@ -155,6 +201,7 @@ public:
           {
             this_thread->reusable_memory_[mem_index] = 0;
             mem[size] = mem[0];
+            record_allocation(Purpose(), size, true);
             return pointer;
           }
         }
@@ -176,6 +223,7 @@ public:
     void* const pointer = aligned_new(align, chunks * chunk_size + 1);
     unsigned char* const mem = static_cast<unsigned char*>(pointer);
     mem[size] = (chunks <= UCHAR_MAX) ? static_cast<unsigned char>(chunks) : 0;
+    record_allocation(Purpose(), size, false);
     return pointer;
   }
 
@@ -183,6 +231,8 @@ public:
   static void deallocate(Purpose, thread_info_base* this_thread,
       void* pointer, std::size_t size)
   {
+    record_deallocation(Purpose(), size);
+
     if (size <= chunk_size * UCHAR_MAX)
     {
       if (this_thread)
@@ -203,6 +253,7 @@ public:
 
     aligned_delete(pointer);
   }
+#endif // !defined(ASIO_DISABLE_SLAB_RECYCLING)
 
   void capture_current_exception()
   {
@@ -240,12 +291,39 @@ public:
   }
 
 private:
+  template <typename Purpose>
+  static void record_allocation(Purpose, std::size_t size, bool hit)
+  {
+#if defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+    handler_allocation_counters::instance().allocated(
+        Purpose::stats_purpose, size, hit);
+#else // defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+    (void)size;
+    (void)hit;
+#endif // defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+  }
+
+  template <typename Purpose>
+  static void record_deallocation(Purpose, std::size_t size)
+  {
+#if defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+    handler_allocation_counters::instance().deallocated(
+        Purpose::stats_purpose, size);
+#else // defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+    (void)size;
+#endif // defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+  }
+
+#if defined(ASIO_DISABLE_SLAB_RECYCLING)
 #if defined(ASIO_HAS_IO_URING)
   enum { chunk_size = 8 };
 #else // defined(ASIO_HAS_IO_URING)
   enum { chunk_size = 4 };
 #endif // defined(ASIO_HAS_IO_URING)
   void* reusable_memory_[max_mem_index];
+#endif // defined(ASIO_DISABLE_SLAB_RECYCLING)
+
+  std::size_t memory_limit_;
 
 #if !defined(ASIO_NO_EXCEPTIONS)
   int has_pending_exception_;
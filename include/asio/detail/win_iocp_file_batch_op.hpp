@@ -0,0 +1,145 @@
+//
+// detail/win_iocp_file_batch_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_WIN_IOCP_FILE_BATCH_OP_HPP
+#define ASIO_DETAIL_WIN_IOCP_FILE_BATCH_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IOCP) && defined(ASIO_HAS_FILE)
+
+#include <atomic>
+#include "asio/error.hpp"
+#include "asio/file_request.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/operation.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// Tracks a batch of reads or writes that are started as independent
+// overlapped operations, and invokes the handler once all have completed.
+template <typename Buffer, typename Handler, typename IoExecutor>
+class win_iocp_file_batch_op : public operation
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(win_iocp_file_batch_op);
+
+  win_iocp_file_batch_op(basic_file_request<Buffer>* requests,
+      std::size_t count, Handler& handler, const IoExecutor& io_ex)
+    : operation(&win_iocp_file_batch_op::do_complete),
+      requests_(requests),
+      count_(count),
+      remaining_(count),
+      handler_(static_cast<Handler&&>(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  // The handler used for a single request.
+  class request_handler
+  {
+  public:
+    request_handler(win_iocp_file_batch_op* op, std::size_t index)
+      : op_(op),
+        index_(index)
+    {
+    }
+
+    void operator()(const asio::error_code& ec, std::size_t n)
+    {
+      op_->requests_[index_].set_result(ec, n);
+      if (--op_->remaining_ == 0)
+        op_->complete(op_, asio::error_code(), 0);
+    }
+
+  private:
+    win_iocp_file_batch_op* op_;
+    std::size_t index_;
+  };
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    win_iocp_file_batch_op* o(static_cast<win_iocp_file_batch_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        static_cast<handler_work<Handler, IoExecutor>&&>(
+          o->work_));
+
+    // The batch reports the error of the first request that failed, if any,
+    // and the total number of bytes transferred.
+    asio::error_code ec;
+    std::size_t bytes_transferred = 0;
+    for (std::size_t i = 0; i < o->count_; ++i)
+    {
+      bytes_transferred += o->requests_[i].bytes_transferred();
+      if (o->requests_[i].error() && !ec)
+        ec = o->requests_[i].error();
+    }
+
+    ASIO_ERROR_LOCATION(ec);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, ec, bytes_transferred);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  basic_file_request<Buffer>* requests_;
+  std::size_t count_;
+  std::atomic<std::size_t> remaining_;
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IOCP) && defined(ASIO_HAS_FILE)
+
+#endif // ASIO_DETAIL_WIN_IOCP_FILE_BATCH_OP_HPP
@@ -21,10 +21,12 @@
 
 #include <string>
 #include "asio/detail/cstdint.hpp"
+#include "asio/detail/win_iocp_file_batch_op.hpp"
 #include "asio/detail/win_iocp_handle_service.hpp"
 #include "asio/error.hpp"
 #include "asio/execution_context.hpp"
 #include "asio/file_base.hpp"
+#include "asio/file_request.hpp"
 
 #include "asio/detail/push_options.hpp"
 
@@ -149,6 +151,10 @@ public:
   ASIO_DECL uint64_t size(const implementation_type& impl,
       asio::error_code& ec) const;
 
+  // Get the alignment required for unbuffered I/O.
+  ASIO_DECL std::size_t alignment(const implementation_type& impl,
+      asio::error_code& ec) const;
+
   // Alter the size of the file.
   ASIO_DECL asio::error_code resize(implementation_type& impl,
       uint64_t n, asio::error_code& ec);
@@ -161,6 +167,20 @@ public:
   ASIO_DECL asio::error_code sync_data(implementation_type& impl,
       asio::error_code& ec);
 
+  // Set the read-ahead used for stream reads. Overlapped reads are already
+  // served from the system cache manager's read-ahead, so the values are
+  // validated but otherwise ignored.
+  asio::error_code set_read_ahead(implementation_type&,
+      std::size_t depth, std::size_t chunk_size, asio::error_code& ec)
+  {
+    if (depth > 0 && chunk_size == 0)
+      ec = asio::error::invalid_argument;
+    else
+      ec = asio::error_code();
+    ASIO_ERROR_LOCATION(ec);
+    return ec;
+  }
+
   // Seek to a position in the file.
   ASIO_DECL uint64_t seek(implementation_type& impl, int64_t offset,
       file_base::seek_basis whence, asio::error_code& ec);
@@ -248,7 +268,88 @@ public:
     handle_service_.async_read_some_at(impl, offset, buffers, handler, io_ex);
   }
 
+  // Perform a batch of reads or writes. Returns the total number of bytes
+  // transferred, and sets ec to the error of the first request that failed.
+  template <typename Buffer>
+  size_t batch_at(implementation_type& impl,
+      basic_file_request<Buffer>* requests, std::size_t count,
+      asio::error_code& ec)
+  {
+    ec = asio::error_code();
+    size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      asio::error_code request_ec;
+      size_t n = batch_request_at(impl, requests[i].offset(),
+          requests[i].buffer(), request_ec);
+      requests[i].set_result(request_ec, n);
+      total += n;
+      if (request_ec && !ec)
+        ec = request_ec;
+    }
+    return total;
+  }
+
+  // Start an asynchronous batch of reads or writes. Each request is started
+  // as an independent overlapped operation.
+  template <typename Buffer, typename Handler, typename IoExecutor>
+  void async_batch_at(implementation_type& impl,
+      basic_file_request<Buffer>* requests, std::size_t count,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    if (count == 0)
+    {
+      // A request to write 0 bytes is a no-op that completes immediately.
+      handle_service_.async_write_some_at(impl,
+          0, asio::const_buffer(), handler, io_ex);
+      return;
+    }
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef win_iocp_file_batch_op<Buffer, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    op* o = p.p = new (p.v) op(requests, count, handler, io_ex);
+    p.v = p.p = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      typename op::request_handler h(o, i);
+      async_batch_request_at(impl, requests[i].offset(),
+          requests[i].buffer(), h, io_ex);
+    }
+  }
+
 private:
+  // Helper functions to select the operation for a request.
+  size_t batch_request_at(implementation_type& impl, uint64_t offset,
+      const asio::mutable_buffer& buffer, asio::error_code& ec)
+  {
+    return handle_service_.read_some_at(impl, offset, buffer, ec);
+  }
+
+  size_t batch_request_at(implementation_type& impl, uint64_t offset,
+      const asio::const_buffer& buffer, asio::error_code& ec)
+  {
+    return handle_service_.write_some_at(impl, offset, buffer, ec);
+  }
+
+  template <typename Handler, typename IoExecutor>
+  void async_batch_request_at(implementation_type& impl, uint64_t offset,
+      const asio::mutable_buffer& buffer, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    handle_service_.async_read_some_at(impl, offset, buffer, handler, io_ex);
+  }
+
+  template <typename Handler, typename IoExecutor>
+  void async_batch_request_at(implementation_type& impl, uint64_t offset,
+      const asio::const_buffer& buffer, Handler& handler,
+      const IoExecutor& io_ex)
+  {
+    handle_service_.async_write_some_at(impl, offset, buffer, handler, io_ex);
+  }
+
   // The implementation used for initiating asynchronous operations.
   win_iocp_handle_service handle_service_;
 
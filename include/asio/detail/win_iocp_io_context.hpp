@@ -114,6 +114,14 @@ public:
       stop();
   }
 
+  // Get the current count of unfinished work. The result is approximate if
+  // work is being started or finished concurrently in other threads.
+  long outstanding_work() const
+  {
+    return ::InterlockedExchangeAdd(
+        const_cast<LONG*>(&outstanding_work_), 0);
+  }
+
   // Return whether a handler can be dispatched immediately.
   ASIO_DECL bool can_dispatch();
 
@@ -329,6 +337,10 @@ private:
   // The concurrency hint used to initialise the io_context.
   const int concurrency_hint_;
 
+  // The maximum amount of memory that each thread may reserve for recycling
+  // handler allocations while running the io_context.
+  const std::size_t memory_limit_;
+
   // The thread that is running the io_context.
   asio::detail::thread thread_;
 };
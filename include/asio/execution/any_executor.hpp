@@ -36,6 +36,19 @@
 
 #include "asio/detail/push_options.hpp"
 
+// The size and alignment of the storage used to hold a target executor within
+// an any_executor object. Target executors that do not fit are allocated on
+// the heap. The values must be the same in every translation unit.
+#if !defined(ASIO_ANY_EXECUTOR_INLINE_SIZE)
+# define ASIO_ANY_EXECUTOR_INLINE_SIZE \
+  (sizeof(asio::detail::shared_ptr<void>) + sizeof(void*))
+#endif // !defined(ASIO_ANY_EXECUTOR_INLINE_SIZE)
+
+#if !defined(ASIO_ANY_EXECUTOR_INLINE_ALIGN)
+# define ASIO_ANY_EXECUTOR_INLINE_ALIGN \
+  (alignment_of<asio::detail::shared_ptr<void>>::value)
+#endif // !defined(ASIO_ANY_EXECUTOR_INLINE_ALIGN)
+
 namespace asio {
 ASIO_INLINE_NAMESPACE_BEGIN
 
@@ -219,6 +232,95 @@ template <typename... SupportableProperties>
 bool operator!=(nullptr_t,
     const any_executor<SupportableProperties...>& b) noexcept;
 
+/// Move-only polymorphic executor wrapper.
+/**
+ * The unique_any_executor class template wraps a target executor in the same
+ * way as any_executor, but has exclusive ownership of the target. A target
+ * executor that does not fit in the wrapper's inline storage is allocated on
+ * the heap without a reference count, so moving or destroying the wrapper
+ * does not perform any atomic operations.
+ *
+ * As it cannot be copied, a unique_any_executor does not itself satisfy the
+ * executor concept, and its properties are accessed by calling the query(),
+ * require() and prefer() member functions directly. It is intended for
+ * storing an executor in an object that has exclusive ownership of it, such
+ * as a long-lived connection. The require() and prefer() functions return an
+ * any_executor.
+ *
+ * The size of the inline storage used by both any_executor and
+ * unique_any_executor may be changed by defining the
+ * @c ASIO_ANY_EXECUTOR_INLINE_SIZE and @c ASIO_ANY_EXECUTOR_INLINE_ALIGN
+ * macros.
+ */
+template <typename... SupportableProperties>
+class unique_any_executor
+{
+public:
+  /// The copyable polymorphic wrapper type with the same properties.
+  typedef any_executor<SupportableProperties...> polymorphic_executor_type;
+
+  /// Default constructor.
+  unique_any_executor() noexcept;
+
+  /// Construct in an empty state. Equivalent effects to default constructor.
+  unique_any_executor(nullptr_t) noexcept;
+
+  /// Move constructor.
+  unique_any_executor(unique_any_executor&& e) noexcept;
+
+  /// Construct a polymorphic wrapper for the specified executor.
+  template <typename Executor>
+  unique_any_executor(Executor e);
+
+  /// Move assignment operator.
+  unique_any_executor& operator=(unique_any_executor&& e) noexcept;
+
+  /// Assignment operator that sets the polymorphic wrapper to the empty state.
+  unique_any_executor& operator=(nullptr_t);
+
+  /// Assignment operator to create a polymorphic wrapper for the specified
+  /// executor.
+  template <typename Executor>
+  unique_any_executor& operator=(Executor e);
+
+  /// Destructor.
+  ~unique_any_executor();
+
+  /// Swap targets with another polymorphic wrapper.
+  void swap(unique_any_executor& other) noexcept;
+
+  /// Obtain a polymorphic wrapper with the specified property.
+  template <typename Property>
+  polymorphic_executor_type require(Property) const;
+
+  /// Obtain a polymorphic wrapper with the specified property.
+  template <typename Property>
+  polymorphic_executor_type prefer(Property) const;
+
+  /// Obtain the value associated with the specified property.
+  template <typename Property>
+  typename Property::polymorphic_query_result_type query(Property) const;
+
+  /// Execute the function on the target executor.
+  /**
+   * Throws asio::bad_executor if the polymorphic wrapper has no target.
+   */
+  template <typename Function>
+  void execute(Function&& f) const;
+
+  /// Determine whether the wrapper has a target executor.
+  explicit operator bool() const noexcept;
+
+  /// Get the type of the target executor.
+  const type_info& target_type() const noexcept;
+
+  /// Get a pointer to the target executor.
+  template <typename Executor> Executor* target() noexcept;
+
+  /// Get a pointer to the target executor.
+  template <typename Executor> const Executor* target() const noexcept;
+};
+
 } // namespace execution
 
 #else // defined(GENERATING_DOCUMENTATION)
@@ -233,6 +335,9 @@ class any_executor;
 
 #endif // !defined(ASIO_EXECUTION_ANY_EXECUTOR_FWD_DECL)
 
+template <typename... SupportableProperties>
+class unique_any_executor;
+
 template <typename U>
 struct context_as_t;
 
@@ -483,6 +588,71 @@ private:
   impl_base* impl_;
 };
 
+struct unique_target_tag {};
+
+class unique_target_executor
+{
+public:
+  template <typename E>
+  unique_target_executor(E&& e, decay_t<E>*& target)
+  {
+    impl<decay_t<E>>* i =
+      new impl<decay_t<E>>(static_cast<E&&>(e));
+    target = &i->ex_;
+    impl_ = i;
+  }
+
+  template <typename E>
+  unique_target_executor(std::nothrow_t, E&& e, decay_t<E>*& target) noexcept
+  {
+    impl<decay_t<E>>* i =
+      new (std::nothrow) impl<decay_t<E>>(static_cast<E&&>(e));
+    target = i ? &i->ex_ : 0;
+    impl_ = i;
+  }
+
+  unique_target_executor(unique_target_executor&& other) noexcept
+    : impl_(other.impl_)
+  {
+    other.impl_ = 0;
+  }
+
+  ~unique_target_executor()
+  {
+    delete impl_;
+  }
+
+  void* get() const noexcept
+  {
+    return impl_ ? impl_->get() : 0;
+  }
+
+private:
+  unique_target_executor(const unique_target_executor& other) = delete;
+
+  unique_target_executor& operator=(
+      const unique_target_executor& other) = delete;
+
+  unique_target_executor& operator=(
+      unique_target_executor&& other) = delete;
+
+  struct impl_base
+  {
+    virtual ~impl_base() {}
+    virtual void* get() = 0;
+  };
+
+  template <typename Executor>
+  struct impl : impl_base
+  {
+    impl(Executor ex) : ex_(static_cast<Executor&&>(ex)) {}
+    virtual void* get() { return &ex_; }
+    Executor ex_;
+  };
+
+  impl_base* impl_;
+};
+
 class any_executor_base
 {
 public:
@@ -526,6 +696,20 @@ public:
     }
   }
 
+  template <ASIO_EXECUTION_EXECUTOR Executor>
+  any_executor_base(unique_target_tag, Executor ex)
+    : target_fns_(target_fns_table<Executor>(
+          any_executor_base::query_blocking(ex,
+            can_query<const Executor&, const execution::blocking_t&>())
+          == execution::blocking.always))
+  {
+    any_executor_base::construct_unique_object(ex,
+        integral_constant<bool,
+          sizeof(Executor) <= sizeof(object_type)
+            && alignment_of<Executor>::value <= alignment_of<object_type>::value
+        >());
+  }
+
   template <ASIO_EXECUTION_EXECUTOR Executor>
   any_executor_base(Executor other, true_type)
     : object_fns_(object_fns_table<shared_target_executor>()),
@@ -808,6 +992,44 @@ protected:
     return &fns;
   }
 
+  static void destroy_unique(any_executor_base& ex)
+  {
+    typedef unique_target_executor type;
+    ex.object<type>().~type();
+  }
+
+  static void move_unique(any_executor_base& ex1, any_executor_base& ex2)
+  {
+    typedef unique_target_executor type;
+    new (&ex1.object_) type(static_cast<type&&>(ex2.object<type>()));
+    ex1.target_ = ex2.target_;
+    ex2.object<type>().~type();
+  }
+
+  static const void* target_unique(const any_executor_base& ex)
+  {
+    typedef unique_target_executor type;
+    return ex.object<type>().get();
+  }
+
+  template <typename Obj>
+  static const object_fns* object_fns_table(
+      enable_if_t<
+        is_same<Obj, unique_target_executor>::value
+      >* = 0)
+  {
+    // A unique target is held only by unique_any_executor, which cannot be
+    // copied, so there is no copy function.
+    static const object_fns fns =
+    {
+      &any_executor_base::destroy_unique,
+      0,
+      &any_executor_base::move_unique,
+      &any_executor_base::target_unique
+    };
+    return &fns;
+  }
+
   template <typename Obj>
   static void destroy_object(any_executor_base& ex)
   {
@@ -840,6 +1062,7 @@ protected:
       enable_if_t<
         !is_same<Obj, void>::value
           && !is_same<Obj, shared_target_executor>::value
+          && !is_same<Obj, unique_target_executor>::value
       >* = 0)
   {
     static const object_fns fns =
@@ -1189,14 +1412,36 @@ private:
     target_ = p;
   }
 
+  template <typename Executor>
+  void construct_unique_object(Executor& ex, true_type)
+  {
+    construct_object(ex, true_type());
+  }
+
+  template <typename Executor>
+  void construct_unique_object(Executor& ex, false_type)
+  {
+    object_fns_ = object_fns_table<unique_target_executor>();
+    Executor* p = 0;
+    new (&object_) unique_target_executor(
+        static_cast<Executor&&>(ex), p);
+    target_ = p;
+  }
+
 /*private:*/public:
 //  template <typename...> friend class any_executor;
 
   typedef aligned_storage<
-      sizeof(asio::detail::shared_ptr<void>) + sizeof(void*),
-      alignment_of<asio::detail::shared_ptr<void>>::value
+      ASIO_ANY_EXECUTOR_INLINE_SIZE,
+      ASIO_ANY_EXECUTOR_INLINE_ALIGN
     >::type object_type;
 
+  static_assert(sizeof(object_type) >= sizeof(shared_target_executor)
+      && alignment_of<object_type>::value
+        >= alignment_of<shared_target_executor>::value,
+      "ASIO_ANY_EXECUTOR_INLINE_SIZE and ASIO_ANY_EXECUTOR_INLINE_ALIGN"
+      " must be large enough to hold a pointer");
+
   object_type object_;
   const object_fns* object_fns_;
   void* target_;
@@ -1409,6 +1654,17 @@ public:
   {
     return !!b;
   }
+
+private:
+  template <typename...> friend class unique_any_executor;
+
+  // Construct with a target that is owned outright. Only unique_any_executor,
+  // which cannot be copied, may hold such a target.
+  template <typename Executor>
+  any_executor(detail::unique_target_tag t, Executor ex)
+    : detail::any_executor_base(t, static_cast<Executor&&>(ex))
+  {
+  }
 };
 
 inline void swap(any_executor<>& a, any_executor<>& b) noexcept
@@ -1832,6 +2088,18 @@ public:
   }
 
   const prop_fns<any_executor>* prop_fns_;
+
+private:
+  template <typename...> friend class unique_any_executor;
+
+  // Construct with a target that is owned outright. Only unique_any_executor,
+  // which cannot be copied, may hold such a target.
+  template <typename Executor>
+  any_executor(detail::unique_target_tag t, Executor ex)
+    : detail::any_executor_base(t, static_cast<Executor&&>(ex)),
+      prop_fns_(prop_fns_table<Executor>())
+  {
+  }
 };
 
 template <typename... SupportableProperties>
@@ -1841,6 +2109,120 @@ inline void swap(any_executor<SupportableProperties...>& a,
   return a.swap(b);
 }
 
+template <typename... SupportableProperties>
+class unique_any_executor :
+  private any_executor<SupportableProperties...>
+{
+public:
+  typedef any_executor<SupportableProperties...> polymorphic_executor_type;
+
+  unique_any_executor() noexcept
+    : polymorphic_executor_type()
+  {
+  }
+
+  unique_any_executor(nullptr_t) noexcept
+    : polymorphic_executor_type()
+  {
+  }
+
+  template <typename Executor>
+  unique_any_executor(Executor ex,
+      enable_if_t<
+        conditional_t<
+          !is_base_of<detail::any_executor_base, Executor>::value,
+          is_convertible<Executor, polymorphic_executor_type>,
+          false_type
+        >::value
+      >* = 0)
+    : polymorphic_executor_type(detail::unique_target_tag(),
+        static_cast<Executor&&>(ex))
+  {
+  }
+
+  unique_any_executor(unique_any_executor&& other) noexcept
+    : polymorphic_executor_type(
+        static_cast<polymorphic_executor_type&&>(other))
+  {
+  }
+
+  unique_any_executor& operator=(unique_any_executor&& other) noexcept
+  {
+    polymorphic_executor_type::operator=(
+        static_cast<polymorphic_executor_type&&>(other));
+    return *this;
+  }
+
+  unique_any_executor& operator=(nullptr_t p) noexcept
+  {
+    polymorphic_executor_type::operator=(p);
+    return *this;
+  }
+
+  template <typename Executor>
+  enable_if_t<
+    conditional_t<
+      !is_base_of<detail::any_executor_base, Executor>::value,
+      is_convertible<Executor, polymorphic_executor_type>,
+      false_type
+    >::value,
+    unique_any_executor&
+  > operator=(Executor ex)
+  {
+    return *this = unique_any_executor(static_cast<Executor&&>(ex));
+  }
+
+  void swap(unique_any_executor& other) noexcept
+  {
+    polymorphic_executor_type::swap(
+        static_cast<polymorphic_executor_type&>(other));
+  }
+
+  using polymorphic_executor_type::execute;
+  using polymorphic_executor_type::query;
+  using polymorphic_executor_type::require;
+  using polymorphic_executor_type::prefer;
+  using polymorphic_executor_type::target;
+  using polymorphic_executor_type::target_type;
+  using polymorphic_executor_type::operator!;
+
+  explicit operator bool() const noexcept
+  {
+    return !!static_cast<const polymorphic_executor_type&>(*this);
+  }
+
+  friend bool operator==(const unique_any_executor& a, nullptr_t) noexcept
+  {
+    return !a;
+  }
+
+  friend bool operator==(nullptr_t, const unique_any_executor& b) noexcept
+  {
+    return !b;
+  }
+
+  friend bool operator!=(const unique_any_executor& a, nullptr_t) noexcept
+  {
+    return !!a;
+  }
+
+  friend bool operator!=(nullptr_t, const unique_any_executor& b) noexcept
+  {
+    return !!b;
+  }
+
+private:
+  unique_any_executor(const unique_any_executor&) = delete;
+  unique_any_executor& operator=(const unique_any_executor&) = delete;
+};
+
+template <typename... SupportableProperties>
+inline void swap(unique_any_executor<SupportableProperties...>& a,
+    unique_any_executor<SupportableProperties...>& b) noexcept
+{
+  return a.swap(b);
+}
+
 } // namespace execution
 namespace traits {
 
@@ -0,0 +1,559 @@
+//
+// experimental/basic_socket_acceptor_group.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_EXPERIMENTAL_BASIC_SOCKET_ACCEPTOR_GROUP_HPP
+#define ASIO_EXPERIMENTAL_BASIC_SOCKET_ACCEPTOR_GROUP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <vector>
+#include "asio/any_io_executor.hpp"
+#include "asio/basic_socket_acceptor.hpp"
+#include "asio/detail/socket_option.hpp"
+#include "asio/detail/socket_types.hpp"
+#include "asio/detail/throw_error.hpp"
+#include "asio/error.hpp"
+#include "asio/socket_base.hpp"
+
+#if defined(__linux__)
+# include <linux/filter.h>
+#endif // defined(__linux__)
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace experimental {
+namespace detail {
+
+#if defined(SO_REUSEPORT)
+typedef asio::detail::socket_option::boolean<
+  ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT> reuse_port;
+#else // defined(SO_REUSEPORT)
+typedef asio::detail::socket_option::boolean<0, 0> reuse_port;
+#endif // defined(SO_REUSEPORT)
+
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+
+// Socket option that attaches a classic BPF program to a SO_REUSEPORT group.
+// The program selects the group member whose index is the number of the CPU
+// that is processing the incoming packet, modulo the size of the group.
+class reuseport_cpu_steering
+{
+public:
+  explicit reuseport_cpu_steering(std::size_t group_size)
+  {
+    sock_filter code[] =
+    {
+      { BPF_LD | BPF_W | BPF_ABS, 0, 0,
+        static_cast<__u32>(SKF_AD_OFF + SKF_AD_CPU) },
+      { BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<__u32>(group_size) },
+      { BPF_RET | BPF_A, 0, 0, 0 }
+    };
+
+    for (int i = 0; i < 3; ++i)
+      code_[i] = code[i];
+
+    program_.len = 3;
+    program_.filter = code_;
+  }
+
+  template <typename Protocol>
+  int level(const Protocol&) const
+  {
+    return SOL_SOCKET;
+  }
+
+  template <typename Protocol>
+  int name(const Protocol&) const
+  {
+    return SO_ATTACH_REUSEPORT_CBPF;
+  }
+
+  template <typename Protocol>
+  const sock_fprog* data(const Protocol&) const
+  {
+    return &program_;
+  }
+
+  template <typename Protocol>
+  std::size_t size(const Protocol&) const
+  {
+    return sizeof(program_);
+  }
+
+private:
+  sock_filter code_[3];
+  sock_fprog program_;
+};
+
+#endif // defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+
+} // namespace detail
+
+/// Provides a group of acceptors that listen on the same endpoint.
+/**
+ * The basic_socket_acceptor_group class template manages a set of socket
+ * acceptors that are all bound to the same local endpoint using the
+ * @c SO_REUSEPORT socket option. Each acceptor in the group is associated with
+ * a different I/O executor. This allows an application that runs one
+ * @c io_context per core to have each context accept its own connections,
+ * with incoming connections distributed across the group by the operating
+ * system.
+ *
+ * The acceptors in the group are ordinary @c basic_socket_acceptor objects,
+ * and are accessed by index. For example:
+ *
+ * @code std::vector<asio::io_context> contexts(4);
+ * std::vector<asio::any_io_executor> executors;
+ * for (auto& ctx : contexts)
+ *   executors.push_back(ctx.get_executor());
+ *
+ * asio::experimental::basic_socket_acceptor_group<asio::ip::tcp> group(
+ *     executors.begin(), executors.end(),
+ *     asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 8080));
+ *
+ * for (std::size_t i = 0; i < group.size(); ++i)
+ *   start_accept(group[i]); @endcode
+ *
+ * On Linux, the group may additionally be configured to steer each incoming
+ * connection to the acceptor whose index matches the CPU on which the
+ * connection was received. See attach_cpu_steering().
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * Once the group has been opened, each acceptor in the group may be used from
+ * the threads that run its associated executor, subject to the thread safety
+ * rules of @c basic_socket_acceptor.
+ */
+template <typename Protocol, typename Executor = any_io_executor>
+class basic_socket_acceptor_group
+{
+public:
+  /// The type of the executor associated with the acceptors.
+  typedef Executor executor_type;
+
+  /// Rebinds the acceptor group type to another executor.
+  template <typename Executor1>
+  struct rebind_executor
+  {
+    /// The acceptor group type when rebound to the specified executor.
+    typedef basic_socket_acceptor_group<Protocol, Executor1> other;
+  };
+
+  /// The protocol type.
+  typedef Protocol protocol_type;
+
+  /// The endpoint type.
+  typedef typename Protocol::endpoint endpoint_type;
+
+  /// The type of the acceptors in the group.
+  typedef basic_socket_acceptor<Protocol, Executor> acceptor_type;
+
+  /// An iterator over the acceptors in the group.
+  typedef typename std::vector<acceptor_type>::iterator iterator;
+
+  /// A const iterator over the acceptors in the group.
+  typedef typename std::vector<acceptor_type>::const_iterator const_iterator;
+
+  /// Socket option to allow multiple sockets to bind to the same address and
+  /// port.
+  /**
+   * Implements the SOL_SOCKET/SO_REUSEPORT socket option, where supported.
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined reuse_port;
+#else
+  typedef detail::reuse_port reuse_port;
+#endif
+
+  /// Construct an acceptor group without opening it.
+  basic_socket_acceptor_group() noexcept
+  {
+  }
+
+  /// Construct an acceptor group and open it on the specified endpoint.
+  /**
+   * This constructor creates one acceptor per executor in the range
+   * <tt>[first, last)</tt>, and binds every acceptor to the specified
+   * endpoint using @c SO_REUSEPORT. This constructor is equivalent to the
+   * following code:
+   * @code basic_socket_acceptor_group<Protocol> group;
+   * group.open(first, last, endpoint, backlog); @endcode
+   *
+   * @param first An iterator to the first executor in a range. Each element
+   * of the range must be convertible to @c executor_type.
+   *
+   * @param last An iterator to the end of the range of executors.
+   *
+   * @param endpoint The local endpoint on which all acceptors will listen. If
+   * the endpoint's port is zero, the port chosen by the operating system for
+   * the first acceptor is used for the remainder of the group.
+   *
+   * @param backlog The maximum length of the queue of pending connections for
+   * each acceptor.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename ExecutorIterator>
+  basic_socket_acceptor_group(ExecutorIterator first, ExecutorIterator last,
+      const endpoint_type& endpoint,
+      int backlog = socket_base::max_listen_connections)
+  {
+    asio::error_code ec;
+    open(first, last, endpoint, backlog, ec);
+    asio::detail::throw_error(ec, "open");
+  }
+
+  /// Move-construct an acceptor group from another.
+  basic_socket_acceptor_group(basic_socket_acceptor_group&& other) noexcept
+    : acceptors_(static_cast<std::vector<acceptor_type>&&>(other.acceptors_))
+  {
+  }
+
+  /// Move-assign an acceptor group from another.
+  basic_socket_acceptor_group& operator=(
+      basic_socket_acceptor_group&& other) noexcept
+  {
+    acceptors_ = static_cast<std::vector<acceptor_type>&&>(other.acceptors_);
+    return *this;
+  }
+
+  /// Destroys the acceptor group.
+  /**
+   * Closes all acceptors in the group, as if by calling close().
+   */
+  ~basic_socket_acceptor_group()
+  {
+  }
+
+  /// Open the acceptor group on the specified endpoint.
+  /**
+   * This function creates one acceptor per executor in the range
+   * <tt>[first, last)</tt>. Each acceptor is opened, has the @c reuse_address
+   * and @c reuse_port options set, and is then bound to the specified
+   * endpoint and placed into the listening state.
+   *
+   * @param first An iterator to the first executor in a range. Each element
+   * of the range must be convertible to @c executor_type.
+   *
+   * @param last An iterator to the end of the range of executors.
+   *
+   * @param endpoint The local endpoint on which all acceptors will listen.
+   *
+   * @param backlog The maximum length of the queue of pending connections for
+   * each acceptor.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename ExecutorIterator>
+  void open(ExecutorIterator first, ExecutorIterator last,
+      const endpoint_type& endpoint,
+      int backlog = socket_base::max_listen_connections)
+  {
+    asio::error_code ec;
+    open(first, last, endpoint, backlog, ec);
+    asio::detail::throw_error(ec, "open");
+  }
+
+  /// Open the acceptor group on the specified endpoint.
+  /**
+   * This function creates one acceptor per executor in the range
+   * <tt>[first, last)</tt>. Each acceptor is opened, has the @c reuse_address
+   * and @c reuse_port options set, and is then bound to the specified
+   * endpoint and placed into the listening state.
+   *
+   * @param first An iterator to the first executor in a range. Each element
+   * of the range must be convertible to @c executor_type.
+   *
+   * @param last An iterator to the end of the range of executors.
+   *
+   * @param endpoint The local endpoint on which all acceptors will listen.
+   *
+   * @param backlog The maximum length of the queue of pending connections for
+   * each acceptor.
+   *
+   * @param ec Set to indicate what error occurred, if any. On failure, the
+   * group is left closed.
+   */
+  template <typename ExecutorIterator>
+  ASIO_SYNC_OP_VOID open(ExecutorIterator first, ExecutorIterator last,
+      const endpoint_type& endpoint, int backlog, asio::error_code& ec)
+  {
+    if (!acceptors_.empty())
+    {
+      ec = asio::error::already_open;
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+#if defined(SO_REUSEPORT)
+    std::vector<acceptor_type> acceptors;
+    endpoint_type group_endpoint(endpoint);
+    for (; first != last; ++first)
+    {
+      const executor_type ex(*first);
+      acceptor_type acceptor(ex);
+      acceptor.open(group_endpoint.protocol(), ec);
+      if (!ec)
+        acceptor.set_option(socket_base::reuse_address(true), ec);
+      if (!ec)
+        acceptor.set_option(reuse_port(true), ec);
+      if (!ec)
+        acceptor.bind(group_endpoint, ec);
+      if (!ec && acceptors.empty())
+        group_endpoint = acceptor.local_endpoint(ec);
+      if (!ec)
+        acceptor.listen(backlog, ec);
+      if (ec)
+        ASIO_SYNC_OP_VOID_RETURN(ec);
+      acceptors.push_back(static_cast<acceptor_type&&>(acceptor));
+    }
+
+    acceptors_.swap(acceptors);
+    ec = asio::error_code();
+#else // defined(SO_REUSEPORT)
+    (void)first;
+    (void)last;
+    (void)endpoint;
+    (void)backlog;
+    ec = asio::error::operation_not_supported;
+#endif // defined(SO_REUSEPORT)
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Steer incoming connections to acceptors according to the receiving CPU.
+  /**
+   * This function attaches a classic BPF program to the group's
+   * @c SO_REUSEPORT group using @c SO_ATTACH_REUSEPORT_CBPF. The program
+   * selects the acceptor at index <tt>cpu % size()</tt>, where @c cpu is the
+   * number of the CPU that processed the incoming connection request.
+   *
+   * For this to keep connections on the core that received them, the thread
+   * that runs the executor for acceptor @c i should be pinned to CPU @c i, and
+   * network interrupts should be distributed across the same set of CPUs.
+   *
+   * @throws asio::system_error Thrown on failure. The error
+   * asio::error::operation_not_supported is reported on platforms that do
+   * not support @c SO_ATTACH_REUSEPORT_CBPF.
+   */
+  void attach_cpu_steering()
+  {
+    asio::error_code ec;
+    attach_cpu_steering(ec);
+    asio::detail::throw_error(ec, "attach_cpu_steering");
+  }
+
+  /// Steer incoming connections to acceptors according to the receiving CPU.
+  /**
+   * This function attaches a classic BPF program to the group's
+   * @c SO_REUSEPORT group using @c SO_ATTACH_REUSEPORT_CBPF. The program
+   * selects the acceptor at index <tt>cpu % size()</tt>, where @c cpu is the
+   * number of the CPU that processed the incoming connection request.
+   *
+   * @param ec Set to indicate what error occurred, if any. The error
+   * asio::error::operation_not_supported is reported on platforms that do
+   * not support @c SO_ATTACH_REUSEPORT_CBPF.
+   */
+  ASIO_SYNC_OP_VOID attach_cpu_steering(asio::error_code& ec)
+  {
+    if (acceptors_.empty())
+    {
+      ec = asio::error::bad_descriptor;
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+#if defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+    acceptors_.front().set_option(
+        detail::reuseport_cpu_steering(acceptors_.size()), ec);
+#else // defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+    ec = asio::error::operation_not_supported;
+#endif // defined(SO_ATTACH_REUSEPORT_CBPF) && defined(SKF_AD_CPU)
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Determine whether the acceptor group is open.
+  bool is_open() const noexcept
+  {
+    return !acceptors_.empty();
+  }
+
+  /// Get the number of acceptors in the group.
+  std::size_t size() const noexcept
+  {
+    return acceptors_.size();
+  }
+
+  /// Get the acceptor at the specified index.
+  acceptor_type& operator[](std::size_t i)
+  {
+    return acceptors_[i];
+  }
+
+  /// Get the acceptor at the specified index.
+  const acceptor_type& operator[](std::size_t i) const
+  {
+    return acceptors_[i];
+  }
+
+  /// Get an iterator to the first acceptor in the group.
+  iterator begin() noexcept
+  {
+    return acceptors_.begin();
+  }
+
+  /// Get an iterator to the first acceptor in the group.
+  const_iterator begin() const noexcept
+  {
+    return acceptors_.begin();
+  }
+
+  /// Get an iterator to the end of the group.
+  iterator end() noexcept
+  {
+    return acceptors_.end();
+  }
+
+  /// Get an iterator to the end of the group.
+  const_iterator end() const noexcept
+  {
+    return acceptors_.end();
+  }
+
+  /// Get the local endpoint shared by the acceptors in the group.
+  /**
+   * @throws asio::system_error Thrown on failure.
+   */
+  endpoint_type local_endpoint() const
+  {
+    asio::error_code ec;
+    endpoint_type ep = local_endpoint(ec);
+    asio::detail::throw_error(ec, "local_endpoint");
+    return ep;
+  }
+
+  /// Get the local endpoint shared by the acceptors in the group.
+  /**
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns An object that represents the local endpoint of the group.
+   * Returns a default-constructed endpoint object if an error occurred.
+   */
+  endpoint_type local_endpoint(asio::error_code& ec) const
+  {
+    if (acceptors_.empty())
+    {
+      ec = asio::error::bad_descriptor;
+      return endpoint_type();
+    }
+    return acceptors_.front().local_endpoint(ec);
+  }
+
+  /// Cancel all asynchronous operations associated with the group.
+  /**
+   * This function causes all outstanding asynchronous accept operations on
+   * every acceptor in the group to finish immediately, and the handlers for
+   * cancelled operations will be passed the asio::error::operation_aborted
+   * error.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void cancel()
+  {
+    asio::error_code ec;
+    cancel(ec);
+    asio::detail::throw_error(ec, "cancel");
+  }
+
+  /// Cancel all asynchronous operations associated with the group.
+  /**
+   * This function causes all outstanding asynchronous accept operations on
+   * every acceptor in the group to finish immediately, and the handlers for
+   * cancelled operations will be passed the asio::error::operation_aborted
+   * error.
+   *
+   * @param ec Set to indicate what error occurred, if any. If an error occurs
+   * for more than one acceptor, the first error is reported.
+   */
+  ASIO_SYNC_OP_VOID cancel(asio::error_code& ec)
+  {
+    ec = asio::error_code();
+    for (std::size_t i = 0; i < acceptors_.size(); ++i)
+    {
+      asio::error_code acceptor_ec;
+      acceptors_[i].cancel(acceptor_ec);
+      if (acceptor_ec && !ec)
+        ec = acceptor_ec;
+    }
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Close the acceptor group.
+  /**
+   * This function closes and destroys every acceptor in the group. Any
+   * asynchronous accept operations will be cancelled immediately.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void close()
+  {
+    asio::error_code ec;
+    close(ec);
+    asio::detail::throw_error(ec, "close");
+  }
+
+  /// Close the acceptor group.
+  /**
+   * This function closes and destroys every acceptor in the group. Any
+   * asynchronous accept operations will be cancelled immediately.
+   *
+   * @param ec Set to indicate what error occurred, if any. If an error occurs
+   * for more than one acceptor, the first error is reported.
+   */
+  ASIO_SYNC_OP_VOID close(asio::error_code& ec)
+  {
+    ec = asio::error_code();
+    for (std::size_t i = 0; i < acceptors_.size(); ++i)
+    {
+      asio::error_code acceptor_ec;
+      acceptors_[i].close(acceptor_ec);
+      if (acceptor_ec && !ec)
+        ec = acceptor_ec;
+    }
+    acceptors_.clear();
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+private:
+  // Disallow copying and assignment.
+  basic_socket_acceptor_group(
+      const basic_socket_acceptor_group&) = delete;
+  basic_socket_acceptor_group& operator=(
+      const basic_socket_acceptor_group&) = delete;
+
+  // The acceptors in the group, in the order in which they were bound.
+  std::vector<acceptor_type> acceptors_;
+};
+
+} // namespace experimental
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_EXPERIMENTAL_BASIC_SOCKET_ACCEPTOR_GROUP_HPP
@@ -63,6 +63,11 @@ public:
   /// Open the file so that write operations automatically synchronise the file
   /// data and metadata to disk.
   static const flags sync_all_on_write = implementation_defined;
+
+  /// Open the file so that reads and writes bypass the operating system's page
+  /// cache, where supported. Buffers, sizes and offsets should be multiples of
+  /// the file's alignment().
+  static const flags direct = implementation_defined;
 #else
   enum flags
   {
@@ -74,7 +79,8 @@ public:
     create = 16,
     exclusive = 32,
     truncate = 64,
-    sync_all_on_write = 128
+    sync_all_on_write = 128,
+    direct = 256
 #else // defined(ASIO_WINDOWS)
     read_only = O_RDONLY,
     write_only = O_WRONLY,
@@ -83,7 +89,12 @@ public:
     create = O_CREAT,
     exclusive = O_EXCL,
     truncate = O_TRUNC,
-    sync_all_on_write = O_SYNC
+    sync_all_on_write = O_SYNC,
+# if defined(O_DIRECT)
+    direct = O_DIRECT
+# else // defined(O_DIRECT)
+    direct = 0
+# endif // defined(O_DIRECT)
 #endif // defined(ASIO_WINDOWS)
   };
 
@@ -0,0 +1,129 @@
+//
+// file_request.hpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_FILE_REQUEST_HPP
+#define ASIO_FILE_REQUEST_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_FILE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include "asio/buffer.hpp"
+#include "asio/error_code.hpp"
+#include "asio/detail/cstdint.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// A single request within a batch of random-access file operations.
+/**
+ * The basic_file_request class template describes one read or write of a
+ * batch passed to basic_random_access_file::read_batch_at,
+ * basic_random_access_file::write_batch_at or their asynchronous
+ * counterparts. When the batch completes, each request holds the result of
+ * its own operation.
+ *
+ * Each request performs a single read_some_at or write_some_at operation, and
+ * so may transfer fewer bytes than the size of its buffer.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+template <typename Buffer>
+class basic_file_request
+{
+public:
+  /// The type of the buffer used by the request.
+  typedef Buffer buffer_type;
+
+  /// Default constructor.
+  basic_file_request() noexcept
+    : offset_(0),
+      buffer_(),
+      error_(),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Construct a request for the specified offset and buffer.
+  basic_file_request(uint64_t offset, const Buffer& buffer) noexcept
+    : offset_(offset),
+      buffer_(buffer),
+      error_(),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Get the offset at which the data is to be transferred.
+  uint64_t offset() const noexcept
+  {
+    return offset_;
+  }
+
+  /// Get the buffer used by the request.
+  const Buffer& buffer() const noexcept
+  {
+    return buffer_;
+  }
+
+  /// Get the error that resulted from the request, if any.
+  const asio::error_code& error() const noexcept
+  {
+    return error_;
+  }
+
+  /// Get the number of bytes transferred by the request.
+  std::size_t bytes_transferred() const noexcept
+  {
+    return bytes_transferred_;
+  }
+
+  /// Set the result of the request.
+  /**
+   * This function is called by the implementation when the request completes.
+   */
+  void set_result(const asio::error_code& ec,
+      std::size_t bytes_transferred) noexcept
+  {
+    error_ = ec;
+    bytes_transferred_ = bytes_transferred;
+  }
+
+private:
+  uint64_t offset_;
+  Buffer buffer_;
+  asio::error_code error_;
+  std::size_t bytes_transferred_;
+};
+
+/// A request to read from a random-access file at a given offset.
+typedef basic_file_request<mutable_buffer> file_read_request;
+
+/// A request to write to a random-access file at a given offset.
+typedef basic_file_request<const_buffer> file_write_request;
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_FILE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_FILE_REQUEST_HPP
@@ -0,0 +1,157 @@
+//
+// handler_allocation_stats.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_HANDLER_ALLOCATION_STATS_HPP
+#define ASIO_HANDLER_ALLOCATION_STATS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include "asio/detail/handler_allocation_counters.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// A snapshot of the memory allocated for asynchronous operations.
+/**
+ * When no other allocator is associated with a completion handler, the
+ * memory for the asynchronous operation, and for other internal objects such
+ * as coroutine frames, is obtained from a per-thread recycling cache. The
+ * handler_allocation_stats class describes how that memory has been used,
+ * with separate counters for each purpose, to help find allocation hotspots
+ * and size the cache.
+ *
+ * The counters are only maintained when the program is compiled with
+ * @c ASIO_ENABLE_HANDLER_ALLOCATION_STATS defined. Otherwise, they are always
+ * zero. The counters cover every thread in the program.
+ *
+ * @par Example
+ * @code asio::handler_allocation_stats stats =
+ *   asio::handler_allocation_stats::current();
+ * const asio::handler_allocation_stats::counters& c =
+ *   stats.get(asio::handler_allocation_stats::operation);
+ * std::cout << c.hits << " hits, " << c.misses << " misses, "
+ *   << c.high_water_bytes << " bytes at peak\n"; @endcode
+ */
+class handler_allocation_stats
+{
+public:
+  /// The purposes for which memory is allocated.
+  enum purpose
+  {
+    /// Asynchronous operations and their completion handlers.
+    operation,
+
+    /// Coroutine frames for awaitable functions.
+    awaitable_frame,
+
+    /// Function objects submitted to type-erased executors.
+    executor_function,
+
+    /// Cancellation signal handlers.
+    cancellation_signal,
+
+    /// State for experimental::parallel_group operations.
+    parallel_group,
+
+    /// State for cancel_after and cancel_at operations.
+    timed_cancel
+  };
+
+  /// The number of distinct purposes.
+  static constexpr int purpose_count = timed_cancel + 1;
+
+  /// The counters for a single purpose.
+  struct counters
+  {
+    /// The number of allocations satisfied by the thread's cache.
+    std::size_t hits;
+
+    /// The number of allocations that were passed to the system allocator.
+    std::size_t misses;
+
+    /// The total number of bytes requested.
+    std::size_t bytes;
+
+    /// The number of bytes currently allocated.
+    std::size_t outstanding_bytes;
+
+    /// The largest number of bytes allocated at any one time.
+    std::size_t high_water_bytes;
+
+    /// The size of the largest single request.
+    std::size_t largest_request;
+  };
+
+  /// Construct a snapshot where all counters are zero.
+  handler_allocation_stats() noexcept
+  {
+    for (int i = 0; i < purpose_count; ++i)
+    {
+      counters_[i].hits = 0;
+      counters_[i].misses = 0;
+      counters_[i].bytes = 0;
+      counters_[i].outstanding_bytes = 0;
+      counters_[i].high_water_bytes = 0;
+      counters_[i].largest_request = 0;
+    }
+  }
+
+  /// Obtain a snapshot of the current values of the counters.
+  /**
+   * The counters are sampled without synchronisation, and may be updated by
+   * other threads while the snapshot is being taken.
+   */
+  static handler_allocation_stats current() noexcept
+  {
+    handler_allocation_stats stats;
+    const detail::handler_allocation_counters& source =
+      detail::handler_allocation_counters::instance();
+    for (int i = 0; i < purpose_count; ++i)
+    {
+      const detail::handler_allocation_counters::entry& e = source.get(i);
+      counters& c = stats.counters_[i];
+      c.hits = e.hits_.load(std::memory_order_relaxed);
+      c.misses = e.misses_.load(std::memory_order_relaxed);
+      c.bytes = e.bytes_.load(std::memory_order_relaxed);
+      c.outstanding_bytes = e.outstanding_bytes_.load(
+          std::memory_order_relaxed);
+      c.high_water_bytes = e.high_water_bytes_.load(
+          std::memory_order_relaxed);
+      c.largest_request = e.largest_request_.load(std::memory_order_relaxed);
+    }
+    return stats;
+  }
+
+  /// Get the counters for the specified purpose.
+  const counters& get(purpose p) const noexcept
+  {
+    return counters_[p];
+  }
+
+private:
+  static_assert(purpose_count
+      == detail::handler_allocation_counters::num_purposes,
+      "purpose_count must match the number of internal counters");
+
+  counters counters_[purpose_count];
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_HANDLER_ALLOCATION_STATS_HPP
@@ -19,8 +19,10 @@
 #include <exception>
 #include <new>
 #include <tuple>
+#include "asio/associated_immediate_executor.hpp"
 #include "asio/cancellation_signal.hpp"
 #include "asio/cancellation_state.hpp"
+#include "asio/detail/call_stack.hpp"
 #include "asio/detail/memory.hpp"
 #include "asio/detail/thread_context.hpp"
 #include "asio/detail/thread_info_base.hpp"
@@ -28,7 +30,9 @@
 #include "asio/detail/type_traits.hpp"
 #include "asio/disposition.hpp"
 #include "asio/error.hpp"
+#include "asio/execution/blocking.hpp"
 #include "asio/post.hpp"
+#include "asio/require.hpp"
 #include "asio/system_error.hpp"
 #include "asio/this_coro.hpp"
 
@@ -401,6 +405,61 @@ public:
     return result{this, throw_if_cancelled.value};
   }
 
+  // This await transformation determines how many consecutive immediate
+  // completions may resume the thread of execution inline.
+  auto await_transform(this_coro::immediate_resumption_limit_0_t)
+    noexcept
+  {
+    struct result
+    {
+      awaitable_frame_base* this_;
+
+      bool await_ready() const noexcept
+      {
+        return true;
+      }
+
+      void await_suspend(coroutine_handle<void>) noexcept
+      {
+      }
+
+      auto await_resume()
+      {
+        return this_->attached_thread_->immediate_resumption_limit();
+      }
+    };
+
+    return result{this};
+  }
+
+  // This await transformation sets how many consecutive immediate completions
+  // may resume the thread of execution inline.
+  auto await_transform(this_coro::immediate_resumption_limit_1_t limit)
+    noexcept
+  {
+    struct result
+    {
+      awaitable_frame_base* this_;
+      std::size_t value_;
+
+      bool await_ready() const noexcept
+      {
+        return true;
+      }
+
+      void await_suspend(coroutine_handle<void>) noexcept
+      {
+      }
+
+      auto await_resume()
+      {
+        this_->attached_thread_->immediate_resumption_limit(value_);
+      }
+    };
+
+    return result{this, limit.value};
+  }
+
   // This await transformation is used to run an async operation's initiation
   // function object after the coroutine has been suspended. This ensures that
   // immediate resumption of the coroutine in another thread does not cause a
@@ -612,7 +671,9 @@ public:
   awaitable_frame()
     : top_of_stack_(0),
       has_executor_(false),
-      throw_if_cancelled_(true)
+      throw_if_cancelled_(true),
+      immediate_resumption_limit_(0),
+      immediate_resumptions_(0)
   {
   }
 
@@ -658,6 +719,8 @@ private:
   asio::cancellation_state cancellation_state_;
   bool has_executor_;
   bool throw_if_cancelled_;
+  std::size_t immediate_resumption_limit_;
+  std::size_t immediate_resumptions_;
 };
 
 template <typename Executor>
@@ -667,6 +730,11 @@ public:
   typedef Executor executor_type;
   typedef cancellation_slot cancellation_slot_type;
 
+  // Records the thread that is pumping a thread of execution while it runs an
+  // asynchronous operation's initiating function.
+  typedef call_stack<awaitable_frame_base<Executor>, awaitable_thread>
+    initiating_call_stack;
+
   // Construct from the entry point of a new thread of execution.
   awaitable_thread(awaitable<awaitable_thread_entry_point, Executor> p,
       const Executor& ex, cancellation_slot parent_cancel_slot,
@@ -757,6 +825,28 @@ public:
     return bottom_of_stack_.frame_->cancellation_state_.slot();
   }
 
+  std::size_t immediate_resumption_limit() const
+  {
+    return bottom_of_stack_.frame_->immediate_resumption_limit_;
+  }
+
+  void immediate_resumption_limit(std::size_t value)
+  {
+    bottom_of_stack_.frame_->immediate_resumption_limit_ = value;
+  }
+
+  // An immediate completion is dispatched to the thread's executor, and so
+  // runs inline, only if it may be used to resume the thread immediately.
+  // Otherwise it is submitted to the I/O executor, exactly as it would be for
+  // any other completion handler.
+  template <typename IoExecutor>
+  Executor get_immediate_executor(const IoExecutor& io_ex) const noexcept
+  {
+    if (immediate_resumption_target())
+      return get_executor();
+    return asio::require(io_ex, execution::blocking.never);
+  }
+
   // Launch a new thread of execution.
   void launch()
   {
@@ -768,9 +858,29 @@ protected:
   template <typename> friend class awaitable_frame_base;
 
   // Repeatedly resume the top stack frame until the stack is empty or until it
-  // has been transferred to another resumable_thread object.
+  // has been transferred to another resumable_thread object. If this is an
+  // immediate completion within an initiating function, the stack is instead
+  // handed back to the thread that is already pumping it.
   void pump()
   {
+    awaitable_frame<awaitable_thread_entry_point, Executor>* entry =
+      bottom_of_stack_.frame_;
+    if (entry->immediate_resumption_limit_ > 0)
+    {
+      if (awaitable_thread* target = initiating_call_stack::contains(entry))
+      {
+        if (entry->immediate_resumptions_ < entry->immediate_resumption_limit_)
+        {
+          ++entry->immediate_resumptions_;
+          target->bottom_of_stack_ = std::move(bottom_of_stack_);
+          entry->top_of_stack_->attach_thread(target);
+          return;
+        }
+      }
+      else
+        entry->immediate_resumptions_ = 0;
+    }
+
     do
       bottom_of_stack_.frame_->top_of_stack_->resume();
     while (bottom_of_stack_.frame_ && bottom_of_stack_.frame_->top_of_stack_);
@@ -788,9 +898,62 @@ protected:
     static_cast<awaitable_thread*>(self)->pump();
   }
 
+  // Find the thread that is pumping this thread of execution, if we are inside
+  // one of its initiating functions and the limit on consecutive immediate
+  // resumptions has not been reached.
+  awaitable_thread* immediate_resumption_target() const noexcept
+  {
+    awaitable_frame<awaitable_thread_entry_point, Executor>* entry =
+      bottom_of_stack_.frame_;
+    if (entry->immediate_resumptions_ < entry->immediate_resumption_limit_)
+      return initiating_call_stack::contains(entry);
+    return nullptr;
+  }
+
   awaitable<awaitable_thread_entry_point, Executor> bottom_of_stack_;
 };
 
+// Determines the immediate executor for the completion handlers of a thread of
+// execution. By default this is the I/O executor with blocking.never, as for
+// any other completion handler.
+template <typename Executor, typename IoExecutor, typename = void>
+struct awaitable_thread_immediate_executor
+{
+  typedef typename default_immediate_executor<IoExecutor>::type type;
+
+  static auto get(const awaitable_thread<Executor>&,
+      const IoExecutor& io_ex) noexcept
+    -> decltype(default_immediate_executor<IoExecutor>::get(io_ex))
+  {
+    return default_immediate_executor<IoExecutor>::get(io_ex);
+  }
+};
+
+// When the I/O executor with blocking.never has the same type as the thread's
+// executor, an immediate completion may instead be dispatched to the thread's
+// executor so that it resumes the thread inline.
+template <typename Executor, typename IoExecutor>
+struct awaitable_thread_immediate_executor<Executor, IoExecutor,
+    enable_if_t<
+      is_same<
+        decay_t<require_result_t<IoExecutor, execution::blocking_t::never_t>>,
+        Executor
+      >::value
+      && is_same<
+        decay_t<require_result_t<Executor, execution::blocking_t::never_t>>,
+        Executor
+      >::value
+    >>
+{
+  typedef Executor type;
+
+  static type get(const awaitable_thread<Executor>& t,
+      const IoExecutor& io_ex) noexcept
+  {
+    return t.get_immediate_executor(io_ex);
+  }
+};
+
 template <typename Signature, typename Executor, typename = void>
 class awaitable_async_op_handler;
 
@@ -1048,8 +1211,10 @@ public:
               self->location_.line(), self->location_.function_name()));
 # endif // defined(ASIO_HAS_SOURCE_LOCATION)
 #endif // defined(ASIO_ENABLE_HANDLER_TRACKING)
-          std::forward<Op&&>(self->op_)(
-              handler_type(self->frame_->detach_thread(), self->result_));
+          awaitable_thread<Executor>* thread = self->frame_->detach_thread();
+          typename awaitable_thread<Executor>::initiating_call_stack::context
+            ctx(thread->entry_point(), *thread);
+          std::forward<Op&&>(self->op_)(handler_type(thread, self->result_));
         }, this);
   }
 
@@ -1070,6 +1235,18 @@ private:
 };
 
 } // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <typename Signature, typename Executor, typename IoExecutor>
+struct associated_immediate_executor<
+    detail::awaitable_async_op_handler<Signature, Executor>, IoExecutor>
+  : detail::awaitable_thread_immediate_executor<Executor, IoExecutor>
+{
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
 ASIO_INLINE_NAMESPACE_END
 } // namespace asio
 
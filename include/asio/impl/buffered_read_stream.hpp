@@ -33,11 +33,16 @@ std::size_t buffered_read_stream<Stream>::fill()
     resize_guard(storage_);
   std::size_t previous_size = storage_.size();
   storage_.resize(storage_.capacity());
-  storage_.resize(previous_size + next_layer_.read_some(buffer(
-          storage_.data() + previous_size,
-          storage_.size() - previous_size)));
+  std::size_t available = storage_.size() - previous_size;
+  std::size_t bytes_transferred = storage_.is_registered()
+    ? next_layer_.read_some(
+        storage_.registered_data(previous_size, available))
+    : next_layer_.read_some(
+        buffer(storage_.data() + previous_size, available));
+  storage_.resize(previous_size + bytes_transferred);
+  storage_.record_transfer(available, bytes_transferred);
   resize_guard.commit();
-  return storage_.size() - previous_size;
+  return bytes_transferred;
 }
 
 template <typename Stream>
@@ -47,12 +52,16 @@ std::size_t buffered_read_stream<Stream>::fill(asio::error_code& ec)
     resize_guard(storage_);
   std::size_t previous_size = storage_.size();
   storage_.resize(storage_.capacity());
-  storage_.resize(previous_size + next_layer_.read_some(buffer(
-          storage_.data() + previous_size,
-          storage_.size() - previous_size),
-        ec));
+  std::size_t available = storage_.size() - previous_size;
+  std::size_t bytes_transferred = storage_.is_registered()
+    ? next_layer_.read_some(
+        storage_.registered_data(previous_size, available), ec)
+    : next_layer_.read_some(
+        buffer(storage_.data() + previous_size, available), ec);
+  storage_.resize(previous_size + bytes_transferred);
+  storage_.record_transfer(available, bytes_transferred);
   resize_guard.commit();
-  return storage_.size() - previous_size;
+  return bytes_transferred;
 }
 
 namespace detail
@@ -86,7 +95,9 @@ namespace detail
     void operator()(const asio::error_code& ec,
         const std::size_t bytes_transferred)
     {
+      std::size_t available = storage_.capacity() - previous_size_;
       storage_.resize(previous_size_ + bytes_transferred);
+      storage_.record_transfer(available, bytes_transferred);
       static_cast<ReadHandler&&>(handler_)(ec, bytes_transferred);
     }
 
@@ -133,12 +144,21 @@ namespace detail
       non_const_lvalue<ReadHandler> handler2(handler);
       std::size_t previous_size = storage->size();
       storage->resize(storage->capacity());
-      next_layer_.async_read_some(
-          buffer(
-            storage->data() + previous_size,
-            storage->size() - previous_size),
-          buffered_fill_handler<decay_t<ReadHandler>>(
-            *storage, previous_size, handler2.value));
+      std::size_t available = storage->size() - previous_size;
+      if (storage->is_registered())
+      {
+        next_layer_.async_read_some(
+            storage->registered_data(previous_size, available),
+            buffered_fill_handler<decay_t<ReadHandler>>(
+              *storage, previous_size, handler2.value));
+      }
+      else
+      {
+        next_layer_.async_read_some(
+            buffer(storage->data() + previous_size, available),
+            buffered_fill_handler<decay_t<ReadHandler>>(
+              *storage, previous_size, handler2.value));
+      }
     }
 
   private:
@@ -28,8 +28,11 @@ ASIO_INLINE_NAMESPACE_BEGIN
 template <typename Stream>
 std::size_t buffered_write_stream<Stream>::flush()
 {
-  std::size_t bytes_written = write(next_layer_,
-      buffer(storage_.data(), storage_.size()));
+  std::size_t available = storage_.capacity();
+  std::size_t bytes_written = storage_.is_registered()
+    ? write(next_layer_, storage_.registered_data(0, storage_.size()))
+    : write(next_layer_, buffer(storage_.data(), storage_.size()));
+  storage_.record_transfer(available, bytes_written);
   storage_.consume(bytes_written);
   return bytes_written;
 }
@@ -37,9 +40,13 @@ std::size_t buffered_write_stream<Stream>::flush()
 template <typename Stream>
 std::size_t buffered_write_stream<Stream>::flush(asio::error_code& ec)
 {
-  std::size_t bytes_written = write(next_layer_,
-      buffer(storage_.data(), storage_.size()),
-      transfer_all(), ec);
+  std::size_t available = storage_.capacity();
+  std::size_t bytes_written = storage_.is_registered()
+    ? write(next_layer_, storage_.registered_data(0, storage_.size()),
+        transfer_all(), ec)
+    : write(next_layer_, buffer(storage_.data(), storage_.size()),
+        transfer_all(), ec);
+  storage_.record_transfer(available, bytes_written);
   storage_.consume(bytes_written);
   return bytes_written;
 }
@@ -72,6 +79,7 @@ namespace detail
     void operator()(const asio::error_code& ec,
         const std::size_t bytes_written)
     {
+      storage_.record_transfer(storage_.capacity(), bytes_written);
       storage_.consume(bytes_written);
       static_cast<WriteHandler&&>(handler_)(ec, bytes_written);
     }
@@ -116,9 +124,19 @@ namespace detail
       ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
 
       non_const_lvalue<WriteHandler> handler2(handler);
-      async_write(next_layer_, buffer(storage->data(), storage->size()),
-          buffered_flush_handler<decay_t<WriteHandler>>(
-            *storage, handler2.value));
+      if (storage->is_registered())
+      {
+        async_write(next_layer_,
+            storage->registered_data(0, storage->size()),
+            buffered_flush_handler<decay_t<WriteHandler>>(
+              *storage, handler2.value));
+      }
+      else
+      {
+        async_write(next_layer_, buffer(storage->data(), storage->size()),
+            buffered_flush_handler<decay_t<WriteHandler>>(
+              *storage, handler2.value));
+      }
     }
 
   private:
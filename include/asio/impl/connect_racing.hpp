@@ -0,0 +1,387 @@
+//
+// impl/connect_racing.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_CONNECT_RACING_HPP
+#define ASIO_IMPL_CONNECT_RACING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <memory>
+#include <vector>
+#include "asio/associated_allocator.hpp"
+#include "asio/associated_cancellation_slot.hpp"
+#include "asio/associated_executor.hpp"
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/cancellation_type.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+#include "asio/post.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+namespace detail
+{
+  // The state shared by all of the attempts in a connection race.
+  template <typename Protocol, typename Executor, typename Handler>
+  class connect_racing_state
+  {
+  public:
+    typedef typename Protocol::endpoint endpoint_type;
+
+    typedef basic_waitable_timer<std::chrono::steady_clock,
+        wait_traits<std::chrono::steady_clock>, Executor> timer_type;
+
+    // The socket type used for each attempt. The basic_socket destructor is
+    // protected, so a derived type is needed to hold sockets by value.
+    class attempt_socket : public basic_socket<Protocol, Executor>
+    {
+    public:
+      explicit attempt_socket(const Executor& ex)
+        : basic_socket<Protocol, Executor>(ex)
+      {
+      }
+
+      attempt_socket(attempt_socket&& other) noexcept
+        : basic_socket<Protocol, Executor>(
+            static_cast<basic_socket<Protocol, Executor>&&>(other))
+      {
+      }
+    };
+
+    // The intermediate completion handler for attempts and timer waits.
+    class attempt_handler
+    {
+    public:
+      typedef associated_executor_t<Handler, Executor> executor_type;
+      typedef associated_allocator_t<Handler> allocator_type;
+
+      attempt_handler(const std::shared_ptr<connect_racing_state>& state,
+          bool is_timer, std::size_t value)
+        : state_(state),
+          is_timer_(is_timer),
+          value_(value)
+      {
+      }
+
+      executor_type get_executor() const noexcept
+      {
+        return (get_associated_executor)(state_->handler_,
+            state_->socket_.get_executor());
+      }
+
+      allocator_type get_allocator() const noexcept
+      {
+        return (get_associated_allocator)(state_->handler_);
+      }
+
+      void operator()(const asio::error_code& ec)
+      {
+        if (is_timer_)
+          state_->on_timer(state_, value_, ec);
+        else
+          state_->on_connect(state_, value_, ec);
+      }
+
+    private:
+      std::shared_ptr<connect_racing_state> state_;
+      bool is_timer_;
+      std::size_t value_;
+    };
+
+    // Closes all attempts when the operation is cancelled.
+    class cancellation_handler
+    {
+    public:
+      explicit cancellation_handler(connect_racing_state* state)
+        : state_(state)
+      {
+      }
+
+      void operator()(cancellation_type_t type)
+      {
+        if (!!(type & (cancellation_type::terminal
+                | cancellation_type::partial
+                | cancellation_type::total)))
+        {
+          state_->cancel();
+        }
+      }
+
+    private:
+      connect_racing_state* state_;
+    };
+
+    connect_racing_state(basic_socket<Protocol, Executor>& s,
+        const std::chrono::steady_clock::duration& attempt_delay,
+        Handler& handler)
+      : socket_(s),
+        timer_(s.get_executor()),
+        attempt_delay_(attempt_delay),
+        next_(0),
+        outstanding_(0),
+        timer_generation_(0),
+        winner_(no_winner),
+        cancelled_(false),
+        handler_(static_cast<Handler&&>(handler))
+    {
+    }
+
+    // Order the endpoints so that address families alternate, starting with
+    // the family of the first endpoint, as described in RFC 8305 section 4.
+    template <typename EndpointSequence>
+    void init_endpoints(const EndpointSequence& endpoints)
+    {
+      std::vector<endpoint_type> first, rest;
+      for (auto iter = endpoints.begin(); iter != endpoints.end(); ++iter)
+      {
+        endpoint_type ep(*iter);
+        if (first.empty() || ep.protocol().family() == first.front().protocol().family())
+          first.push_back(ep);
+        else
+          rest.push_back(ep);
+      }
+
+      endpoints_.reserve(first.size() + rest.size());
+      for (std::size_t i = 0; i < first.size() || i < rest.size(); ++i)
+      {
+        if (i < first.size())
+          endpoints_.push_back(first[i]);
+        if (i < rest.size())
+          endpoints_.push_back(rest[i]);
+      }
+
+      // Attempts are never removed, so reserving space up front ensures that
+      // sockets with outstanding operations are never relocated.
+      sockets_.reserve(endpoints_.size());
+    }
+
+    void start(const std::shared_ptr<connect_racing_state>& self)
+    {
+      associated_cancellation_slot_t<Handler> slot
+        = asio::get_associated_cancellation_slot(handler_);
+      if (slot.is_connected())
+        slot.template emplace<cancellation_handler>(this);
+
+      asio::error_code ignored_ec;
+      socket_.close(ignored_ec);
+
+      mutex::scoped_lock lock(mutex_);
+      start_next(self);
+
+      if (outstanding_ == 0)
+      {
+        // No attempt was started, so post a wait that completes immediately
+        // in order to deliver the result.
+        ++outstanding_;
+        ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_connect_racing"));
+        asio::post(socket_.get_executor(),
+            detail::bind_handler(
+              attempt_handler(self, true, timer_generation_),
+              asio::error_code()));
+      }
+    }
+
+  private:
+    static const std::size_t no_winner = ~std::size_t(0);
+
+    // Start an attempt to the next endpoint, and a timer to trigger the attempt
+    // after that. Must be called with the mutex held.
+    void start_next(const std::shared_ptr<connect_racing_state>& self)
+    {
+      if (cancelled_ || next_ == endpoints_.size())
+        return;
+
+      std::size_t index = next_++;
+      sockets_.emplace_back(socket_.get_executor());
+      ++outstanding_;
+      sockets_[index].async_connect(endpoints_[index],
+          attempt_handler(self, false, index));
+
+      if (next_ < endpoints_.size())
+      {
+        // Restarting the timer cancels any outstanding wait. The generation
+        // is used to ignore a wait that had already expired.
+        ++timer_generation_;
+        timer_.expires_after(attempt_delay_);
+        ++outstanding_;
+        timer_.async_wait(attempt_handler(self, true, timer_generation_));
+      }
+      else
+      {
+        timer_.cancel();
+      }
+    }
+
+    void on_connect(const std::shared_ptr<connect_racing_state>& self,
+        std::size_t index, const asio::error_code& ec)
+    {
+      mutex::scoped_lock lock(mutex_);
+      --outstanding_;
+
+      asio::error_code ignored_ec;
+      if (winner_ == no_winner && !cancelled_)
+      {
+        if (!ec)
+        {
+          winner_ = index;
+          for (std::size_t i = 0; i < sockets_.size(); ++i)
+            if (i != index)
+              sockets_[i].close(ignored_ec);
+          timer_.cancel();
+        }
+        else
+        {
+          // A failed attempt triggers the next attempt immediately.
+          last_ec_ = ec;
+          sockets_[index].close(ignored_ec);
+          start_next(self);
+        }
+      }
+      else if (index != winner_)
+      {
+        sockets_[index].close(ignored_ec);
+      }
+
+      maybe_complete(lock);
+    }
+
+    void on_timer(const std::shared_ptr<connect_racing_state>& self,
+        std::size_t generation, const asio::error_code& ec)
+    {
+      mutex::scoped_lock lock(mutex_);
+      --outstanding_;
+
+      if (!ec && generation == timer_generation_
+          && winner_ == no_winner && !cancelled_)
+        start_next(self);
+
+      maybe_complete(lock);
+    }
+
+    void cancel()
+    {
+      mutex::scoped_lock lock(mutex_);
+      cancelled_ = true;
+      asio::error_code ignored_ec;
+      for (std::size_t i = 0; i < sockets_.size(); ++i)
+        if (i != winner_)
+          sockets_[i].close(ignored_ec);
+      timer_.cancel();
+    }
+
+    // Complete the operation once all attempts and timer waits have finished.
+    void maybe_complete(mutex::scoped_lock& lock)
+    {
+      if (outstanding_ != 0)
+        return;
+
+      asio::error_code ec;
+      endpoint_type endpoint;
+      if (winner_ != no_winner)
+      {
+        socket_ = static_cast<basic_socket<Protocol, Executor>&&>(
+            sockets_[winner_]);
+        endpoint = endpoints_[winner_];
+      }
+      else if (cancelled_)
+        ec = asio::error::operation_aborted;
+      else if (last_ec_)
+        ec = last_ec_;
+      else
+        ec = asio::error::not_found;
+
+      lock.unlock();
+
+      asio::get_associated_cancellation_slot(handler_).clear();
+
+      Handler h(static_cast<Handler&&>(handler_));
+      static_cast<Handler&&>(h)(
+          static_cast<const asio::error_code&>(ec),
+          static_cast<const endpoint_type&>(endpoint));
+    }
+
+    mutex mutex_;
+    basic_socket<Protocol, Executor>& socket_;
+    std::vector<endpoint_type> endpoints_;
+    std::vector<attempt_socket> sockets_;
+    timer_type timer_;
+    std::chrono::steady_clock::duration attempt_delay_;
+    std::size_t next_;
+    std::size_t outstanding_;
+    std::size_t timer_generation_;
+    std::size_t winner_;
+    bool cancelled_;
+    asio::error_code last_ec_;
+    Handler handler_;
+  };
+
+  template <typename Protocol, typename Executor>
+  class initiate_async_connect_racing
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_connect_racing(
+        basic_socket<Protocol, Executor>& s)
+      : socket_(s)
+    {
+    }
+
+    executor_type get_executor() const noexcept
+    {
+      return socket_.get_executor();
+    }
+
+    template <typename RangeConnectHandler, typename EndpointSequence>
+    void operator()(RangeConnectHandler&& handler,
+        const EndpointSequence& endpoints,
+        const std::chrono::steady_clock::duration& attempt_delay) const
+    {
+      // If you get an error on the following line it means that your
+      // handler does not meet the documented type requirements for an
+      // RangeConnectHandler.
+      ASIO_RANGE_CONNECT_HANDLER_CHECK(RangeConnectHandler,
+          handler, typename Protocol::endpoint) type_check;
+
+      typedef connect_racing_state<Protocol, Executor,
+        decay_t<RangeConnectHandler>> state_type;
+
+      non_const_lvalue<RangeConnectHandler> handler2(handler);
+      typename std::allocator_traits<associated_allocator_t<
+        decay_t<RangeConnectHandler>>>::template rebind_alloc<state_type>
+          alloc((get_associated_allocator)(handler2.value));
+
+      std::shared_ptr<state_type> state = std::allocate_shared<state_type>(
+          alloc, socket_, attempt_delay, handler2.value);
+      state->init_endpoints(endpoints);
+      state->start(state);
+    }
+
+  private:
+    basic_socket<Protocol, Executor>& socket_;
+  };
+} // namespace detail
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_CONNECT_RACING_HPP
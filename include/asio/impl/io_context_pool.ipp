@@ -0,0 +1,159 @@
+//
+// impl/io_context_pool.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_IO_CONTEXT_POOL_IPP
+#define ASIO_IMPL_IO_CONTEXT_POOL_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <exception>
+#include "asio/config.hpp"
+#include "asio/detail/thread.hpp"
+#include "asio/io_context_pool.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+struct io_context_pool::thread_function
+{
+  io_context* context_;
+
+  void operator()()
+  {
+#if !defined(ASIO_NO_EXCEPTIONS)
+    try
+    {
+#endif// !defined(ASIO_NO_EXCEPTIONS)
+      asio::error_code ec;
+      context_->impl_.run(ec);
+#if !defined(ASIO_NO_EXCEPTIONS)
+    }
+    catch (...)
+    {
+      std::terminate();
+    }
+#endif// !defined(ASIO_NO_EXCEPTIONS)
+  }
+};
+
+io_context_pool::io_context_pool()
+  : threads_(std::allocator<void>()),
+    next_(0),
+    joinable_(true)
+{
+  start(detail::thread::hardware_concurrency(),
+      config_from_concurrency_hint(1));
+}
+
+io_context_pool::io_context_pool(std::size_t pool_size)
+  : threads_(std::allocator<void>()),
+    next_(0),
+    joinable_(true)
+{
+  start(pool_size, config_from_concurrency_hint(1));
+}
+
+io_context_pool::io_context_pool(std::size_t pool_size,
+    const execution_context::service_maker& initial_services)
+  : threads_(std::allocator<void>()),
+    next_(0),
+    joinable_(true)
+{
+  start(pool_size, initial_services);
+}
+
+io_context_pool::~io_context_pool()
+{
+  stop();
+  join();
+
+  while (!contexts_.empty())
+    contexts_.pop_back();
+}
+
+io_context_pool::executor_type io_context_pool::get_executor() noexcept
+{
+  std::size_t n = static_cast<std::size_t>(next_++);
+  return contexts_[n % contexts_.size()]->get_executor();
+}
+
+io_context_pool::executor_type
+io_context_pool::get_least_loaded_executor() noexcept
+{
+  std::size_t first = static_cast<std::size_t>(next_++);
+  std::size_t best = first % contexts_.size();
+  long best_work = contexts_[best]->impl_.outstanding_work();
+  for (std::size_t i = 1; i < contexts_.size() && best_work > 0; ++i)
+  {
+    std::size_t index = (first + i) % contexts_.size();
+    long work = contexts_[index]->impl_.outstanding_work();
+    if (work < best_work)
+    {
+      best = index;
+      best_work = work;
+    }
+  }
+  return contexts_[best]->get_executor();
+}
+
+void io_context_pool::stop()
+{
+  for (std::size_t i = 0; i < contexts_.size(); ++i)
+    contexts_[i]->stop();
+}
+
+void io_context_pool::join()
+{
+  if (joinable_)
+  {
+    joinable_ = false;
+    for (std::size_t i = 0; i < contexts_.size(); ++i)
+      contexts_[i]->impl_.work_finished();
+    threads_.join();
+  }
+}
+
+void io_context_pool::wait()
+{
+  join();
+}
+
+void io_context_pool::start(std::size_t pool_size,
+    const execution_context::service_maker& initial_services)
+{
+  pool_size = pool_size == 0 ? 1 : pool_size;
+  contexts_.reserve(pool_size);
+  for (std::size_t i = 0; i < pool_size; ++i)
+  {
+    contexts_.push_back(
+        std::unique_ptr<io_context>(new io_context(initial_services)));
+  }
+
+  // Each context has one unit of work that is held until the pool is joined,
+  // so that its thread does not exit when it temporarily runs out of work.
+  for (std::size_t i = 0; i < pool_size; ++i)
+  {
+    contexts_[i]->impl_.work_started();
+    thread_function f = { contexts_[i].get() };
+    threads_.create_thread(f);
+  }
+}
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_IO_CONTEXT_POOL_IPP
@@ -0,0 +1,279 @@
+//
+// impl/mapped_file.ipp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_MAPPED_FILE_IPP
+#define ASIO_IMPL_MAPPED_FILE_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_MAPPED_FILE)
+
+#include <vector>
+#include "asio/mapped_file.hpp"
+
+#if defined(ASIO_WINDOWS)
+# include "asio/detail/socket_types.hpp"
+#else // defined(ASIO_WINDOWS)
+# include <errno.h>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif // defined(ASIO_WINDOWS)
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+ASIO_SYNC_OP_VOID mapped_file::open(const char* path, asio::error_code& ec)
+{
+  close(ec);
+  if (ec)
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+
+#if defined(ASIO_WINDOWS)
+  HANDLE handle = ::CreateFileA(path, GENERIC_READ,
+      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+      0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+  if (handle == INVALID_HANDLE_VALUE)
+  {
+    DWORD last_error = ::GetLastError();
+    ec.assign(last_error, asio::error::get_system_category());
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  LARGE_INTEGER file_size;
+  if (!::GetFileSizeEx(handle, &file_size))
+  {
+    DWORD last_error = ::GetLastError();
+    ::CloseHandle(handle);
+    ec.assign(last_error, asio::error::get_system_category());
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  void* data = 0;
+  if (file_size.QuadPart > 0)
+  {
+    HANDLE mapping = ::CreateFileMappingW(handle, 0, PAGE_READONLY, 0, 0, 0);
+    if (mapping == 0)
+    {
+      DWORD last_error = ::GetLastError();
+      ::CloseHandle(handle);
+      ec.assign(last_error, asio::error::get_system_category());
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+    data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    DWORD last_error = ::GetLastError();
+    ::CloseHandle(mapping);
+    if (data == 0)
+    {
+      ::CloseHandle(handle);
+      ec.assign(last_error, asio::error::get_system_category());
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+  }
+
+  ::CloseHandle(handle);
+  data_ = data;
+  size_ = static_cast<std::size_t>(file_size.QuadPart);
+#else // defined(ASIO_WINDOWS)
+  int flags = O_RDONLY;
+# if defined(O_CLOEXEC)
+  flags |= O_CLOEXEC;
+# endif // defined(O_CLOEXEC)
+  int fd = ::open(path, flags);
+  if (fd < 0)
+  {
+    ec.assign(errno, asio::error::get_system_category());
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0)
+  {
+    ec.assign(errno, asio::error::get_system_category());
+    ::close(fd);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  void* data = 0;
+  if (st.st_size > 0)
+  {
+    data = ::mmap(0, static_cast<std::size_t>(st.st_size),
+        PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      ec.assign(errno, asio::error::get_system_category());
+      ::close(fd);
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+  }
+
+  // The mapping remains valid after the descriptor is closed.
+  ::close(fd);
+  data_ = data;
+  size_ = static_cast<std::size_t>(st.st_size);
+#endif // defined(ASIO_WINDOWS)
+
+  is_open_ = true;
+  ec.assign(0, ec.category());
+  ASIO_SYNC_OP_VOID_RETURN(ec);
+}
+
+ASIO_SYNC_OP_VOID mapped_file::close(asio::error_code& ec)
+{
+  if (data_)
+  {
+#if defined(ASIO_WINDOWS)
+    if (!::UnmapViewOfFile(data_))
+    {
+      DWORD last_error = ::GetLastError();
+      ec.assign(last_error, asio::error::get_system_category());
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+#else // defined(ASIO_WINDOWS)
+    if (::munmap(data_, size_) != 0)
+    {
+      ec.assign(errno, asio::error::get_system_category());
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+#endif // defined(ASIO_WINDOWS)
+  }
+
+  data_ = 0;
+  size_ = 0;
+  is_open_ = false;
+  ec.assign(0, ec.category());
+  ASIO_SYNC_OP_VOID_RETURN(ec);
+}
+
+ASIO_SYNC_OP_VOID mapped_file::advise(advice_type advice,
+    std::size_t offset, std::size_t size, asio::error_code& ec)
+{
+  if (!is_open_)
+  {
+    ec = asio::error::bad_descriptor;
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  if (offset >= size_ || size == 0)
+  {
+    ec.assign(0, ec.category());
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  if (size > size_ - offset)
+    size = size_ - offset;
+
+#if defined(ASIO_WINDOWS)
+# if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+  if (advice == will_need)
+  {
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = static_cast<char*>(data_) + offset;
+    range.NumberOfBytes = size;
+    if (!::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0))
+    {
+      DWORD last_error = ::GetLastError();
+      ec.assign(last_error, asio::error::get_system_category());
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+  }
+# else // defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+  (void)advice;
+# endif // defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+#else // defined(ASIO_WINDOWS)
+  int native_advice = MADV_NORMAL;
+  switch (advice)
+  {
+  case sequential: native_advice = MADV_SEQUENTIAL; break;
+  case random: native_advice = MADV_RANDOM; break;
+  case will_need: native_advice = MADV_WILLNEED; break;
+  case dont_need: native_advice = MADV_DONTNEED; break;
+  default: break;
+  }
+
+  // The start of the range must be aligned to a page boundary.
+  std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  std::size_t aligned_offset = offset - offset % page_size;
+  if (::madvise(static_cast<char*>(data_) + aligned_offset,
+        size + (offset - aligned_offset), native_advice) != 0)
+  {
+    ec.assign(errno, asio::error::get_system_category());
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+#endif // defined(ASIO_WINDOWS)
+
+  ec.assign(0, ec.category());
+  ASIO_SYNC_OP_VOID_RETURN(ec);
+}
+
+std::size_t mapped_file::resident_size(asio::error_code& ec) const
+{
+  if (!is_open_)
+  {
+    ec = asio::error::bad_descriptor;
+    return 0;
+  }
+
+#if defined(ASIO_WINDOWS)
+  ec = asio::error::operation_not_supported;
+  return 0;
+#else // defined(ASIO_WINDOWS)
+  if (size_ == 0)
+  {
+    ec.assign(0, ec.category());
+    return 0;
+  }
+
+# if defined(__linux__)
+  typedef unsigned char vec_type;
+# else // defined(__linux__)
+  typedef char vec_type;
+# endif // defined(__linux__)
+
+  std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  std::size_t pages = (size_ + page_size - 1) / page_size;
+  std::vector<vec_type> vec(pages);
+  if (::mincore(data_, size_, &vec[0]) != 0)
+  {
+    ec.assign(errno, asio::error::get_system_category());
+    return 0;
+  }
+
+  std::size_t resident = 0;
+  for (std::size_t i = 0; i < pages; ++i)
+  {
+    if (vec[i] & 1)
+    {
+      std::size_t page_end = (i + 1) * page_size;
+      resident += (page_end > size_ ? size_ : page_end) - i * page_size;
+    }
+  }
+
+  ec.assign(0, ec.category());
+  return resident;
+#endif // defined(ASIO_WINDOWS)
+}
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_MAPPED_FILE)
+
+#endif // ASIO_IMPL_MAPPED_FILE_IPP
@@ -29,6 +29,8 @@
 #include "asio/impl/error_code.ipp"
 #include "asio/impl/execution_context.ipp"
 #include "asio/impl/io_context.ipp"
+#include "asio/impl/io_context_pool.ipp"
+#include "asio/impl/mapped_file.ipp"
 #include "asio/impl/serial_port_base.ipp"
 #include "asio/impl/system_context.ipp"
 #include "asio/impl/thread_pool.ipp"
@@ -50,6 +52,7 @@
 #include "asio/detail/impl/posix_serial_port_service.ipp"
 #include "asio/detail/impl/posix_thread.ipp"
 #include "asio/detail/impl/posix_tss_ptr.ipp"
+#include "asio/detail/impl/process_ops.ipp"
 #include "asio/detail/impl/reactive_descriptor_service.ipp"
 #include "asio/detail/impl/reactive_socket_service_base.ipp"
 #include "asio/detail/impl/resolver_service_base.ipp"
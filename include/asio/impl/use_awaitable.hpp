@@ -205,7 +205,10 @@ public:
   {
     (void)u;
     ASIO_HANDLER_LOCATION((u.file_name_, u.line_, u.function_name_));
-    handler_type handler(frame->detach_thread());
+    detail::awaitable_thread<Executor>* thread = frame->detach_thread();
+    typename detail::awaitable_thread<Executor>::initiating_call_stack::context
+      ctx(thread->entry_point(), *thread);
+    handler_type handler(thread);
     std::move(initiation)(std::move(handler), std::move(args)...);
     return nullptr;
   }
@@ -226,6 +229,13 @@ public:
   }
 };
 
+template <typename Executor, typename... Ts, typename IoExecutor>
+struct associated_immediate_executor<
+    detail::awaitable_handler<Executor, Ts...>, IoExecutor>
+  : detail::awaitable_thread_immediate_executor<Executor, IoExecutor>
+{
+};
+
 #endif // !defined(GENERATING_DOCUMENTATION)
 
 ASIO_INLINE_NAMESPACE_END
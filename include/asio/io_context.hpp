@@ -197,6 +197,7 @@ private:
 #if defined(ASIO_HAS_IOCP)
   friend class detail::win_iocp_overlapped_ptr;
 #endif
+  friend class io_context_pool;
 
 public:
   template <typename Allocator, uintptr_t Bits>
@@ -0,0 +1,202 @@
+//
+// io_context_pool.hpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IO_CONTEXT_POOL_HPP
+#define ASIO_IO_CONTEXT_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "asio/detail/atomic_count.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/thread_group.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/io_context.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// A fixed-size pool of io_context objects, each run by its own thread.
+/**
+ * The io_context_pool class provides a set of independent @c io_context
+ * objects, each of which is run by a single dedicated thread. This avoids the
+ * contention on a single scheduler's internal lock that occurs when many
+ * threads run the same @c io_context, at the cost of having to choose which
+ * context an I/O object should belong to when it is created.
+ *
+ * Once an I/O object has been created using one of the pool's executors, all
+ * of its asynchronous operations and their completion handlers remain on that
+ * executor's @c io_context. A connection therefore stays affine to the thread
+ * that was selected for it. The pool supports two selection strategies:
+ *
+ * @li get_executor() selects the contexts in round-robin order.
+ *
+ * @li get_least_loaded_executor() selects the context with the fewest units
+ * of outstanding work, such as pending asynchronous operations and queued
+ * handlers.
+ *
+ * By default, each context is configured as if constructed with a
+ * concurrency hint of @c 1, as it is only ever run from one thread.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Safe, with the specific exceptions of the join() and
+ * wait() functions, which must not be called at the same time as other calls
+ * to join() or wait() on the same pool.
+ *
+ * @par Example
+ * @code asio::io_context_pool pool(4);
+ * asio::ip::tcp::acceptor acceptor(pool.get_executor(), endpoint);
+ *
+ * void do_accept()
+ * {
+ *   acceptor.async_accept(pool.get_least_loaded_executor(),
+ *       [](std::error_code ec, asio::ip::tcp::socket socket)
+ *       {
+ *         if (!ec)
+ *           std::make_shared<session>(std::move(socket))->start();
+ *         do_accept();
+ *       });
+ * }
+ *
+ * ...
+ *
+ * pool.join(); @endcode
+ */
+class io_context_pool
+  : private noncopyable
+{
+public:
+  /// The type of the executors associated with the contexts in the pool.
+  typedef io_context::executor_type executor_type;
+
+  /// Constructs a pool with one context per hardware thread.
+  ASIO_DECL io_context_pool();
+
+  /// Constructs a pool with a specified number of contexts.
+  /**
+   * @param pool_size The number of contexts, and threads, in the pool. Values
+   * that are less than @c 1 are treated as @c 1.
+   */
+  ASIO_DECL explicit io_context_pool(std::size_t pool_size);
+
+  /// Constructs a pool with a specified number of contexts.
+  /**
+   * Construct with a service maker, to create an initial set of services that
+   * will be installed into each context in the pool at construction time.
+   *
+   * @param pool_size The number of contexts, and threads, in the pool. Values
+   * that are less than @c 1 are treated as @c 1.
+   *
+   * @param initial_services Used to create the initial services. The @c make
+   * function will be called once for each context in the pool.
+   */
+  ASIO_DECL io_context_pool(std::size_t pool_size,
+      const execution_context::service_maker& initial_services);
+
+  /// Destructor.
+  /**
+   * Automatically stops and joins the pool, if not explicitly done beforehand,
+   * and then destroys the contexts in the reverse order of their creation.
+   */
+  ASIO_DECL ~io_context_pool();
+
+  /// Get the number of contexts in the pool.
+  std::size_t size() const noexcept
+  {
+    return contexts_.size();
+  }
+
+  /// Get the context at the specified index.
+  /**
+   * @param index A value less than size().
+   */
+  io_context& get_io_context(std::size_t index) noexcept
+  {
+    return *contexts_[index];
+  }
+
+  /// Obtains an executor for the next context, in round-robin order.
+  ASIO_DECL executor_type get_executor() noexcept;
+
+  /// Obtains an executor for the context with the least outstanding work.
+  /**
+   * The amount of outstanding work for a context includes pending
+   * asynchronous operations, queued handlers, and any tracked executors.
+   * When more than one context has the least work, the contexts are selected
+   * in round-robin order.
+   *
+   * @note The amount of work is sampled without synchronisation, and may
+   * change while the selection is being made.
+   */
+  ASIO_DECL executor_type get_least_loaded_executor() noexcept;
+
+  /// Stops the contexts in the pool.
+  /**
+   * This function stops each context in the pool as soon as possible. As a
+   * result of calling @c stop(), pending handlers may never be invoked.
+   */
+  ASIO_DECL void stop();
+
+  /// Joins the threads.
+  /**
+   * This function blocks until the threads in the pool have completed. If @c
+   * stop() is not called prior to @c join(), the @c join() call will wait
+   * until every context in the pool has no more outstanding work.
+   */
+  ASIO_DECL void join();
+
+  /// Waits for threads to complete.
+  /**
+   * This function blocks until the threads in the pool have completed. If @c
+   * stop() is not called prior to @c wait(), the @c wait() call will wait
+   * until every context in the pool has no more outstanding work.
+   *
+   * @note @c wait() is synonymous with @c join().
+   */
+  ASIO_DECL void wait();
+
+private:
+  struct thread_function;
+
+  // Helper function to create the contexts and start their threads.
+  ASIO_DECL void start(std::size_t pool_size,
+      const execution_context::service_maker& initial_services);
+
+  // The contexts in the pool.
+  std::vector<std::unique_ptr<io_context>> contexts_;
+
+  // The threads that run the contexts.
+  detail::thread_group<std::allocator<void>> threads_;
+
+  // The count used to select the next context in round-robin order.
+  detail::atomic_count next_;
+
+  // Whether a join call will have any effect.
+  bool joinable_;
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/impl/io_context_pool.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
+#endif // ASIO_IO_CONTEXT_POOL_HPP
@@ -0,0 +1,420 @@
+//
+// mapped_file.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_MAPPED_FILE_HPP
+#define ASIO_MAPPED_FILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_MAPPED_FILE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <string>
+#include "asio/buffer.hpp"
+#include "asio/error.hpp"
+#include "asio/detail/throw_error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// Provides read-only access to the contents of a file as a buffer.
+/**
+ * The mapped_file class maps the entire contents of a file into memory, so
+ * that it may be passed directly to operations such as asio::async_write
+ * without first being read into an intermediate buffer. The mapped pages are
+ * shared with the operating system's page cache.
+ *
+ * The mapping reflects the size of the file at the time it was opened. The
+ * file must not be truncated while it is mapped.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe. The buffers obtained from a mapped_file may
+ * be used concurrently from multiple threads.
+ *
+ * @par Example
+ * @code
+ * asio::mapped_file file("index.html");
+ * file.advise(asio::mapped_file::sequential);
+ * asio::async_write(socket, file.buffer(), handler);
+ * @endcode
+ * The mapped_file object must remain open until the write completes.
+ */
+class mapped_file
+{
+public:
+  /// Hints about how the contents of the file will be accessed.
+  enum advice_type
+  {
+    /// No special treatment.
+    normal = 0,
+
+    /// The contents will be accessed in sequential order, so pages may be
+    /// read ahead aggressively and freed soon after they are accessed.
+    sequential = 1,
+
+    /// The contents will be accessed in random order.
+    random = 2,
+
+    /// The contents will be accessed soon, so pages should be read in ahead
+    /// of time.
+    will_need = 3,
+
+    /// The contents will not be accessed in the near future.
+    dont_need = 4
+  };
+
+  /// Construct a mapped_file without opening it.
+  mapped_file() noexcept
+    : data_(0),
+      size_(0),
+      is_open_(false)
+  {
+  }
+
+  /// Construct and open a mapped_file.
+  /**
+   * This constructor maps the contents of the specified file into memory.
+   *
+   * @param path The path name identifying the file to be mapped.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  explicit mapped_file(const char* path)
+    : data_(0),
+      size_(0),
+      is_open_(false)
+  {
+    asio::error_code ec;
+    open(path, ec);
+    asio::detail::throw_error(ec, "open");
+  }
+
+  /// Construct and open a mapped_file.
+  /**
+   * This constructor maps the contents of the specified file into memory.
+   *
+   * @param path The path name identifying the file to be mapped.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  explicit mapped_file(const std::string& path)
+    : data_(0),
+      size_(0),
+      is_open_(false)
+  {
+    asio::error_code ec;
+    open(path.c_str(), ec);
+    asio::detail::throw_error(ec, "open");
+  }
+
+  /// Move-construct a mapped_file from another.
+  /**
+   * @note Following the move, the moved-from object is in the same state as if
+   * constructed using the @c mapped_file() constructor.
+   */
+  mapped_file(mapped_file&& other) noexcept
+    : data_(other.data_),
+      size_(other.size_),
+      is_open_(other.is_open_)
+  {
+    other.data_ = 0;
+    other.size_ = 0;
+    other.is_open_ = false;
+  }
+
+  /// Move-assign a mapped_file from another.
+  /**
+   * @note Following the move, the moved-from object is in the same state as if
+   * constructed using the @c mapped_file() constructor.
+   */
+  mapped_file& operator=(mapped_file&& other) noexcept
+  {
+    if (this != &other)
+    {
+      asio::error_code ignored_ec;
+      close(ignored_ec);
+      data_ = other.data_;
+      size_ = other.size_;
+      is_open_ = other.is_open_;
+      other.data_ = 0;
+      other.size_ = 0;
+      other.is_open_ = false;
+    }
+    return *this;
+  }
+
+  /// Destroys the mapped_file, unmapping the file if it is open.
+  ~mapped_file()
+  {
+    asio::error_code ignored_ec;
+    close(ignored_ec);
+  }
+
+  /// Open the mapped_file.
+  /**
+   * This function maps the contents of the specified file into memory. Any
+   * previously mapped file is first unmapped.
+   *
+   * @param path The path name identifying the file to be mapped.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void open(const char* path)
+  {
+    asio::error_code ec;
+    open(path, ec);
+    asio::detail::throw_error(ec, "open");
+  }
+
+  /// Open the mapped_file.
+  /**
+   * This function maps the contents of the specified file into memory. Any
+   * previously mapped file is first unmapped.
+   *
+   * @param path The path name identifying the file to be mapped.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_DECL ASIO_SYNC_OP_VOID open(const char* path, asio::error_code& ec);
+
+  /// Open the mapped_file.
+  /**
+   * This function maps the contents of the specified file into memory. Any
+   * previously mapped file is first unmapped.
+   *
+   * @param path The path name identifying the file to be mapped.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void open(const std::string& path)
+  {
+    asio::error_code ec;
+    open(path.c_str(), ec);
+    asio::detail::throw_error(ec, "open");
+  }
+
+  /// Open the mapped_file.
+  /**
+   * This function maps the contents of the specified file into memory. Any
+   * previously mapped file is first unmapped.
+   *
+   * @param path The path name identifying the file to be mapped.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID open(const std::string& path, asio::error_code& ec)
+  {
+    open(path.c_str(), ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Determine whether the mapped_file is open.
+  bool is_open() const noexcept
+  {
+    return is_open_;
+  }
+
+  /// Close the mapped_file.
+  /**
+   * This function unmaps the file. Any buffers previously obtained from the
+   * mapped_file are invalidated.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void close()
+  {
+    asio::error_code ec;
+    close(ec);
+    asio::detail::throw_error(ec, "close");
+  }
+
+  /// Close the mapped_file.
+  /**
+   * This function unmaps the file. Any buffers previously obtained from the
+   * mapped_file are invalidated.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_DECL ASIO_SYNC_OP_VOID close(asio::error_code& ec);
+
+  /// Get a pointer to the mapped contents of the file.
+  /**
+   * @returns A pointer to the first byte of the file, or a null pointer if the
+   * file is not open or is empty.
+   */
+  const void* data() const noexcept
+  {
+    return data_;
+  }
+
+  /// Get the size of the mapped contents of the file.
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// Get a buffer that represents the entire contents of the file.
+  asio::const_buffer buffer() const noexcept
+  {
+    return asio::const_buffer(data_, size_);
+  }
+
+  /// Get a buffer that represents part of the contents of the file.
+  /**
+   * @param offset The offset of the first byte of the buffer. If the offset is
+   * beyond the end of the file, an empty buffer is returned.
+   *
+   * @param size The maximum size of the buffer. The buffer is truncated at the
+   * end of the file.
+   */
+  asio::const_buffer buffer(std::size_t offset,
+      std::size_t size) const noexcept
+  {
+    if (offset >= size_)
+      return asio::const_buffer();
+    std::size_t available = size_ - offset;
+    return asio::const_buffer(static_cast<const char*>(data_) + offset,
+        size < available ? size : available);
+  }
+
+  /// Advise the operating system how the contents will be accessed.
+  /**
+   * This function passes a hint to the operating system's virtual memory
+   * system, such as @c madvise. The hint applies to the entire file.
+   *
+   * @param advice The expected access pattern.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void advise(advice_type advice)
+  {
+    asio::error_code ec;
+    advise(advice, 0, size_, ec);
+    asio::detail::throw_error(ec, "advise");
+  }
+
+  /// Advise the operating system how the contents will be accessed.
+  /**
+   * This function passes a hint to the operating system's virtual memory
+   * system, such as @c madvise. The hint applies to the entire file.
+   *
+   * @param advice The expected access pattern.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID advise(advice_type advice, asio::error_code& ec)
+  {
+    advise(advice, 0, size_, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Advise the operating system how part of the contents will be accessed.
+  /**
+   * This function passes a hint to the operating system's virtual memory
+   * system, such as @c madvise. The range is extended to whole pages.
+   *
+   * @param advice The expected access pattern.
+   *
+   * @param offset The offset of the first byte to which the hint applies.
+   *
+   * @param size The number of bytes to which the hint applies.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void advise(advice_type advice, std::size_t offset, std::size_t size)
+  {
+    asio::error_code ec;
+    advise(advice, offset, size, ec);
+    asio::detail::throw_error(ec, "advise");
+  }
+
+  /// Advise the operating system how part of the contents will be accessed.
+  /**
+   * This function passes a hint to the operating system's virtual memory
+   * system, such as @c madvise. The range is extended to whole pages. Hints
+   * that are not supported by the operating system are ignored.
+   *
+   * @param advice The expected access pattern.
+   *
+   * @param offset The offset of the first byte to which the hint applies.
+   *
+   * @param size The number of bytes to which the hint applies.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_DECL ASIO_SYNC_OP_VOID advise(advice_type advice,
+      std::size_t offset, std::size_t size, asio::error_code& ec);
+
+  /// Determine how much of the file is resident in memory.
+  /**
+   * This function may be used to monitor page cache pressure, by determining
+   * how many of the mapped pages may be accessed without blocking on disk I/O.
+   *
+   * @returns The number of bytes of the file that are resident in memory.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  std::size_t resident_size() const
+  {
+    asio::error_code ec;
+    std::size_t s = resident_size(ec);
+    asio::detail::throw_error(ec, "resident_size");
+    return s;
+  }
+
+  /// Determine how much of the file is resident in memory.
+  /**
+   * This function may be used to monitor page cache pressure, by determining
+   * how many of the mapped pages may be accessed without blocking on disk I/O.
+   *
+   * @param ec Set to indicate what error occurred, if any. Set to
+   * asio::error::operation_not_supported on platforms where residency
+   * cannot be determined.
+   *
+   * @returns The number of bytes of the file that are resident in memory.
+   */
+  ASIO_DECL std::size_t resident_size(asio::error_code& ec) const;
+
+private:
+  // Disallow copying and assignment.
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  // The start of the mapping.
+  void* data_;
+
+  // The size of the mapping.
+  std::size_t size_;
+
+  // Whether a file is open. An empty file is open but has no mapping.
+  bool is_open_;
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/impl/mapped_file.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
+#endif // defined(ASIO_HAS_MAPPED_FILE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_MAPPED_FILE_HPP
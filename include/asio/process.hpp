@@ -0,0 +1,37 @@
+//
+// process.hpp
+// ~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_PROCESS_HPP
+#define ASIO_PROCESS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_PROCESS) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include "asio/basic_process.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// Typedef for the typical usage of a child process.
+typedef basic_process<> process;
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#endif // defined(ASIO_HAS_PROCESS)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_PROCESS_HPP
@@ -0,0 +1,110 @@
+//
+// process_base.hpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_PROCESS_BASE_HPP
+#define ASIO_PROCESS_BASE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+
+/// The process_base class is used as a base for the basic_process class
+/// template so that we have a common place to define flags.
+class process_base
+{
+public:
+#if defined(GENERATING_DOCUMENTATION)
+  /// A bitmask type (C++ Std [lib.bitmask.types]).
+  typedef unspecified stdio_flags;
+
+  /// The child inherits the standard input, output and error of the parent.
+  static const stdio_flags inherit_stdio = implementation_defined;
+
+  /// Connect the child's standard input to a pipe.
+  static const stdio_flags pipe_stdin = implementation_defined;
+
+  /// Connect the child's standard output to a pipe.
+  static const stdio_flags pipe_stdout = implementation_defined;
+
+  /// Connect the child's standard error to a pipe.
+  static const stdio_flags pipe_stderr = implementation_defined;
+#else
+  enum stdio_flags
+  {
+    inherit_stdio = 0,
+    pipe_stdin = 1,
+    pipe_stdout = 2,
+    pipe_stderr = 4
+  };
+
+  // Implement bitmask operations as shown in C++ Std [lib.bitmask.types].
+
+  friend stdio_flags operator&(stdio_flags x, stdio_flags y)
+  {
+    return static_cast<stdio_flags>(
+        static_cast<unsigned int>(x) & static_cast<unsigned int>(y));
+  }
+
+  friend stdio_flags operator|(stdio_flags x, stdio_flags y)
+  {
+    return static_cast<stdio_flags>(
+        static_cast<unsigned int>(x) | static_cast<unsigned int>(y));
+  }
+
+  friend stdio_flags operator^(stdio_flags x, stdio_flags y)
+  {
+    return static_cast<stdio_flags>(
+        static_cast<unsigned int>(x) ^ static_cast<unsigned int>(y));
+  }
+
+  friend stdio_flags operator~(stdio_flags x)
+  {
+    return static_cast<stdio_flags>(~static_cast<unsigned int>(x));
+  }
+
+  friend stdio_flags& operator&=(stdio_flags& x, stdio_flags y)
+  {
+    x = x & y;
+    return x;
+  }
+
+  friend stdio_flags& operator|=(stdio_flags& x, stdio_flags y)
+  {
+    x = x | y;
+    return x;
+  }
+
+  friend stdio_flags& operator^=(stdio_flags& x, stdio_flags y)
+  {
+    x = x ^ y;
+    return x;
+  }
+#endif
+
+protected:
+  /// Protected destructor to prevent deletion through this type.
+  ~process_base()
+  {
+  }
+};
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_PROCESS_BASE_HPP
@@ -25,9 +25,15 @@ ASIO_INLINE_NAMESPACE_BEGIN
 
 /// An allocator that caches memory blocks in thread-local storage for reuse.
 /**
- * The @c recycling_allocator uses a simple strategy where a limited number of
- * small memory blocks are cached in thread-local storage, if the current
- * thread is running an @c io_context or is part of a @c thread_pool.
+ * The @c recycling_allocator carves small memory blocks from per-thread slabs,
+ * segregated into size classes. Blocks are returned to the slabs of the thread
+ * that allocated them, even when they are deallocated on another thread. The
+ * memory reserved by each thread is bounded by the
+ * <tt>"scheduler"</tt> / <tt>"recycling_memory_limit"</tt> configuration option
+ * of the @c io_context or @c thread_pool it is currently running, or by
+ * @c ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT when it is not running one. The
+ * limit applies to each thread separately. Slab memory is retained for reuse
+ * until the thread exits and all blocks allocated from it have been freed.
  */
 template <typename T>
 class recycling_allocator
@@ -86,9 +92,15 @@ public:
 /// A proto-allocator that caches memory blocks in thread-local storage for
 /// reuse.
 /**
- * The @c recycling_allocator uses a simple strategy where a limited number of
- * small memory blocks are cached in thread-local storage, if the current
- * thread is running an @c io_context or is part of a @c thread_pool.
+ * The @c recycling_allocator carves small memory blocks from per-thread slabs,
+ * segregated into size classes. Blocks are returned to the slabs of the thread
+ * that allocated them, even when they are deallocated on another thread. The
+ * memory reserved by each thread is bounded by the
+ * <tt>"scheduler"</tt> / <tt>"recycling_memory_limit"</tt> configuration option
+ * of the @c io_context or @c thread_pool it is currently running, or by
+ * @c ASIO_RECYCLING_ALLOCATOR_MEMORY_LIMIT when it is not running one. The
+ * limit applies to each thread separately. Slab memory is retained for reuse
+ * until the thread exits and all blocks allocated from it have been freed.
  */
 template <>
 class recycling_allocator<void>
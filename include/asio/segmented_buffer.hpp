@@ -0,0 +1,607 @@
+//
+// segmented_buffer.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SEGMENTED_BUFFER_HPP
+#define ASIO_SEGMENTED_BUFFER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "asio/buffer.hpp"
+#include "asio/detail/segment_pool.hpp"
+#include "asio/detail/throw_exception.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/execution/context.hpp"
+#include "asio/execution/executor.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/is_executor.hpp"
+#include "asio/query.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+ASIO_INLINE_NAMESPACE_BEGIN
+namespace detail {
+
+// A buffer sequence that refers to a contiguous range of bytes within a chain
+// of equally sized blocks. Each element covers the part of the range that
+// lies within one block.
+template <typename Buffer>
+class segmented_buffer_sequence
+{
+public:
+  typedef Buffer value_type;
+
+  class const_iterator
+  {
+  public:
+    typedef std::ptrdiff_t difference_type;
+    typedef Buffer value_type;
+    typedef const Buffer* pointer;
+    typedef Buffer reference;
+    typedef std::bidirectional_iterator_tag iterator_category;
+
+    const_iterator() noexcept
+      : blocks_(0),
+        block_size_(0),
+        offset_(0),
+        size_(0),
+        index_(0)
+    {
+    }
+
+    const_iterator(const std::deque<char*>* blocks, std::size_t block_size,
+        std::size_t offset, std::size_t size, std::size_t index) noexcept
+      : blocks_(blocks),
+        block_size_(block_size),
+        offset_(offset),
+        size_(size),
+        index_(index)
+    {
+    }
+
+    Buffer operator*() const noexcept
+    {
+      return segmented_buffer_sequence::at(
+          *blocks_, block_size_, offset_, size_, index_);
+    }
+
+    const_iterator& operator++() noexcept
+    {
+      ++index_;
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept
+    {
+      const_iterator tmp(*this);
+      ++index_;
+      return tmp;
+    }
+
+    const_iterator& operator--() noexcept
+    {
+      --index_;
+      return *this;
+    }
+
+    const_iterator operator--(int) noexcept
+    {
+      const_iterator tmp(*this);
+      --index_;
+      return tmp;
+    }
+
+    friend bool operator==(const const_iterator& a,
+        const const_iterator& b) noexcept
+    {
+      return a.index_ == b.index_;
+    }
+
+    friend bool operator!=(const const_iterator& a,
+        const const_iterator& b) noexcept
+    {
+      return a.index_ != b.index_;
+    }
+
+  private:
+    // The iterator holds a copy of the range so that it remains valid when
+    // the sequence object itself is copied or destroyed.
+    const std::deque<char*>* blocks_;
+    std::size_t block_size_;
+    std::size_t offset_;
+    std::size_t size_;
+    std::size_t index_;
+  };
+
+  segmented_buffer_sequence(const std::deque<char*>& blocks,
+      std::size_t block_size, std::size_t offset, std::size_t size) noexcept
+    : blocks_(&blocks),
+      block_size_(block_size),
+      offset_(offset),
+      size_(size)
+  {
+  }
+
+  const_iterator begin() const noexcept
+  {
+    return const_iterator(blocks_, block_size_,
+        offset_, size_, offset_ / block_size_);
+  }
+
+  const_iterator end() const noexcept
+  {
+    return const_iterator(blocks_, block_size_, offset_, size_, size_ == 0
+        ? offset_ / block_size_ : (offset_ + size_ - 1) / block_size_ + 1);
+  }
+
+private:
+  // Get the part of the range that lies within the specified block.
+  static Buffer at(const std::deque<char*>& blocks, std::size_t block_size,
+      std::size_t offset, std::size_t size, std::size_t index) noexcept
+  {
+    std::size_t block_begin = index * block_size;
+    std::size_t begin = offset > block_begin ? offset : block_begin;
+    std::size_t end = offset + size < block_begin + block_size
+      ? offset + size : block_begin + block_size;
+    return Buffer(blocks[index] + (begin - block_begin), end - begin);
+  }
+
+  const std::deque<char*>* blocks_;
+  std::size_t block_size_;
+  std::size_t offset_;
+  std::size_t size_;
+};
+
+} // namespace detail
+
+/// Dynamically sized storage made up of a chain of fixed-size blocks.
+/**
+ * The segmented_buffer class stores its input and output sequences in a chain
+ * of equally sized blocks. Unlike basic_streambuf, growing the buffer never
+ * moves or copies data that has already been written: new blocks are appended
+ * to the chain, and blocks are removed from the front of the chain as the
+ * input sequence is consumed. As a result, the input and output sequences are
+ * exposed as sequences of multiple buffers.
+ *
+ * Blocks are obtained from a pool that is shared by all segmented_buffer
+ * objects associated with the same execution context. The block size and the
+ * maximum number of cached blocks are set using the configuration options
+ * @c segmented_buffer / @c block_size and @c segmented_buffer /
+ * @c pool_capacity.
+ *
+ * A segmented_buffer object is used with the dynamic buffer overloads of the
+ * read, write and read_until operations via the dynamic_buffer() function.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ *
+ * @par Example
+ * @code
+ * asio::segmented_buffer b(my_context);
+ * std::size_t n = asio::read_until(sock, asio::dynamic_buffer(b), '\n');
+ * @endcode
+ */
+class segmented_buffer
+{
+public:
+#if defined(GENERATING_DOCUMENTATION)
+  /// The type used to represent the input sequence as a list of buffers.
+  typedef implementation_defined const_buffers_type;
+
+  /// The type used to represent the output sequence as a list of buffers.
+  typedef implementation_defined mutable_buffers_type;
+#else
+  typedef detail::segmented_buffer_sequence<const_buffer> const_buffers_type;
+  typedef detail::segmented_buffer_sequence<mutable_buffer>
+    mutable_buffers_type;
+#endif
+
+  /// Construct a segmented_buffer that uses the pool of an executor's
+  /// execution context.
+  template <typename Executor>
+  explicit segmented_buffer(const Executor& ex,
+      std::size_t maximum_size = (std::numeric_limits<std::size_t>::max)(),
+      constraint_t<
+        is_executor<Executor>::value || execution::is_executor<Executor>::value
+      > = 0)
+    : pool_(asio::use_service<detail::segment_pool_service>(
+          segmented_buffer::get_context(ex)).pool()),
+      block_size_(pool_->block_size()),
+      offset_(0),
+      size_(0),
+      output_size_(0),
+      max_size_(maximum_size)
+  {
+  }
+
+  /// Construct a segmented_buffer that uses the pool of an execution context.
+  template <typename ExecutionContext>
+  explicit segmented_buffer(ExecutionContext& context,
+      std::size_t maximum_size = (std::numeric_limits<std::size_t>::max)(),
+      constraint_t<
+        is_convertible<ExecutionContext&, execution_context&>::value
+      > = 0)
+    : pool_(asio::use_service<detail::segment_pool_service>(context).pool()),
+      block_size_(pool_->block_size()),
+      offset_(0),
+      size_(0),
+      output_size_(0),
+      max_size_(maximum_size)
+  {
+  }
+
+  /// Move construct a segmented_buffer.
+  segmented_buffer(segmented_buffer&& other) noexcept
+    : pool_(other.pool_),
+      blocks_(static_cast<std::deque<char*>&&>(other.blocks_)),
+      block_size_(other.block_size_),
+      offset_(other.offset_),
+      size_(other.size_),
+      output_size_(other.output_size_),
+      max_size_(other.max_size_)
+  {
+    other.blocks_.clear();
+    other.offset_ = 0;
+    other.size_ = 0;
+    other.output_size_ = 0;
+  }
+
+  /// Destructor returns all blocks to the pool.
+  ~segmented_buffer()
+  {
+    while (!blocks_.empty())
+    {
+      pool_->deallocate(blocks_.back());
+      blocks_.pop_back();
+    }
+  }
+
+  /// Get the size of the input sequence.
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// Get the maximum size of the buffer.
+  std::size_t max_size() const noexcept
+  {
+    return max_size_;
+  }
+
+  /// Get the number of bytes that may be held without allocating blocks.
+  std::size_t capacity() const noexcept
+  {
+    return blocks_.size() * block_size_ - offset_;
+  }
+
+  /// Get the size of each block.
+  std::size_t block_size() const noexcept
+  {
+    return block_size_;
+  }
+
+  /// Get a list of buffers that represents the input sequence.
+  /**
+   * @returns An object of type @c const_buffers_type that satisfies
+   * ConstBufferSequence requirements, representing all character arrays in
+   * the input sequence.
+   *
+   * @note The returned object is invalidated by any @c segmented_buffer
+   * member function that modifies the input sequence or output sequence.
+   */
+  const_buffers_type data() const noexcept
+  {
+    return const_buffers_type(blocks_, block_size_, offset_, size_);
+  }
+
+  /// Get a list of buffers that represents part of the input sequence.
+  /**
+   * @param pos Position of the first byte to represent in the input sequence.
+   *
+   * @param n The number of bytes to represent. If there are fewer than @c n
+   * bytes after @c pos, the range is truncated.
+   */
+  mutable_buffers_type data(std::size_t pos, std::size_t n) noexcept
+  {
+    std::size_t begin = pos < size_ ? pos : size_;
+    std::size_t length = n < size_ - begin ? n : size_ - begin;
+    return mutable_buffers_type(blocks_, block_size_, offset_ + begin, length);
+  }
+
+  /// Get a list of buffers that represents part of the input sequence.
+  /**
+   * @param pos Position of the first byte to represent in the input sequence.
+   *
+   * @param n The number of bytes to represent. If there are fewer than @c n
+   * bytes after @c pos, the range is truncated.
+   */
+  const_buffers_type data(std::size_t pos, std::size_t n) const noexcept
+  {
+    std::size_t begin = pos < size_ ? pos : size_;
+    std::size_t length = n < size_ - begin ? n : size_ - begin;
+    return const_buffers_type(blocks_, block_size_, offset_ + begin, length);
+  }
+
+  /// Get a list of buffers that represents the output sequence, with the
+  /// given size.
+  /**
+   * Ensures that the output sequence can accommodate @c n bytes, appending
+   * blocks as required. Data in the input sequence is never moved.
+   *
+   * @returns An object of type @c mutable_buffers_type that satisfies
+   * MutableBufferSequence requirements, representing character memory at the
+   * start of the output sequence of size @c n.
+   *
+   * @throws std::length_error If <tt>size() + n > max_size()</tt>.
+   *
+   * @note The returned object is invalidated by any @c segmented_buffer
+   * member function that modifies the input sequence or output sequence.
+   */
+  mutable_buffers_type prepare(std::size_t n)
+  {
+    reserve(n);
+    output_size_ = n;
+    return mutable_buffers_type(blocks_, block_size_, offset_ + size_, n);
+  }
+
+  /// Move bytes from the output sequence to the input sequence.
+  /**
+   * @param n The number of bytes to append from the start of the output
+   * sequence to the end of the input sequence. The remainder of the output
+   * sequence is discarded.
+   */
+  void commit(std::size_t n) noexcept
+  {
+    size_ += n < output_size_ ? n : output_size_;
+    output_size_ = 0;
+  }
+
+  /// Grow the input sequence by the specified number of bytes.
+  /**
+   * @throws std::length_error If <tt>size() + n > max_size()</tt>.
+   */
+  void grow(std::size_t n)
+  {
+    reserve(n);
+    size_ += n;
+    output_size_ = 0;
+  }
+
+  /// Shrink the input sequence by the specified number of bytes.
+  /**
+   * Erases @c n bytes from the end of the input sequence. If @c n is greater
+   * than the size of the input sequence, the entire input sequence is erased.
+   */
+  void shrink(std::size_t n) noexcept
+  {
+    size_ -= n < size_ ? n : size_;
+    output_size_ = 0;
+    if (size_ == 0)
+      reset();
+  }
+
+  /// Remove characters from the input sequence.
+  /**
+   * Removes @c n characters from the beginning of the input sequence. Blocks
+   * that no longer contain any of the input sequence are returned to the
+   * pool. If @c n is greater than the size of the input sequence, the entire
+   * input sequence is consumed.
+   */
+  void consume(std::size_t n) noexcept
+  {
+    if (n > size_)
+      n = size_;
+    offset_ += n;
+    size_ -= n;
+    if (size_ == 0 && output_size_ == 0)
+    {
+      reset();
+      return;
+    }
+    while (offset_ >= block_size_)
+    {
+      pool_->deallocate(blocks_.front());
+      blocks_.pop_front();
+      offset_ -= block_size_;
+    }
+  }
+
+private:
+  // Disallow copying and assignment.
+  segmented_buffer(const segmented_buffer&) = delete;
+  segmented_buffer& operator=(const segmented_buffer&) = delete;
+
+  // Helper function to get an executor's context.
+  template <typename T>
+  static execution_context& get_context(const T& t,
+      enable_if_t<execution::is_executor<T>::value>* = 0)
+  {
+    return asio::query(t, execution::context);
+  }
+
+  // Helper function to get an executor's context.
+  template <typename T>
+  static execution_context& get_context(const T& t,
+      enable_if_t<!execution::is_executor<T>::value>* = 0)
+  {
+    return t.context();
+  }
+
+  // Append blocks until there is room for n bytes after the input sequence.
+  void reserve(std::size_t n)
+  {
+    if (n > max_size_ || size_ > max_size_ - n)
+    {
+      std::length_error ex("segmented_buffer too long");
+      asio::detail::throw_exception(ex);
+    }
+
+    std::size_t required = offset_ + size_ + n;
+    while (blocks_.size() * block_size_ < required)
+      blocks_.push_back(pool_->allocate());
+  }
+
+  // Return all but one block to the pool once the buffer is empty.
+  void reset() noexcept
+  {
+    offset_ = 0;
+    while (blocks_.size() > 1)
+    {
+      pool_->deallocate(blocks_.back());
+      blocks_.pop_back();
+    }
+  }
+
+  std::shared_ptr<detail::segment_pool> pool_;
+  std::deque<char*> blocks_;
+  std::size_t block_size_;
+  std::size_t offset_;
+  std::size_t size_;
+  std::size_t output_size_;
+  std::size_t max_size_;
+};
+
+/// Adapts a segmented_buffer so that it meets the DynamicBuffer_v1 and
+/// DynamicBuffer_v2 type requirements.
+/**
+ * Objects of this type refer to, but do not own, a segmented_buffer object.
+ * They are created using the dynamic_buffer() function.
+ */
+class dynamic_segmented_buffer
+{
+public:
+  /// The type used to represent a sequence of constant buffers that refers to
+  /// the underlying memory.
+  typedef segmented_buffer::const_buffers_type const_buffers_type;
+
+  /// The type used to represent a sequence of mutable buffers that refers to
+  /// the underlying memory.
+  typedef segmented_buffer::mutable_buffers_type mutable_buffers_type;
+
+  /// Construct a dynamic buffer for a segmented_buffer object.
+  explicit dynamic_segmented_buffer(segmented_buffer& b) noexcept
+    : buffer_(b)
+  {
+  }
+
+  /// Copy construct a dynamic buffer.
+  dynamic_segmented_buffer(const dynamic_segmented_buffer& other) noexcept
+    : buffer_(other.buffer_)
+  {
+  }
+
+  /// Get the current size of the underlying memory.
+  std::size_t size() const noexcept
+  {
+    return buffer_.size();
+  }
+
+  /// Get the maximum size of the dynamic buffer.
+  std::size_t max_size() const noexcept
+  {
+    return buffer_.max_size();
+  }
+
+  /// Get the maximum size that the buffer may grow to without triggering
+  /// block allocation.
+  std::size_t capacity() const noexcept
+  {
+    return buffer_.capacity();
+  }
+
+#if !defined(ASIO_NO_DYNAMIC_BUFFER_V1)
+  /// DynamicBuffer_v1: Get a list of buffers that represents the input
+  /// sequence.
+  const_buffers_type data() const noexcept
+  {
+    return buffer_.data();
+  }
+#endif // !defined(ASIO_NO_DYNAMIC_BUFFER_V1)
+
+  /// DynamicBuffer_v2: Get a sequence of buffers that represents the
+  /// underlying memory.
+  mutable_buffers_type data(std::size_t pos, std::size_t n) noexcept
+  {
+    return buffer_.data(pos, n);
+  }
+
+  /// DynamicBuffer_v2: Get a sequence of buffers that represents the
+  /// underlying memory.
+  const_buffers_type data(std::size_t pos, std::size_t n) const noexcept
+  {
+    return static_cast<const segmented_buffer&>(buffer_).data(pos, n);
+  }
+
+#if !defined(ASIO_NO_DYNAMIC_BUFFER_V1)
+  /// DynamicBuffer_v1: Get a list of buffers that represents the output
+  /// sequence, with the given size.
+  mutable_buffers_type prepare(std::size_t n)
+  {
+    return buffer_.prepare(n);
+  }
+
+  /// DynamicBuffer_v1: Move bytes from the output sequence to the input
+  /// sequence.
+  void commit(std::size_t n) noexcept
+  {
+    buffer_.commit(n);
+  }
+#endif // !defined(ASIO_NO_DYNAMIC_BUFFER_V1)
+
+  /// DynamicBuffer_v2: Grow the underlying memory by the specified number of
+  /// bytes.
+  void grow(std::size_t n)
+  {
+    buffer_.grow(n);
+  }
+
+  /// DynamicBuffer_v2: Shrink the underlying memory by the specified number
+  /// of bytes.
+  void shrink(std::size_t n) noexcept
+  {
+    buffer_.shrink(n);
+  }
+
+  /// Consume the specified number of bytes from the beginning of the
+  /// underlying memory.
+  void consume(std::size_t n) noexcept
+  {
+    buffer_.consume(n);
+  }
+
+private:
+  segmented_buffer& buffer_;
+};
+
+/// Create a new dynamic buffer that represents the given segmented_buffer.
+/**
+ * @returns <tt>dynamic_segmented_buffer(b)</tt>.
+ */
+inline dynamic_segmented_buffer dynamic_buffer(segmented_buffer& b) noexcept
+{
+  return dynamic_segmented_buffer(b);
+}
+
+ASIO_INLINE_NAMESPACE_END
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_SEGMENTED_BUFFER_HPP
@@ -504,6 +504,53 @@ public:
     enable_connection_aborted;
 #endif
 
+  /// Socket option to perform send operations using io_uring.
+  /**
+   * Implements a custom socket option that determines whether asynchronous
+   * send operations on the socket are performed by io_uring, while readiness
+   * for all other operations continues to be monitored by the reactor. This
+   * suits sockets that carry bulk outgoing data, while leaving the many idle
+   * sockets of a typical server on the cheaper reactor. By default the option
+   * is false.
+   *
+   * The option has an effect only when the program is built with
+   * @c ASIO_HAS_IO_URING, and without @c ASIO_HAS_IO_URING_AS_DEFAULT, on a
+   * platform where the reactor is epoll. Elsewhere the option may be set, but
+   * is ignored. It should be set before any send operations are started, as
+   * sends that are queued to the reactor are not ordered with respect to
+   * those queued to io_uring.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::socket_base::io_uring_sends option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::socket_base::io_uring_sends option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined io_uring_sends;
+#else
+  typedef asio::detail::socket_option::boolean<
+    asio::detail::custom_socket_option_level,
+    asio::detail::io_uring_sends_option>
+    io_uring_sends;
+#endif
+
   /// IO control command to get the amount of data that can be read without
   /// blocking.
   /**
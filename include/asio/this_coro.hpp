@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/config.hpp"
+#include <cstddef>
 #include "asio/detail/type_traits.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -167,6 +168,62 @@ throw_if_cancelled();
 ASIO_NODISCARD constexpr unspecified
 throw_if_cancelled(bool value);
 
+/// Returns an awaitable object that may be used to determine how many
+/// consecutive immediate completions may resume the coroutine inline.
+/**
+ * @par Example
+ * @code asio::awaitable<void> my_coroutine()
+ * {
+ *   std::size_t limit
+ *     = co_await asio::this_coro::immediate_resumption_limit();
+ *
+ *   // ...
+ * } @endcode
+ */
+ASIO_NODISCARD constexpr unspecified
+immediate_resumption_limit();
+
+/// Returns an awaitable object that may be used to specify how many
+/// consecutive immediate completions may resume the coroutine inline.
+/**
+ * When an asynchronous operation completes immediately, for example when an
+ * @c async_read_some finds data already available, its completion handler is
+ * normally submitted to the associated immediate executor, and the coroutine
+ * is resumed only after a round trip through the scheduler. Setting a
+ * non-zero limit allows such a completion to instead resume the coroutine
+ * directly, by handing the coroutine stack back to the thread that is
+ * already resuming it, provided the coroutine's executor permits the
+ * completion to run in the current thread.
+ *
+ * No additional stack space is consumed by an immediate resumption. The limit
+ * bounds the number of consecutive immediate resumptions, after which the
+ * completion is once again submitted to the executor so that other work is
+ * given a chance to run. The default limit is zero, which disables immediate
+ * resumption.
+ *
+ * Immediate resumption is only available when requiring the @c
+ * execution::blocking.never property on the I/O object's executor yields the
+ * coroutine's executor type, and on the coroutine's executor leaves its type
+ * unchanged, as is the case when both are @c any_io_executor. Whenever an
+ * immediate completion does not resume the coroutine inline, including when
+ * the limit is zero, it is submitted to the associated immediate executor
+ * that would be used for any other completion handler: the I/O object's
+ * executor with @c execution::blocking.never.
+ *
+ * @par Example
+ * @code asio::awaitable<void> my_coroutine()
+ * {
+ *   co_await asio::this_coro::immediate_resumption_limit(16);
+ *
+ *   // ...
+ * } @endcode
+ *
+ * @note The limit is shared by all coroutines in the same "thread of
+ * execution" that was created using asio::co_spawn.
+ */
+ASIO_NODISCARD constexpr unspecified
+immediate_resumption_limit(std::size_t value);
+
 #else // defined(GENERATING_DOCUMENTATION)
 
 struct reset_cancellation_state_0_t
@@ -258,6 +315,35 @@ throw_if_cancelled(bool value)
   return throw_if_cancelled_1_t(value);
 }
 
+struct immediate_resumption_limit_0_t
+{
+  constexpr immediate_resumption_limit_0_t()
+  {
+  }
+};
+
+ASIO_NODISCARD inline constexpr immediate_resumption_limit_0_t
+immediate_resumption_limit()
+{
+  return immediate_resumption_limit_0_t();
+}
+
+struct immediate_resumption_limit_1_t
+{
+  explicit constexpr immediate_resumption_limit_1_t(std::size_t val)
+    : value(val)
+  {
+  }
+
+  std::size_t value;
+};
+
+ASIO_NODISCARD inline constexpr immediate_resumption_limit_1_t
+immediate_resumption_limit(std::size_t value)
+{
+  return immediate_resumption_limit_1_t(value);
+}
+
 #endif // defined(GENERATING_DOCUMENTATION)
 
 } // namespace this_coro
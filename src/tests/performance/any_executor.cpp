@@ -0,0 +1,139 @@
+//
+// any_executor.cpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+
+typedef asio::execution::unique_any_executor<
+    asio::execution::context_as_t<asio::execution_context&>,
+    asio::execution::blocking_t::never_t,
+    asio::execution::prefer_only<asio::execution::blocking_t::possibly_t>,
+    asio::execution::prefer_only<
+      asio::execution::outstanding_work_t::tracked_t>,
+    asio::execution::prefer_only<
+      asio::execution::outstanding_work_t::untracked_t>,
+    asio::execution::prefer_only<asio::execution::relationship_t::fork_t>,
+    asio::execution::prefer_only<
+      asio::execution::relationship_t::continuation_t>
+  > unique_io_executor;
+
+// Prevents the compiler from discarding the work being measured.
+const void* volatile sink;
+
+template <typename Function>
+void measure(const char* name, int iterations, Function f)
+{
+  auto start = std::chrono::steady_clock::now();
+  f(iterations);
+  auto stop = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::cout << name << ": " << ns / iterations << " ns/op\n";
+}
+
+// Copies the executor and destroys the copy, as happens each time an
+// asynchronous operation captures the I/O object's executor.
+template <typename Executor>
+void copy_loop(const Executor& ex, int iterations)
+{
+  for (int i = 0; i < iterations; ++i)
+  {
+    Executor copy(ex);
+    sink = copy.template target<void>();
+  }
+}
+
+// Moves the executor back and forth between two wrappers.
+template <typename Executor>
+void move_loop(Executor& ex, int iterations)
+{
+  for (int i = 0; i < iterations; ++i)
+  {
+    Executor tmp(std::move(ex));
+    ex = std::move(tmp);
+    sink = ex.template target<void>();
+  }
+}
+
+// Submits a chain of function objects through the executor, each of which
+// submits its successor, and runs them to completion.
+template <typename Executor>
+void execute_loop(asio::io_context& ioc, const Executor& ex, int iterations)
+{
+  struct step
+  {
+    const Executor* ex_;
+    int* remaining_;
+
+    void operator()() const
+    {
+      if (--*remaining_ > 0)
+        ex_->execute(*this);
+    }
+  };
+
+  int remaining = iterations;
+  ex.execute(step{&ex, &remaining});
+  ioc.restart();
+  ioc.run();
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 2)
+  {
+    std::cerr << "Usage: any_executor <iterations>\n";
+    return 1;
+  }
+
+  const int iterations = std::atoi(argv[1]);
+
+  asio::io_context ioc(1);
+
+  // Use non-blocking executors so that each function object is queued rather
+  // than run inline.
+  asio::any_io_executor inline_ex =
+    asio::require(ioc.get_executor(), asio::execution::blocking.never);
+  asio::any_io_executor strand_ex = asio::make_strand(inline_ex);
+  unique_io_executor unique_strand_ex = asio::make_strand(inline_ex);
+
+  std::cout << "sizeof(any_io_executor): "
+    << sizeof(asio::any_io_executor) << "\n";
+  std::cout << "strand<any_io_executor> stored inline: "
+    << (strand_ex.target<void>() >= static_cast<const void*>(&strand_ex)
+        && strand_ex.target<void>() < static_cast<const void*>(&strand_ex + 1)
+        ? "yes" : "no") << "\n";
+
+  measure("any_io_executor copy, io_context executor", iterations,
+      [&](int n){ copy_loop(inline_ex, n); });
+
+  measure("any_io_executor copy, strand<any_io_executor>", iterations,
+      [&](int n){ copy_loop(strand_ex, n); });
+
+  measure("any_io_executor move, strand<any_io_executor>", iterations,
+      [&](int n){ move_loop(strand_ex, n); });
+
+  measure("unique_any_executor move, strand<any_io_executor>", iterations,
+      [&](int n){ move_loop(unique_strand_ex, n); });
+
+  measure("any_io_executor execute, io_context executor", iterations,
+      [&](int n){ execute_loop(ioc, inline_ex, n); });
+
+  measure("any_io_executor execute, strand<any_io_executor>", iterations,
+      [&](int n){ execute_loop(ioc, strand_ex, n); });
+
+  measure("unique_any_executor execute, strand<any_io_executor>", iterations,
+      [&](int n){ execute_loop(ioc, unique_strand_ex, n); });
+
+  return 0;
+}
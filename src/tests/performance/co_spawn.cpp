@@ -0,0 +1,186 @@
+//
+// co_spawn.cpp
+// ~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define ASIO_ENABLE_HANDLER_ALLOCATION_STATS 1
+
+#include "asio.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#if defined(ASIO_HAS_CO_AWAIT)
+
+// Counts the calls to operator new. Memory obtained by the recycling
+// allocator from the system allocator is counted as a miss in the
+// handler_allocation_stats instead. All forms of operator new and operator
+// delete are replaced together, so that every allocation is counted and is
+// released by the matching deallocation function.
+std::atomic<std::size_t> new_calls(0);
+
+void* counted_allocate(std::size_t size)
+{
+  ++new_calls;
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void counted_deallocate(void* p) noexcept
+{
+  std::free(p);
+}
+
+void* operator new(std::size_t size)
+{
+  return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return counted_allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+  counted_deallocate(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  counted_deallocate(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  counted_deallocate(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+  counted_deallocate(p);
+}
+
+// One level of a request-handling call tree. The levels alternate between
+// two frame sizes, and the innermost level suspends by posting to the
+// executor, as a real request would when it performs I/O.
+asio::awaitable<int> layer(int depth)
+{
+  volatile char scratch[64] = {};
+  if (depth == 0)
+  {
+    co_await asio::post(asio::use_awaitable);
+    co_return scratch[0];
+  }
+
+  if (depth % 2)
+  {
+    volatile char more[256] = {};
+    co_return more[0] + co_await layer(depth - 1);
+  }
+
+  co_return scratch[1] + co_await layer(depth - 1);
+}
+
+// A connection that handles a sequence of requests one after another.
+asio::awaitable<void> connection(int num_requests, int depth)
+{
+  for (int i = 0; i < num_requests; ++i)
+    co_await layer(depth);
+}
+
+std::size_t total_misses(const asio::handler_allocation_stats& stats)
+{
+  std::size_t misses = 0;
+  for (int i = 0; i < asio::handler_allocation_stats::purpose_count; ++i)
+    misses += stats.get(
+        static_cast<asio::handler_allocation_stats::purpose>(i)).misses;
+  return misses;
+}
+
+template <typename Context>
+void run_connections(const char* name, Context& ctx, int num_connections,
+    int requests_per_connection, int depth)
+{
+  asio::handler_allocation_stats before =
+    asio::handler_allocation_stats::current();
+  std::size_t new_calls_before = new_calls;
+  auto start = std::chrono::steady_clock::now();
+
+  std::atomic<int> remaining(num_connections);
+  for (int i = 0; i < num_connections; ++i)
+  {
+    asio::co_spawn(ctx,
+        connection(requests_per_connection, depth),
+        [&remaining](std::exception_ptr){ --remaining; });
+  }
+
+  while (remaining != 0)
+    std::this_thread::yield();
+
+  auto stop = std::chrono::steady_clock::now();
+  std::size_t new_calls_after = new_calls;
+  asio::handler_allocation_stats after =
+    asio::handler_allocation_stats::current();
+
+  const asio::handler_allocation_stats::counters& b =
+    before.get(asio::handler_allocation_stats::awaitable_frame);
+  const asio::handler_allocation_stats::counters& a =
+    after.get(asio::handler_allocation_stats::awaitable_frame);
+
+  double requests = static_cast<double>(num_connections)
+    * requests_per_connection;
+  double secs = std::chrono::duration<double>(stop - start).count();
+  std::cout << name << ", depth " << depth << ": "
+    << requests / secs << " requests/s, "
+    << (a.hits - b.hits) / requests << " frame hits/request, "
+    << (a.misses - b.misses) / requests << " frame misses/request, "
+    << (total_misses(after) - total_misses(before)
+        + new_calls_after - new_calls_before) / requests
+    << " system allocations/request\n";
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 5)
+  {
+    std::cerr << "Usage: co_spawn <threads> <connections> "
+      "<requests_per_connection> <depth>\n";
+    return 1;
+  }
+
+  const int num_threads = std::atoi(argv[1]);
+  const int num_connections = std::atoi(argv[2]);
+  const int requests_per_connection = std::atoi(argv[3]);
+  const int depth = std::atoi(argv[4]);
+
+  asio::thread_pool pool(num_threads);
+
+  // Warm the caches before measuring.
+  run_connections("warm-up", pool, num_connections, 1, depth);
+
+  run_connections("thread_pool", pool,
+      num_connections, requests_per_connection, depth);
+
+  pool.join();
+
+  return 0;
+}
+
+#else // defined(ASIO_HAS_CO_AWAIT)
+
+int main()
+{
+  std::cout << "Coroutines not supported\n";
+  return 0;
+}
+
+#endif // defined(ASIO_HAS_CO_AWAIT)
@@ -0,0 +1,121 @@
+//
+// hash_map.cpp
+// ~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio/detail/hash_map.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Prevents the compiler from discarding the work being measured.
+volatile std::size_t sink;
+
+template <typename Function>
+void measure(const char* name, std::size_t iterations, Function f)
+{
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto stop = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::cout << name << ": " << ns / iterations << " ns/op\n";
+}
+
+// Runs the insert, find and erase patterns used by the reactors, with
+// descriptors as keys, against a map type.
+template <typename Map>
+void run(const char* map_name, const std::vector<int>& descriptors,
+    const std::vector<int>& lookups)
+{
+  const std::size_t n = descriptors.size();
+  std::string prefix(map_name);
+  Map m;
+
+  measure((prefix + " insert").c_str(), n, [&]
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          m.insert(typename Map::value_type(descriptors[i], i));
+      });
+
+  measure((prefix + " find hit").c_str(), n, [&]
+      {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < n; ++i)
+          total += m.find(lookups[i])->second;
+        sink = total;
+      });
+
+  measure((prefix + " find miss").c_str(), n, [&]
+      {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < n; ++i)
+          total += (m.find(lookups[i] + static_cast<int>(n)) == m.end());
+        sink = total;
+      });
+
+  measure((prefix + " iterate").c_str(), n, [&]
+      {
+        std::size_t total = 0;
+        for (typename Map::iterator i = m.begin(); i != m.end(); ++i)
+          total += i->second;
+        sink = total;
+      });
+
+  // Each descriptor is removed and then registered again, as happens when
+  // connections are closed and new ones accepted while the map stays large.
+  measure((prefix + " erase and reinsert").c_str(), n, [&]
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          m.erase(m.find(lookups[i]));
+          m.insert(typename Map::value_type(lookups[i], i));
+        }
+      });
+
+  measure((prefix + " erase").c_str(), n, [&]
+      {
+        for (std::size_t i = 0; i < n; ++i)
+          m.erase(m.find(descriptors[i]));
+      });
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 2)
+  {
+    std::cerr << "Usage: hash_map <descriptors>\n";
+    return 1;
+  }
+
+  const std::size_t n = std::atoi(argv[1]);
+
+  // Descriptors are small, dense integers. They are registered in one
+  // arbitrary order and looked up in another, as readiness events arrive.
+  std::vector<int> descriptors(n);
+  for (std::size_t i = 0; i < n; ++i)
+    descriptors[i] = static_cast<int>(i);
+  std::mt19937 gen(1);
+  std::shuffle(descriptors.begin(), descriptors.end(), gen);
+  std::vector<int> lookups(descriptors);
+  std::shuffle(lookups.begin(), lookups.end(), gen);
+
+  run<asio::detail::hash_map<int, std::size_t>>(
+      "hash_map", descriptors, lookups);
+  run<std::unordered_map<int, std::size_t>>(
+      "unordered_map", descriptors, lookups);
+
+  return 0;
+}
@@ -0,0 +1,160 @@
+//
+// hybrid_send.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using asio::ip::tcp;
+
+// Create a connected pair of loopback sockets.
+void connect_pair(asio::io_context& ioc, tcp::socket& a, tcp::socket& b)
+{
+  tcp::acceptor acceptor(ioc,
+      tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  a.connect(acceptor.local_endpoint());
+  acceptor.accept(b);
+}
+
+// Sends a fixed amount of data from one end of a connection to the other,
+// while a number of idle connections wait for data that never arrives. The
+// sender connects asynchronously, which puts its descriptor into non-blocking
+// mode, and also waits to read, as a full-duplex protocol would.
+class workload
+{
+public:
+  workload(asio::io_context& ioc, std::size_t block_size, std::size_t total)
+    : io_context_(ioc),
+      sender_(ioc),
+      receiver_(ioc),
+      send_buffer_(block_size, 'x'),
+      receive_buffer_(block_size),
+      sender_read_buffer_(1),
+      remaining_to_send_(total),
+      remaining_to_receive_(total)
+  {
+    tcp::acceptor acceptor(ioc,
+        tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    bool connected = false;
+    sender_.async_connect(acceptor.local_endpoint(),
+        [&connected](asio::error_code ec)
+        {
+          if (ec)
+            throw asio::system_error(ec);
+          connected = true;
+        });
+    acceptor.accept(receiver_);
+    while (!connected)
+      ioc.run_one();
+  }
+
+  void start(bool io_uring_sends)
+  {
+    sender_.set_option(asio::socket_base::io_uring_sends(io_uring_sends));
+    sender_.async_read_some(asio::buffer(sender_read_buffer_),
+        [](asio::error_code, std::size_t){});
+    do_send();
+    do_receive();
+  }
+
+private:
+  void do_send()
+  {
+    std::size_t n = remaining_to_send_ < send_buffer_.size()
+      ? remaining_to_send_ : send_buffer_.size();
+    asio::async_write(sender_, asio::buffer(send_buffer_, n),
+        [this](asio::error_code ec, std::size_t bytes)
+        {
+          remaining_to_send_ -= bytes;
+          if (!ec && remaining_to_send_ > 0)
+            do_send();
+        });
+  }
+
+  void do_receive()
+  {
+    receiver_.async_read_some(asio::buffer(receive_buffer_),
+        [this](asio::error_code ec, std::size_t bytes)
+        {
+          remaining_to_receive_ -= bytes;
+          if (!ec && remaining_to_receive_ > 0)
+            do_receive();
+          else
+            io_context_.stop();
+        });
+  }
+
+  asio::io_context& io_context_;
+  tcp::socket sender_;
+  tcp::socket receiver_;
+  std::vector<char> send_buffer_;
+  std::vector<char> receive_buffer_;
+  std::vector<char> sender_read_buffer_;
+  std::size_t remaining_to_send_;
+  std::size_t remaining_to_receive_;
+};
+
+double run(bool io_uring_sends, int idle_connections,
+    std::size_t block_size, std::size_t total)
+{
+  asio::io_context ioc;
+
+  std::vector<std::unique_ptr<tcp::socket>> idle;
+  char idle_buffer[1];
+  for (int i = 0; i < idle_connections; ++i)
+  {
+    idle.emplace_back(new tcp::socket(ioc));
+    idle.emplace_back(new tcp::socket(ioc));
+    connect_pair(ioc, *idle[idle.size() - 2], *idle.back());
+    idle.back()->async_read_some(asio::buffer(idle_buffer),
+        [](asio::error_code, std::size_t){});
+  }
+
+  workload w(ioc, block_size, total);
+  w.start(io_uring_sends);
+
+  auto start = std::chrono::steady_clock::now();
+  ioc.run();
+  auto stop = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4)
+  {
+    std::cerr << "Usage: hybrid_send <idle_connections> "
+      "<block_size> <total_megabytes>\n";
+    return 1;
+  }
+
+  const int idle_connections = std::atoi(argv[1]);
+  const std::size_t block_size = std::atoi(argv[2]);
+  const std::size_t total = std::atoi(argv[3]) * std::size_t(1024 * 1024);
+
+#if !defined(ASIO_HAS_IO_URING) || defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+  std::cout << "Not using the hybrid backend: "
+    "both runs use the same implementation\n";
+#endif
+
+  for (int i = 0; i < 2; ++i)
+  {
+    bool io_uring_sends = (i == 1);
+    double secs = run(io_uring_sends, idle_connections, block_size, total);
+    std::cout << (io_uring_sends ? "io_uring sends" : "reactor sends")
+      << ": " << total / secs / (1024 * 1024) << " MB/s\n";
+  }
+
+  return 0;
+}
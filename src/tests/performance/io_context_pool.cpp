@@ -0,0 +1,129 @@
+//
+// io_context_pool.cpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Each chain models a connection: a sequence of handlers that must run one
+// after another on the same executor, each posting its successor.
+template <typename Executor>
+class chain
+{
+public:
+  chain(const Executor& ex, int length, std::atomic<int>& remaining)
+    : executor_(ex),
+      length_(length),
+      count_(0),
+      remaining_(remaining)
+  {
+  }
+
+  void start()
+  {
+    asio::post(executor_, [this]{ step(); });
+  }
+
+private:
+  void step()
+  {
+    if (++count_ < length_)
+      asio::post(executor_, [this]{ step(); });
+    else
+      --remaining_;
+  }
+
+  Executor executor_;
+  int length_;
+  int count_;
+  std::atomic<int>& remaining_;
+};
+
+template <typename GetExecutor>
+double run_chains(GetExecutor get_executor, int num_chains, int chain_length)
+{
+  typedef decltype(get_executor()) executor_type;
+
+  std::atomic<int> remaining(num_chains);
+  std::vector<chain<executor_type>*> chains;
+  for (int i = 0; i < num_chains; ++i)
+    chains.push_back(new chain<executor_type>(
+          get_executor(), chain_length, remaining));
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < num_chains; ++i)
+    chains[i]->start();
+  while (remaining != 0)
+    std::this_thread::yield();
+  auto stop = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < num_chains; ++i)
+    delete chains[i];
+
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4)
+  {
+    std::cerr << "Usage: io_context_pool <threads> <chains> <chain_length>\n";
+    return 1;
+  }
+
+  const int num_threads = std::atoi(argv[1]);
+  const int num_chains = std::atoi(argv[2]);
+  const int chain_length = std::atoi(argv[3]);
+  const double num_handlers = static_cast<double>(num_chains) * chain_length;
+
+  {
+    asio::io_context ioc(num_threads);
+    auto work = asio::make_work_guard(ioc);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; ++i)
+      threads.emplace_back([&ioc]{ ioc.run(); });
+
+    double secs = run_chains([&ioc]{ return ioc.get_executor(); },
+        num_chains, chain_length);
+
+    std::cout << "single io_context, " << num_threads << " threads: "
+      << secs << " s, " << num_handlers / secs << " handlers/s\n";
+
+    work.reset();
+    for (auto& t : threads)
+      t.join();
+  }
+
+  {
+    asio::io_context_pool pool(num_threads);
+
+    double secs = run_chains([&pool]{ return pool.get_executor(); },
+        num_chains, chain_length);
+
+    std::cout << "io_context_pool, round-robin, " << num_threads
+      << " contexts: " << secs << " s, "
+      << num_handlers / secs << " handlers/s\n";
+
+    secs = run_chains([&pool]{ return pool.get_least_loaded_executor(); },
+        num_chains, chain_length);
+
+    std::cout << "io_context_pool, least-loaded, " << num_threads
+      << " contexts: " << secs << " s, "
+      << num_handlers / secs << " handlers/s\n";
+
+    pool.join();
+  }
+
+  return 0;
+}
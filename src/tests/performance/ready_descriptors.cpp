@@ -0,0 +1,84 @@
+//
+// ready_descriptors.cpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio/config.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/udp.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using asio::ip::udp;
+
+// Makes a large number of descriptors ready at once, so that each reactor
+// wakeup has many events to dispatch. Each round starts a receive on every
+// socket, sends one datagram to each, and then measures the time taken to
+// run the io_context until all of the receives have completed.
+int main(int argc, char* argv[])
+{
+  if (argc < 3 || argc > 4)
+  {
+    std::cerr << "Usage: ready_descriptors <descriptors> <rounds> [<config>]\n";
+    std::cerr << "For example:\n";
+    std::cerr << "  ready_descriptors 10000 20 reactor.epoll_max_events=1024\n";
+    return 1;
+  }
+
+  const int descriptor_count = std::atoi(argv[1]);
+  const int round_count = std::atoi(argv[2]);
+
+  asio::io_context io_context(
+      asio::config_from_string(argc == 4 ? argv[3] : ""));
+
+  udp::socket sender(io_context, udp::endpoint(udp::v4(), 0));
+  std::vector<std::unique_ptr<udp::socket>> receivers;
+  std::vector<udp::endpoint> endpoints;
+  for (int i = 0; i < descriptor_count; ++i)
+  {
+    receivers.emplace_back(new udp::socket(io_context,
+          udp::endpoint(asio::ip::address_v4::loopback(), 0)));
+    endpoints.push_back(receivers.back()->local_endpoint());
+  }
+
+  char send_data[1] = { 0 };
+  std::vector<char> receive_data(descriptor_count);
+  int completed = 0;
+  std::chrono::steady_clock::duration total_time{};
+
+  for (int round = 0; round < round_count; ++round)
+  {
+    for (int i = 0; i < descriptor_count; ++i)
+    {
+      receivers[i]->async_receive(
+          asio::buffer(&receive_data[i], 1),
+          [&completed](asio::error_code ec, std::size_t)
+          {
+            if (!ec)
+              ++completed;
+          });
+    }
+
+    for (int i = 0; i < descriptor_count; ++i)
+      sender.send_to(asio::buffer(send_data), endpoints[i]);
+
+    auto start = std::chrono::steady_clock::now();
+    io_context.restart();
+    io_context.run();
+    total_time += std::chrono::steady_clock::now() - start;
+  }
+
+  double ns = std::chrono::duration<double, std::nano>(total_time).count();
+  std::cout << "completed " << completed << " receives, "
+    << ns / completed << " ns per ready descriptor\n";
+
+  return 0;
+}
@@ -0,0 +1,60 @@
+//
+// socket_churn.cpp
+// ~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "asio/io_context.hpp"
+#include "asio/ip/udp.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Opens and closes sockets on a single io_context from several threads, as
+// happens when many short-lived connections are accepted and closed. Each
+// open and close allocates and frees the reactor's per-descriptor state.
+int main(int argc, char* argv[])
+{
+  if (argc != 3)
+  {
+    std::cerr << "Usage: socket_churn <threads> <sockets per thread>\n";
+    return 1;
+  }
+
+  const int thread_count = std::atoi(argv[1]);
+  const int socket_count = std::atoi(argv[2]);
+
+  asio::io_context io_context;
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    threads.emplace_back([&io_context, socket_count]
+        {
+          for (int j = 0; j < socket_count; ++j)
+          {
+            asio::ip::udp::socket socket(io_context, asio::ip::udp::v4());
+          }
+        });
+  }
+
+  for (std::thread& t : threads)
+    t.join();
+
+  auto stop = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  double total = static_cast<double>(thread_count) * socket_count;
+  std::cout << "open and close: " << ns / total << " ns/op, "
+    << total * 1e9 / ns << " ops/s\n";
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+//
+// aligned_buffer_pool.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/aligned_buffer_pool.hpp"
+
+#include <stdexcept>
+#include "asio/io_context.hpp"
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// aligned_buffer_pool_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that aligned_buffer_pool operates correctly at
+// runtime.
+
+namespace aligned_buffer_pool_runtime {
+
+void test()
+{
+  using namespace asio;
+
+  io_context ioc;
+
+  {
+    aligned_buffer_pool pool(ioc, 3, 1000, 512);
+    ASIO_CHECK(pool.buffer_size() == 1024);
+    ASIO_CHECK(pool.alignment() == 512);
+    ASIO_CHECK(pool.capacity() == 3);
+    ASIO_CHECK(pool.available() == 3);
+
+    mutable_registered_buffer b1 = pool.acquire();
+    mutable_registered_buffer b2 = pool.acquire();
+    mutable_registered_buffer b3 = pool.acquire();
+    mutable_registered_buffer b4 = pool.acquire();
+    ASIO_CHECK(pool.available() == 0);
+    ASIO_CHECK(b1.size() == 1024);
+    ASIO_CHECK(b2.size() == 1024);
+    ASIO_CHECK(b3.size() == 1024);
+    ASIO_CHECK(b4.size() == 0);
+    ASIO_CHECK(reinterpret_cast<std::size_t>(b1.data()) % 512 == 0);
+    ASIO_CHECK(reinterpret_cast<std::size_t>(b2.data()) % 512 == 0);
+    ASIO_CHECK(reinterpret_cast<std::size_t>(b3.data()) % 512 == 0);
+    ASIO_CHECK(b1.data() != b2.data());
+    ASIO_CHECK(b2.data() != b3.data());
+
+    pool.release(b2);
+    ASIO_CHECK(pool.available() == 1);
+
+    mutable_registered_buffer b5 = pool.acquire();
+    ASIO_CHECK(b5.data() == b2.data());
+    ASIO_CHECK(b5.id() == b2.id());
+
+    pool.release(mutable_registered_buffer());
+    pool.release(b1 + 1);
+    ASIO_CHECK(pool.available() == 0);
+
+    pool.release(b1);
+    pool.release(b3);
+    pool.release(b5);
+    ASIO_CHECK(pool.available() == 3);
+
+    mutable_registered_buffer b6 = pool.acquire();
+    pool.release(b6);
+    pool.release(b6);
+    ASIO_CHECK(pool.available() == 3);
+
+    mutable_registered_buffer b7 = pool.acquire();
+    mutable_registered_buffer b8 = pool.acquire();
+    mutable_registered_buffer b9 = pool.acquire();
+    ASIO_CHECK(b7.data() != b8.data());
+    ASIO_CHECK(b8.data() != b9.data());
+    ASIO_CHECK(b7.data() != b9.data());
+    ASIO_CHECK(pool.available() == 0);
+  }
+
+  bool threw = false;
+  try
+  {
+    aligned_buffer_pool pool(ioc.get_executor(), 1, 1, 3);
+  }
+  catch (std::invalid_argument&)
+  {
+    threw = true;
+  }
+  ASIO_CHECK(threw);
+}
+
+} // namespace aligned_buffer_pool_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "aligned_buffer_pool",
+  ASIO_TEST_CASE(aligned_buffer_pool_runtime::test)
+)
@@ -0,0 +1,298 @@
+//
+// basic_connection_pool.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/basic_connection_pool.hpp"
+
+#include <chrono>
+#include <functional>
+#include <vector>
+#include "asio/bind_cancellation_slot.hpp"
+#include "asio/cancellation_signal.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "unit_test.hpp"
+
+namespace bindns = std;
+using bindns::placeholders::_1;
+using bindns::placeholders::_2;
+
+typedef asio::basic_connection_pool<asio::ip::tcp> pool_type;
+
+// A listener that accepts and holds every incoming connection.
+class holding_listener
+{
+public:
+  explicit holding_listener(asio::io_context& io_context)
+    : acceptor_(io_context,
+        asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0))
+  {
+    start_accept();
+  }
+
+  asio::ip::tcp::endpoint endpoint()
+  {
+    return acceptor_.local_endpoint();
+  }
+
+  std::size_t accepted() const
+  {
+    return sockets_.size();
+  }
+
+  void close_all()
+  {
+    for (std::size_t i = 0; i < sockets_.size(); ++i)
+      sockets_[i].close();
+  }
+
+private:
+  void start_accept()
+  {
+    acceptor_.async_accept(
+        bindns::bind(&holding_listener::handle_accept, this, _1, _2));
+  }
+
+  void handle_accept(const asio::error_code& ec, asio::ip::tcp::socket s)
+  {
+    if (!ec)
+    {
+      sockets_.push_back(std::move(s));
+      start_accept();
+    }
+  }
+
+  asio::ip::tcp::acceptor acceptor_;
+  std::vector<asio::ip::tcp::socket> sockets_;
+};
+
+void acquire_handler(const asio::error_code& ec,
+    pool_type::socket_type s, asio::error_code* out_ec,
+    pool_type::socket_type* out_socket)
+{
+  *out_ec = ec;
+  *out_socket = std::move(s);
+}
+
+void test_acquire_and_reuse()
+{
+  asio::io_context io_context;
+  holding_listener listener(io_context);
+  pool_type pool(io_context, 2, std::chrono::seconds(30));
+  asio::ip::tcp::endpoint ep = listener.endpoint();
+
+  asio::error_code ec1, ec2;
+  pool_type::socket_type s1(io_context), s2(io_context);
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec1, &s1));
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec2, &s2));
+  io_context.run_for(std::chrono::milliseconds(100));
+  ASIO_CHECK(!ec1);
+  ASIO_CHECK(!ec2);
+  ASIO_CHECK(s1.is_open());
+  ASIO_CHECK(s2.is_open());
+  ASIO_CHECK(pool.connection_count(ep) == 2);
+  ASIO_CHECK(listener.accepted() == 2);
+
+  // The limit has been reached, so a third acquire waits for a release.
+  asio::error_code ec3 = asio::error::would_block;
+  pool_type::socket_type s3(io_context);
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec3, &s3));
+  io_context.restart();
+  io_context.run_for(std::chrono::milliseconds(50));
+  ASIO_CHECK(ec3 == asio::error::would_block);
+  ASIO_CHECK(!s3.is_open());
+
+  asio::ip::tcp::endpoint local1 = s1.local_endpoint();
+  pool.release(ep, std::move(s1));
+  io_context.restart();
+  io_context.run_for(std::chrono::milliseconds(50));
+  ASIO_CHECK(!ec3);
+  ASIO_CHECK(s3.is_open());
+  ASIO_CHECK(s3.local_endpoint() == local1);
+  ASIO_CHECK(pool.idle_count() == 0);
+
+  // Released sockets are kept idle and reused.
+  asio::ip::tcp::endpoint local2 = s2.local_endpoint();
+  pool.release(ep, std::move(s2));
+  ASIO_CHECK(pool.idle_count() == 1);
+  pool_type::socket_type s4(io_context);
+  asio::error_code ec4;
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec4, &s4));
+  io_context.restart();
+  io_context.run_for(std::chrono::milliseconds(50));
+  ASIO_CHECK(!ec4);
+  ASIO_CHECK(s4.local_endpoint() == local2);
+  ASIO_CHECK(pool.idle_count() == 0);
+  ASIO_CHECK(listener.accepted() == 2);
+
+  // Releasing a closed socket frees up its slot.
+  s4.close();
+  pool.release(ep, std::move(s4));
+  ASIO_CHECK(pool.connection_count(ep) == 1);
+}
+
+void test_liveness_check()
+{
+  asio::io_context io_context;
+  holding_listener listener(io_context);
+  pool_type pool(io_context, 1, std::chrono::seconds(30));
+  asio::ip::tcp::endpoint ep = listener.endpoint();
+
+  asio::error_code ec;
+  pool_type::socket_type s(io_context);
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec, &s));
+  io_context.run_for(std::chrono::milliseconds(100));
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(listener.accepted() == 1);
+  pool.release(ep, std::move(s));
+
+  // The peer closes the idle connection, so a new connection is established.
+  listener.close_all();
+  io_context.restart();
+  io_context.run_for(std::chrono::milliseconds(50));
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec, &s));
+  io_context.restart();
+  io_context.run_for(std::chrono::milliseconds(100));
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(s.is_open());
+  ASIO_CHECK(listener.accepted() == 2);
+  ASIO_CHECK(pool.connection_count(ep) == 1);
+}
+
+void test_idle_eviction()
+{
+  asio::io_context io_context;
+  holding_listener listener(io_context);
+  pool_type pool(io_context, 2, std::chrono::milliseconds(50));
+  asio::ip::tcp::endpoint ep = listener.endpoint();
+
+  asio::error_code ec;
+  pool_type::socket_type s(io_context);
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec, &s));
+  io_context.run_for(std::chrono::milliseconds(100));
+  ASIO_CHECK(!ec);
+  pool.release(ep, std::move(s));
+  ASIO_CHECK(pool.idle_count() == 1);
+
+  io_context.restart();
+  io_context.run_for(std::chrono::milliseconds(200));
+  ASIO_CHECK(pool.idle_count() == 0);
+  ASIO_CHECK(pool.connection_count(ep) == 0);
+}
+
+void test_connect_error()
+{
+  asio::io_context io_context;
+  asio::ip::tcp::endpoint ep;
+  {
+    asio::ip::tcp::acceptor acceptor(io_context,
+        asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+    ep = acceptor.local_endpoint();
+  }
+  pool_type pool(io_context, 1, std::chrono::seconds(30));
+
+  asio::error_code ec;
+  pool_type::socket_type s(io_context);
+  pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec, &s));
+  io_context.run_for(std::chrono::milliseconds(100));
+  ASIO_CHECK(!!ec);
+  ASIO_CHECK(!s.is_open());
+  ASIO_CHECK(pool.connection_count(ep) == 0);
+}
+
+void test_cancel_and_destroy()
+{
+  asio::io_context io_context;
+  holding_listener listener(io_context);
+  asio::ip::tcp::endpoint ep = listener.endpoint();
+  asio::error_code ec1, ec2 = asio::error::would_block, ec3;
+  pool_type::socket_type s1(io_context), s2(io_context), s3(io_context);
+  asio::cancellation_signal cancel;
+
+  {
+    pool_type pool(io_context, 1, std::chrono::seconds(30));
+    pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec1, &s1));
+    io_context.run_for(std::chrono::milliseconds(100));
+    ASIO_CHECK(!ec1);
+
+    pool.async_acquire(ep,
+        asio::bind_cancellation_slot(cancel.slot(),
+          bindns::bind(acquire_handler, _1, _2, &ec2, &s2)));
+    pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec3, &s3));
+    io_context.restart();
+    io_context.run_for(std::chrono::milliseconds(50));
+    ASIO_CHECK(ec2 == asio::error::would_block);
+
+    cancel.emit(asio::cancellation_type::terminal);
+    io_context.restart();
+    io_context.run_for(std::chrono::milliseconds(50));
+    ASIO_CHECK(ec2 == asio::error::operation_aborted);
+    ASIO_CHECK(!s2.is_open());
+  }
+
+  // Destroying the pool aborts the remaining waiter.
+  io_context.restart();
+  io_context.run_for(std::chrono::milliseconds(50));
+  ASIO_CHECK(ec3 == asio::error::operation_aborted);
+  ASIO_CHECK(!s3.is_open());
+  ASIO_CHECK(s1.is_open());
+}
+
+void test_destroy_while_connecting()
+{
+  asio::io_context io_context;
+
+  // Fill the accept queue of a listener that never accepts. Further connects
+  // to it remain pending, as they would for an unroutable address.
+  asio::ip::tcp::acceptor acceptor(io_context);
+  acceptor.open(asio::ip::tcp::v4());
+  acceptor.bind(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  acceptor.listen(0);
+  asio::ip::tcp::endpoint ep = acceptor.local_endpoint();
+
+  asio::ip::tcp::socket filler(io_context);
+  asio::error_code filler_ec;
+  filler.connect(ep, filler_ec);
+
+  asio::error_code ec = asio::error::would_block;
+  pool_type::socket_type s(io_context);
+
+  {
+    pool_type pool(io_context, 1, std::chrono::seconds(30));
+    pool.async_acquire(ep, bindns::bind(acquire_handler, _1, _2, &ec, &s));
+    io_context.run_for(std::chrono::milliseconds(50));
+  }
+
+  // If the connect completed anyway, there is nothing more to check.
+  if (ec != asio::error::would_block)
+    return;
+
+  // Destroying the pool closes the socket so that the connect is aborted.
+  io_context.restart();
+  io_context.run_for(std::chrono::seconds(5));
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+  ASIO_CHECK(!s.is_open());
+}
+
+ASIO_TEST_SUITE
+(
+  "basic_connection_pool",
+  ASIO_TEST_CASE(test_acquire_and_reuse)
+  ASIO_TEST_CASE(test_liveness_check)
+  ASIO_TEST_CASE(test_idle_eviction)
+  ASIO_TEST_CASE(test_connect_error)
+  ASIO_TEST_CASE(test_cancel_and_destroy)
+  ASIO_TEST_CASE(test_destroy_while_connecting)
+)
@@ -19,10 +19,12 @@
 #include <cstring>
 #include <functional>
 #include "archetypes/async_result.hpp"
+#include "asio/aligned_buffer_pool.hpp"
 #include "asio/buffer.hpp"
 #include "asio/io_context.hpp"
 #include "asio/ip/tcp.hpp"
 #include "asio/system_error.hpp"
+#include "asio/write.hpp"
 #include "unit_test.hpp"
 
 #if defined(ASIO_HAS_BOOST_ARRAY)
@@ -72,6 +74,7 @@ void test_compile()
 
     stream_type stream1(ioc);
     stream_type stream2(ioc, 1024);
+    stream_type stream3(ioc, adaptive_buffer_size());
 
     stream_type::executor_type ex = stream1.get_executor();
     (void)ex;
@@ -206,6 +209,78 @@ void test_sync_operations()
   client_socket.close(error);
 }
 
+void test_adaptive_operations()
+{
+  using namespace std; // For memcmp.
+
+  asio::io_context io_context;
+
+  asio::ip::tcp::acceptor acceptor(io_context,
+      asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0));
+  asio::ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(asio::ip::address_v4::loopback());
+
+  asio::ip::tcp::socket client_socket(io_context);
+  client_socket.connect(server_endpoint);
+
+  stream_type server_socket(io_context, asio::adaptive_buffer_size(64, 1024));
+  acceptor.accept(server_socket.lowest_layer());
+
+  char write_data[8192];
+  for (std::size_t i = 0; i < sizeof(write_data); ++i)
+    write_data[i] = static_cast<char>(i % 251);
+  asio::write(client_socket, asio::buffer(write_data));
+
+  // The storage grows while each fill uses all of the available space.
+  char read_data[sizeof(write_data)];
+  std::size_t bytes_read = 0;
+  std::size_t first_fill = 0;
+  std::size_t largest_fill = 0;
+  while (bytes_read < sizeof(read_data))
+  {
+    std::size_t n = server_socket.fill();
+    if (first_fill == 0)
+      first_fill = n;
+    if (n > largest_fill)
+      largest_fill = n;
+    while (server_socket.in_avail() > 0)
+    {
+      bytes_read += server_socket.read_some(
+          asio::buffer(read_data + bytes_read,
+            sizeof(read_data) - bytes_read));
+    }
+  }
+
+  ASIO_CHECK(bytes_read == sizeof(read_data));
+  ASIO_CHECK(memcmp(write_data, read_data, sizeof(write_data)) == 0);
+  ASIO_CHECK(first_fill <= 64);
+  ASIO_CHECK(largest_fill > 64);
+  ASIO_CHECK(largest_fill <= 1024);
+
+  // Storage may be taken from a registered buffer pool. It is returned to the
+  // pool when the stream holds no data.
+  asio::aligned_buffer_pool pool(io_context, 2, 256, 64);
+  asio::ip::tcp::socket client_socket2(io_context);
+  client_socket2.connect(server_endpoint);
+  stream_type server_socket2(io_context, asio::adaptive_buffer_size(pool));
+  acceptor.accept(server_socket2.lowest_layer());
+  ASIO_CHECK(pool.available() == 2);
+
+  asio::write(client_socket2, asio::buffer(write_data, 100));
+  bytes_read = 0;
+  while (bytes_read < 100)
+  {
+    server_socket2.fill();
+    ASIO_CHECK(server_socket2.in_avail() == 0 || pool.available() == 1);
+    bytes_read += server_socket2.read_some(
+        asio::buffer(read_data + bytes_read, 100 - bytes_read));
+  }
+
+  ASIO_CHECK(memcmp(write_data, read_data, 100) == 0);
+  ASIO_CHECK(server_socket2.in_avail() == 0);
+  ASIO_CHECK(pool.available() == 2);
+}
+
 void handle_accept(const asio::error_code& e)
 {
   ASIO_CHECK(!e);
@@ -326,4 +401,5 @@ ASIO_TEST_SUITE
   ASIO_COMPILE_TEST_CASE(test_compile)
   ASIO_TEST_CASE(test_sync_operations)
   ASIO_TEST_CASE(test_async_operations)
+  ASIO_TEST_CASE(test_adaptive_operations)
 )
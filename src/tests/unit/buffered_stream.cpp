@@ -76,6 +76,7 @@ void test_compile()
 
     stream_type stream1(ioc);
     stream_type stream2(ioc, 1024, 1024);
+    stream_type stream3(ioc, adaptive_buffer_size(512, 65536));
 
     stream_type::executor_type ex = stream1.get_executor();
     (void)ex;
@@ -19,9 +19,11 @@
 #include <cstring>
 #include <functional>
 #include "archetypes/async_result.hpp"
+#include "asio/aligned_buffer_pool.hpp"
 #include "asio/buffer.hpp"
 #include "asio/io_context.hpp"
 #include "asio/ip/tcp.hpp"
+#include "asio/read.hpp"
 #include "asio/system_error.hpp"
 #include "unit_test.hpp"
 
@@ -72,6 +74,7 @@ void test_compile()
 
     stream_type stream1(ioc);
     stream_type stream2(ioc, 1024);
+    stream_type stream3(ioc, adaptive_buffer_size());
 
     stream_type::executor_type ex = stream1.get_executor();
     (void)ex;
@@ -208,6 +211,64 @@ void test_sync_operations()
   client_socket.close(error);
 }
 
+void test_adaptive_operations()
+{
+  using namespace std; // For memcmp.
+
+  asio::io_context io_context;
+
+  asio::ip::tcp::acceptor acceptor(io_context,
+      asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0));
+  asio::ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(asio::ip::address_v4::loopback());
+
+  stream_type client_socket(io_context, asio::adaptive_buffer_size(64, 1024));
+  client_socket.lowest_layer().connect(server_endpoint);
+
+  asio::ip::tcp::socket server_socket(io_context);
+  acceptor.accept(server_socket);
+
+  char write_data[4096];
+  for (std::size_t i = 0; i < sizeof(write_data); ++i)
+    write_data[i] = static_cast<char>(i % 251);
+
+  // The storage grows while each flush sends a full buffer.
+  std::size_t bytes_written = 0;
+  std::size_t largest_write = 0;
+  while (bytes_written < sizeof(write_data))
+  {
+    std::size_t n = client_socket.write_some(
+        asio::buffer(write_data + bytes_written,
+          sizeof(write_data) - bytes_written));
+    if (n > largest_write)
+      largest_write = n;
+    bytes_written += n;
+  }
+  client_socket.flush();
+
+  char read_data[sizeof(write_data)];
+  asio::read(server_socket, asio::buffer(read_data));
+  ASIO_CHECK(memcmp(write_data, read_data, sizeof(write_data)) == 0);
+  ASIO_CHECK(largest_write > 64);
+  ASIO_CHECK(largest_write <= 1024);
+
+  // Storage may be taken from a registered buffer pool. It is returned to the
+  // pool once the buffered data has been flushed.
+  asio::aligned_buffer_pool pool(io_context, 1, 256, 64);
+  stream_type client_socket2(io_context, asio::adaptive_buffer_size(pool));
+  client_socket2.lowest_layer().connect(server_endpoint);
+  asio::ip::tcp::socket server_socket2(io_context);
+  acceptor.accept(server_socket2);
+
+  ASIO_CHECK(client_socket2.write_some(asio::buffer(write_data, 10)) == 10);
+  ASIO_CHECK(pool.available() == 0);
+  client_socket2.flush();
+  ASIO_CHECK(pool.available() == 1);
+
+  asio::read(server_socket2, asio::buffer(read_data, 10));
+  ASIO_CHECK(memcmp(write_data, read_data, 10) == 0);
+}
+
 void handle_accept(const asio::error_code& e)
 {
   ASIO_CHECK(!e);
@@ -341,4 +402,5 @@ ASIO_TEST_SUITE
   ASIO_COMPILE_TEST_CASE(test_compile)
   ASIO_TEST_CASE(test_sync_operations)
   ASIO_TEST_CASE(test_async_operations)
+  ASIO_TEST_CASE(test_adaptive_operations)
 )
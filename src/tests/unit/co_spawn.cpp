@@ -20,11 +20,16 @@
 
 #if defined(ASIO_HAS_CO_AWAIT)
 
+#include <cstddef>
 #include <stdexcept>
 #include "asio/any_completion_handler.hpp"
 #include "asio/bind_cancellation_slot.hpp"
+#include "asio/deferred.hpp"
+#include "asio/detached.hpp"
 #include "asio/dispatch.hpp"
+#include "asio/immediate.hpp"
 #include "asio/io_context.hpp"
+#include "asio/this_coro.hpp"
 #include "asio/use_awaitable.hpp"
 
 asio::awaitable<void> void_returning_coroutine()
@@ -169,12 +174,117 @@ void test_co_spawn_with_immediate_completion_via_dispatch()
   ASIO_CHECK(result == 42);
 }
 
+asio::awaitable<std::size_t> immediate_completions_coroutine(
+    std::size_t limit, int iterations)
+{
+  co_await asio::this_coro::immediate_resumption_limit(limit);
+  std::size_t result = co_await asio::this_coro::immediate_resumption_limit();
+
+  asio::any_io_executor ex = co_await asio::this_coro::executor;
+  for (int i = 0; i < iterations; ++i)
+  {
+    co_await asio::async_immediate(ex, asio::use_awaitable);
+    co_await asio::async_immediate(ex, asio::deferred);
+    co_await asio::dispatch(asio::use_awaitable);
+  }
+
+  co_return result;
+}
+
+void test_co_spawn_with_immediate_resumption()
+{
+  asio::io_context ctx;
+
+  std::size_t limit = 1;
+  asio::co_spawn(ctx, immediate_completions_coroutine(0, 100),
+      [&](std::exception_ptr, std::size_t l)
+      {
+        limit = l;
+      });
+
+  std::size_t handlers_run = ctx.run();
+
+  ASIO_CHECK(limit == 0);
+  ASIO_CHECK(handlers_run >= 200);
+
+  asio::co_spawn(ctx, immediate_completions_coroutine(10, 100),
+      [&](std::exception_ptr, std::size_t l)
+      {
+        limit = l;
+      });
+
+  ctx.restart();
+  handlers_run = ctx.run();
+
+  ASIO_CHECK(limit == 10);
+  ASIO_CHECK(handlers_run < 50);
+
+  // Immediate resumption does not consume stack space.
+  asio::co_spawn(ctx,
+      immediate_completions_coroutine(static_cast<std::size_t>(-1), 100000),
+      [&](std::exception_ptr, std::size_t l)
+      {
+        limit = l;
+      });
+
+  ctx.restart();
+  handlers_run = ctx.run();
+
+  ASIO_CHECK(limit == static_cast<std::size_t>(-1));
+  ASIO_CHECK(handlers_run < 10);
+}
+
+asio::awaitable<void> immediate_io_executor_coroutine(
+    std::size_t limit, asio::any_io_executor io_ex, bool* resumed)
+{
+  co_await asio::this_coro::immediate_resumption_limit(limit);
+  co_await asio::async_immediate(io_ex, asio::use_awaitable);
+  *resumed = true;
+}
+
+void test_co_spawn_immediate_io_executor()
+{
+  asio::io_context ctx1;
+  asio::io_context ctx2;
+
+  // Without immediate resumption, an immediate completion is submitted to
+  // the I/O executor, as for any other completion handler, and from there to
+  // the coroutine's executor.
+  bool resumed = false;
+  asio::co_spawn(ctx1,
+      immediate_io_executor_coroutine(0, ctx2.get_executor(), &resumed),
+      asio::detached);
+
+  ctx1.poll();
+  ASIO_CHECK(!resumed);
+
+  std::size_t handlers_run = ctx2.poll();
+  ASIO_CHECK(handlers_run == 1);
+  ASIO_CHECK(!resumed);
+
+  ctx1.restart();
+  ctx1.poll();
+  ASIO_CHECK(resumed);
+
+  // With immediate resumption, the completion resumes the coroutine inline.
+  resumed = false;
+  asio::co_spawn(ctx1,
+      immediate_io_executor_coroutine(10, ctx2.get_executor(), &resumed),
+      asio::detached);
+
+  ctx1.restart();
+  ctx1.poll();
+  ASIO_CHECK(resumed);
+}
+
 ASIO_TEST_SUITE
 (
   "co_spawn",
   ASIO_TEST_CASE(test_co_spawn_with_any_completion_handler)
   ASIO_TEST_CASE(test_co_spawn_immediate_cancel)
   ASIO_TEST_CASE(test_co_spawn_with_immediate_completion_via_dispatch)
+  ASIO_TEST_CASE(test_co_spawn_with_immediate_resumption)
+  ASIO_TEST_CASE(test_co_spawn_immediate_io_executor)
 )
 
 #else // defined(ASIO_HAS_CO_AWAIT)
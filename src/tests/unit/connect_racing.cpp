@@ -0,0 +1,260 @@
+//
+// connect_racing.cpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/connect_racing.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include "asio/bind_cancellation_slot.hpp"
+#include "asio/cancellation_signal.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/local/stream_protocol.hpp"
+#include "unit_test.hpp"
+
+namespace bindns = std;
+using bindns::placeholders::_1;
+using bindns::placeholders::_2;
+
+// A listener that accepts connections into its backlog but never accepts
+// them. Once the backlog is full, further connection attempts stall.
+class stalled_listener
+{
+public:
+  explicit stalled_listener(asio::io_context& io_context)
+    : acceptor_(io_context),
+      filler_(io_context)
+  {
+    acceptor_.open(asio::ip::tcp::v4());
+    acceptor_.bind(asio::ip::tcp::endpoint(
+          asio::ip::address_v4::loopback(), 0));
+    acceptor_.listen(0);
+    filler_.connect(acceptor_.local_endpoint());
+  }
+
+  asio::ip::tcp::endpoint target_endpoint()
+  {
+    return acceptor_.local_endpoint();
+  }
+
+private:
+  asio::ip::tcp::acceptor acceptor_;
+  asio::ip::tcp::socket filler_;
+};
+
+// An endpoint on which nothing is listening, so that connection attempts fail
+// immediately.
+asio::ip::tcp::endpoint refusing_endpoint(asio::io_context& io_context)
+{
+  asio::ip::tcp::acceptor acceptor(io_context,
+      asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  return acceptor.local_endpoint();
+}
+
+void range_handler(const asio::error_code& ec,
+    const asio::ip::tcp::endpoint& endpoint,
+    asio::error_code* out_ec,
+    asio::ip::tcp::endpoint* out_endpoint)
+{
+  *out_ec = ec;
+  *out_endpoint = endpoint;
+}
+
+void test_async_connect_racing_empty()
+{
+  asio::io_context io_context;
+  asio::ip::tcp::socket socket(io_context);
+  std::vector<asio::ip::tcp::endpoint> endpoints;
+  asio::ip::tcp::endpoint result;
+  asio::error_code ec;
+
+  asio::async_connect_racing(socket, endpoints,
+      std::chrono::milliseconds(50),
+      bindns::bind(range_handler, _1, _2, &ec, &result));
+  io_context.run();
+  ASIO_CHECK(result == asio::ip::tcp::endpoint());
+  ASIO_CHECK(ec == asio::error::not_found);
+  ASIO_CHECK(!socket.is_open());
+}
+
+void test_async_connect_racing_single()
+{
+  asio::io_context io_context;
+  asio::ip::tcp::acceptor acceptor(io_context,
+      asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  asio::ip::tcp::socket socket(io_context);
+  std::vector<asio::ip::tcp::endpoint> endpoints;
+  asio::ip::tcp::endpoint result;
+  asio::error_code ec;
+
+  endpoints.push_back(acceptor.local_endpoint());
+
+  asio::async_connect_racing(socket, endpoints,
+      std::chrono::milliseconds(50),
+      bindns::bind(range_handler, _1, _2, &ec, &result));
+  io_context.run();
+  ASIO_CHECK(result == endpoints[0]);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(socket.is_open());
+  ASIO_CHECK(socket.remote_endpoint() == endpoints[0]);
+}
+
+void test_async_connect_racing_stalled()
+{
+  asio::io_context io_context;
+  stalled_listener stalled(io_context);
+  asio::ip::tcp::acceptor acceptor(io_context,
+      asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  asio::ip::tcp::socket socket(io_context);
+  std::vector<asio::ip::tcp::endpoint> endpoints;
+  asio::ip::tcp::endpoint result;
+  asio::error_code ec;
+
+  endpoints.push_back(stalled.target_endpoint());
+  endpoints.push_back(acceptor.local_endpoint());
+
+  // The first attempt stalls, so the second is started after the delay and
+  // wins. The stalled attempt is then cancelled.
+  std::chrono::steady_clock::time_point start
+    = std::chrono::steady_clock::now();
+  asio::async_connect_racing(socket, endpoints,
+      std::chrono::milliseconds(50),
+      bindns::bind(range_handler, _1, _2, &ec, &result));
+  io_context.run();
+  std::chrono::steady_clock::duration elapsed
+    = std::chrono::steady_clock::now() - start;
+  ASIO_CHECK(result == endpoints[1]);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(socket.is_open());
+  ASIO_CHECK(socket.remote_endpoint() == endpoints[1]);
+  ASIO_CHECK(elapsed < std::chrono::seconds(5));
+}
+
+void test_async_connect_racing_refused()
+{
+  asio::io_context io_context;
+  asio::ip::tcp::acceptor acceptor(io_context,
+      asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  asio::ip::tcp::socket socket(io_context);
+  std::vector<asio::ip::tcp::endpoint> endpoints;
+  asio::ip::tcp::endpoint result;
+  asio::error_code ec;
+
+  // A failed attempt starts the next attempt without waiting for the delay.
+  endpoints.push_back(refusing_endpoint(io_context));
+  endpoints.push_back(acceptor.local_endpoint());
+
+  std::chrono::steady_clock::time_point start
+    = std::chrono::steady_clock::now();
+  asio::async_connect_racing(socket, endpoints,
+      std::chrono::seconds(30),
+      bindns::bind(range_handler, _1, _2, &ec, &result));
+  io_context.run();
+  std::chrono::steady_clock::duration elapsed
+    = std::chrono::steady_clock::now() - start;
+  ASIO_CHECK(result == endpoints[1]);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(elapsed < std::chrono::seconds(5));
+
+  // When every attempt fails, the error from the last attempt is reported.
+  endpoints.pop_back();
+  endpoints.push_back(refusing_endpoint(io_context));
+
+  asio::async_connect_racing(socket, endpoints,
+      std::chrono::milliseconds(50),
+      bindns::bind(range_handler, _1, _2, &ec, &result));
+  io_context.restart();
+  io_context.run();
+  ASIO_CHECK(result == asio::ip::tcp::endpoint());
+  ASIO_CHECK(!!ec);
+  ASIO_CHECK(!socket.is_open());
+}
+
+void test_async_connect_racing_cancel()
+{
+  asio::io_context io_context;
+  stalled_listener stalled(io_context);
+  asio::ip::tcp::socket socket(io_context);
+  std::vector<asio::ip::tcp::endpoint> endpoints;
+  asio::ip::tcp::endpoint result;
+  asio::error_code ec;
+  asio::cancellation_signal cancel;
+
+  endpoints.push_back(stalled.target_endpoint());
+  endpoints.push_back(stalled.target_endpoint());
+
+  asio::async_connect_racing(socket, endpoints,
+      std::chrono::milliseconds(10),
+      asio::bind_cancellation_slot(cancel.slot(),
+        bindns::bind(range_handler, _1, _2, &ec, &result)));
+  io_context.run_for(std::chrono::milliseconds(100));
+  cancel.emit(asio::cancellation_type::terminal);
+  io_context.run();
+  ASIO_CHECK(result == asio::ip::tcp::endpoint());
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+  ASIO_CHECK(!socket.is_open());
+}
+
+void local_range_handler(const asio::error_code& ec,
+    const asio::local::stream_protocol::endpoint& endpoint,
+    asio::error_code* out_ec,
+    asio::local::stream_protocol::endpoint* out_endpoint)
+{
+  *out_ec = ec;
+  *out_endpoint = endpoint;
+}
+
+void test_async_connect_racing_local()
+{
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+  const char* path = "connect_racing_local.sock";
+  std::remove(path);
+
+  asio::io_context io_context;
+  asio::local::stream_protocol::acceptor acceptor(io_context,
+      asio::local::stream_protocol::endpoint(path));
+  asio::local::stream_protocol::socket socket(io_context);
+  std::vector<asio::local::stream_protocol::endpoint> endpoints;
+  asio::local::stream_protocol::endpoint result;
+  asio::error_code ec;
+
+  endpoints.push_back(acceptor.local_endpoint());
+
+  asio::async_connect_racing(socket, endpoints,
+      std::chrono::milliseconds(50),
+      bindns::bind(local_range_handler, _1, _2, &ec, &result));
+  io_context.run();
+  ASIO_CHECK(result == endpoints[0]);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(socket.is_open());
+
+  acceptor.close();
+  std::remove(path);
+#endif // defined(ASIO_HAS_LOCAL_SOCKETS)
+}
+
+ASIO_TEST_SUITE
+(
+  "connect_racing",
+  ASIO_TEST_CASE(test_async_connect_racing_empty)
+  ASIO_TEST_CASE(test_async_connect_racing_single)
+  ASIO_TEST_CASE(test_async_connect_racing_stalled)
+  ASIO_TEST_CASE(test_async_connect_racing_refused)
+  ASIO_TEST_CASE(test_async_connect_racing_cancel)
+  ASIO_TEST_CASE(test_async_connect_racing_local)
+)
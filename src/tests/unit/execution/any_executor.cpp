@@ -18,6 +18,7 @@
 
 #include <cstring>
 #include <functional>
+#include <type_traits>
 #include "asio/thread_pool.hpp"
 #include "../unit_test.hpp"
 
@@ -1190,6 +1191,75 @@ void any_executor_execute_test()
   ASIO_CHECK(count == 6);
 }
 
+void unique_any_executor_test()
+{
+  int count = 0;
+  thread_pool pool(1);
+
+  execution::unique_any_executor<
+      execution::blocking_t::never_t,
+      execution::occupancy_t>
+    ex1;
+
+  ASIO_CHECK(!ex1);
+  ASIO_CHECK(ex1 == nullptr);
+  ASIO_CHECK(ex1.target<void>() == 0);
+
+  ex1 = pool.executor();
+
+  ASIO_CHECK(ex1 != nullptr);
+  ASIO_CHECK(ex1.target<thread_pool::executor_type>() != 0);
+  ASIO_CHECK(ex1.query(execution::occupancy) == 1);
+
+  ex1.execute(bindns::bind(increment, &count));
+
+  execution::any_executor<
+      execution::blocking_t::never_t,
+      execution::occupancy_t>
+    ex2 = ex1.require(execution::blocking.never);
+
+  ASIO_CHECK(ex2.target<thread_pool::executor_type>() != 0);
+  ex2.execute(bindns::bind(increment, &count));
+
+  ex1 = nullptr;
+  ASIO_CHECK(!ex1);
+
+  pool.wait();
+
+  ASIO_CHECK(count == 2);
+
+  execution::unique_any_executor<execution::occupancy_t> ex3(fat_executor(1));
+
+  ASIO_CHECK(!!ex3);
+  ASIO_CHECK(ex3.target<fat_executor>() != 0);
+  ASIO_CHECK(ex3.target<fat_executor>()->id_ == 1);
+  ASIO_CHECK(ex3.query(execution::occupancy) == 1);
+
+  const void* target = ex3.target<void>();
+  execution::unique_any_executor<execution::occupancy_t> ex4(std::move(ex3));
+
+  ASIO_CHECK(!ex3);
+  ASIO_CHECK(ex4.target<void>() == target);
+
+  ex3 = std::move(ex4);
+
+  ASIO_CHECK(!ex4);
+  ASIO_CHECK(ex3.target<void>() == target);
+
+  ex4 = fat_executor(2);
+  execution::swap(ex3, ex4);
+
+  ASIO_CHECK(ex3.target<fat_executor>()->id_ == 2);
+  ASIO_CHECK(ex4.target<fat_executor>()->id_ == 1);
+
+  // A target owned outright can never be copied.
+  ASIO_CHECK((!std::is_copy_constructible<
+        execution::unique_any_executor<execution::occupancy_t>>::value));
+  ASIO_CHECK((!std::is_constructible<
+        execution::any_executor<execution::occupancy_t>,
+        execution::detail::unique_target_tag, fat_executor>::value));
+}
+
 ASIO_TEST_SUITE
 (
   "any_executor",
@@ -1199,4 +1269,5 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(any_executor_swap_test)
   ASIO_TEST_CASE(any_executor_query_test)
   ASIO_TEST_CASE(any_executor_execute_test)
+  ASIO_TEST_CASE(unique_any_executor_test)
 )
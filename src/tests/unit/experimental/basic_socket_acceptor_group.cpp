@@ -0,0 +1,124 @@
+//
+// experimental/basic_socket_acceptor_group.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/experimental/basic_socket_acceptor_group.hpp"
+
+#include <vector>
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "../unit_test.hpp"
+
+typedef asio::experimental::basic_socket_acceptor_group<
+    asio::ip::tcp, asio::io_context::executor_type> tcp_acceptor_group;
+
+struct accept_handler
+{
+  int* count_;
+
+  void operator()(const asio::error_code& ec, asio::ip::tcp::socket)
+  {
+    if (!ec)
+      ++*count_;
+  }
+};
+
+void basic_socket_acceptor_group_test()
+{
+  asio::io_context ioc1;
+  asio::io_context ioc2;
+
+  std::vector<asio::io_context::executor_type> executors;
+  executors.push_back(ioc1.get_executor());
+  executors.push_back(ioc2.get_executor());
+
+  tcp_acceptor_group group;
+  ASIO_CHECK(!group.is_open());
+  ASIO_CHECK(group.size() == 0);
+
+  asio::error_code ec;
+  group.open(executors.begin(), executors.end(),
+      asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0),
+      asio::socket_base::max_listen_connections, ec);
+
+#if defined(SO_REUSEPORT)
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(group.is_open());
+  ASIO_CHECK(group.size() == 2);
+
+  asio::ip::tcp::endpoint endpoint = group.local_endpoint();
+  ASIO_CHECK(endpoint.port() != 0);
+  ASIO_CHECK(group[0].local_endpoint() == endpoint);
+  ASIO_CHECK(group[1].local_endpoint() == endpoint);
+  ASIO_CHECK(&group[0].get_executor().context() == &ioc1);
+  ASIO_CHECK(&group[1].get_executor().context() == &ioc2);
+
+  group.open(executors.begin(), executors.end(), endpoint,
+      asio::socket_base::max_listen_connections, ec);
+  ASIO_CHECK(ec == asio::error::already_open);
+
+  group.attach_cpu_steering(ec);
+#if defined(__linux__)
+  ASIO_CHECK(!ec || ec == asio::error::operation_not_supported
+      || ec == asio::error::invalid_argument);
+#endif // defined(__linux__)
+
+  const int num_clients = 4;
+  std::vector<asio::ip::tcp::socket> clients;
+  for (int i = 0; i < num_clients; ++i)
+  {
+    clients.push_back(asio::ip::tcp::socket(ioc1));
+    clients.back().connect(endpoint);
+  }
+
+  int accepted = 0;
+  for (tcp_acceptor_group::iterator i = group.begin(); i != group.end(); ++i)
+    for (int j = 0; j < num_clients; ++j)
+      i->async_accept(accept_handler{&accepted});
+
+  for (int i = 0; i < 1000 && accepted < num_clients; ++i)
+  {
+    ioc1.run_for(asio::chrono::milliseconds(1));
+    ioc1.restart();
+    ioc2.run_for(asio::chrono::milliseconds(1));
+    ioc2.restart();
+  }
+
+  ASIO_CHECK(accepted == num_clients);
+
+  group.cancel();
+  group.close();
+  ASIO_CHECK(!group.is_open());
+  ASIO_CHECK(group.size() == 0);
+#else // defined(SO_REUSEPORT)
+  ASIO_CHECK(ec == asio::error::operation_not_supported);
+  ASIO_CHECK(!group.is_open());
+#endif // defined(SO_REUSEPORT)
+
+  tcp_acceptor_group group2(static_cast<tcp_acceptor_group&&>(group));
+  ASIO_CHECK(!group2.is_open());
+
+  group2.attach_cpu_steering(ec);
+  ASIO_CHECK(ec == asio::error::bad_descriptor);
+
+  group2.local_endpoint(ec);
+  ASIO_CHECK(ec == asio::error::bad_descriptor);
+}
+
+ASIO_TEST_SUITE
+(
+  "experimental/basic_socket_acceptor_group",
+  ASIO_TEST_CASE(basic_socket_acceptor_group_test)
+)
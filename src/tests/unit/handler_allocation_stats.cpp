@@ -0,0 +1,123 @@
+//
+// handler_allocation_stats.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Enable the counters for this test.
+#if !defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+#define ASIO_ENABLE_HANDLER_ALLOCATION_STATS 1
+#endif // !defined(ASIO_ENABLE_HANDLER_ALLOCATION_STATS)
+
+// Test that header file is self-contained.
+#include "asio/handler_allocation_stats.hpp"
+
+#include "asio/io_context.hpp"
+#include "asio/post.hpp"
+#include "asio/recycling_allocator.hpp"
+#include "unit_test.hpp"
+
+typedef asio::handler_allocation_stats stats_type;
+
+struct large_handler
+{
+  void operator()()
+  {
+    ++*count_;
+  }
+
+  int* count_;
+  char padding_[2000];
+};
+
+void handler_allocation_stats_test()
+{
+  stats_type before = stats_type::current();
+  const stats_type::counters& b = before.get(stats_type::operation);
+
+  asio::io_context ioc;
+  int count = 0;
+  large_handler h = { &count, {} };
+  for (int i = 0; i < 10; ++i)
+    asio::post(ioc, h);
+
+  stats_type during = stats_type::current();
+  const stats_type::counters& d = during.get(stats_type::operation);
+
+  ASIO_CHECK(d.hits + d.misses >= b.hits + b.misses + 10);
+  ASIO_CHECK(d.bytes >= b.bytes + 10 * sizeof(large_handler));
+  ASIO_CHECK(d.outstanding_bytes >= 10 * sizeof(large_handler));
+  ASIO_CHECK(d.high_water_bytes >= d.outstanding_bytes);
+  ASIO_CHECK(d.largest_request >= sizeof(large_handler));
+
+  ioc.run();
+  ASIO_CHECK(count == 10);
+
+  stats_type after = stats_type::current();
+  const stats_type::counters& a = after.get(stats_type::operation);
+
+  ASIO_CHECK(a.outstanding_bytes == b.outstanding_bytes);
+  ASIO_CHECK(a.high_water_bytes >= d.high_water_bytes);
+}
+
+void handler_allocation_stats_purpose_test()
+{
+  stats_type before = stats_type::current();
+
+  asio::detail::recycling_allocator<char,
+    asio::detail::thread_info_base::executor_function_tag> alloc;
+  char* p = alloc.allocate(100000);
+
+  stats_type during = stats_type::current();
+  const stats_type::counters& b =
+    before.get(stats_type::executor_function);
+  const stats_type::counters& d =
+    during.get(stats_type::executor_function);
+
+  ASIO_CHECK(d.misses == b.misses + 1);
+  ASIO_CHECK(d.bytes == b.bytes + 100000);
+  ASIO_CHECK(d.outstanding_bytes == b.outstanding_bytes + 100000);
+  ASIO_CHECK(d.largest_request >= 100000);
+
+  ASIO_CHECK(during.get(stats_type::awaitable_frame).bytes
+      == before.get(stats_type::awaitable_frame).bytes);
+
+  alloc.deallocate(p, 100000);
+
+  stats_type after = stats_type::current();
+  ASIO_CHECK(after.get(stats_type::executor_function).outstanding_bytes
+      == b.outstanding_bytes);
+
+  // Allocate from a thread that is running an io_context, so that the memory
+  // may be reused with either recycling implementation.
+  asio::io_context ioc;
+  asio::post(ioc,
+      [alloc]() mutable
+      {
+        char* q = alloc.allocate(16);
+        alloc.deallocate(q, 16);
+        q = alloc.allocate(16);
+        alloc.deallocate(q, 16);
+      });
+  ioc.run();
+
+  stats_type last = stats_type::current();
+  ASIO_CHECK(last.get(stats_type::executor_function).hits
+      >= after.get(stats_type::executor_function).hits + 1);
+}
+
+ASIO_TEST_SUITE
+(
+  "handler_allocation_stats",
+  ASIO_TEST_CASE(handler_allocation_stats_test)
+  ASIO_TEST_CASE(handler_allocation_stats_purpose_test)
+)
@@ -701,6 +701,54 @@ void io_context_allocator_test()
   ASIO_CHECK(total_count > 0);
 }
 
+void post_increment(io_context* ioc, int* count)
+{
+  asio::post(*ioc, bindns::bind(increment, count));
+}
+
+void io_context_busy_poll_test(const char* config)
+{
+  io_context ioc(asio::config_from_string{config});
+  int count = 0;
+
+  // Timers are delivered both while spinning and after falling back to
+  // blocking on the reactor.
+  timer t1(ioc, chronons::microseconds(100));
+  t1.async_wait(bindns::bind(increment, &count));
+  timer t2(ioc, chronons::milliseconds(20));
+  t2.async_wait(bindns::bind(increment, &count));
+  ioc.run();
+  ASIO_CHECK(count == 2);
+
+  // Handlers posted from another thread interrupt the spin.
+  count = 0;
+  ioc.restart();
+  executor_work_guard<io_context::executor_type> work
+    = make_work_guard(ioc);
+  asio::thread th(bindns::bind(&io_context::run, &ioc));
+  io_context delay_ioc;
+  for (int i = 0; i < 10; ++i)
+  {
+    post_increment(&ioc, &count);
+    timer delay(delay_ioc, chronons::milliseconds(1));
+    delay.wait();
+  }
+  asio::post(ioc, [&work]{ work.reset(); });
+  th.join();
+  ASIO_CHECK(count == 10);
+}
+
+void io_context_busy_poll_test()
+{
+  io_context_busy_poll_test("scheduler.busy_poll_usec=1000");
+  io_context_busy_poll_test(
+      "scheduler.busy_poll_usec=1000\n"
+      "scheduler.busy_poll_adaptive=0");
+  io_context_busy_poll_test(
+      "scheduler.busy_poll_usec=1000\n"
+      "scheduler.concurrency_hint=1");
+}
+
 ASIO_TEST_SUITE
 (
   "io_context",
@@ -709,4 +757,5 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(io_context_executor_query_test)
   ASIO_TEST_CASE(io_context_executor_execute_test)
   ASIO_TEST_CASE(io_context_allocator_test)
+  ASIO_TEST_CASE(io_context_busy_poll_test)
 )
@@ -0,0 +1,127 @@
+//
+// io_context_pool.cpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/io_context_pool.hpp"
+
+#include <atomic>
+#include <functional>
+#include "asio/dispatch.hpp"
+#include "asio/execution.hpp"
+#include "asio/post.hpp"
+#include "asio/steady_timer.hpp"
+#include "unit_test.hpp"
+
+using namespace asio;
+namespace bindns = std;
+
+void increment(std::atomic<int>* count)
+{
+  ++(*count);
+}
+
+void record_thread(io_context* ctx, std::atomic<int>* count)
+{
+  if (ctx->get_executor().running_in_this_thread())
+    ++(*count);
+}
+
+void io_context_pool_test()
+{
+  io_context_pool pool(3);
+  ASIO_CHECK(pool.size() == 3);
+
+  ASIO_CHECK(&pool.get_executor().context() == &pool.get_io_context(0));
+  ASIO_CHECK(&pool.get_executor().context() == &pool.get_io_context(1));
+  ASIO_CHECK(&pool.get_executor().context() == &pool.get_io_context(2));
+  ASIO_CHECK(&pool.get_executor().context() == &pool.get_io_context(0));
+
+  std::atomic<int> count(0);
+  for (int i = 0; i < 30; ++i)
+    post(pool.get_executor(), bindns::bind(increment, &count));
+
+  std::atomic<int> affine_count(0);
+  for (std::size_t i = 0; i < pool.size(); ++i)
+  {
+    io_context& ctx = pool.get_io_context(i);
+    post(ctx, bindns::bind(record_thread, &ctx, &affine_count));
+  }
+
+  pool.join();
+
+  ASIO_CHECK(count == 30);
+  ASIO_CHECK(affine_count == 3);
+}
+
+void io_context_pool_least_loaded_test()
+{
+  io_context_pool pool(3);
+
+  typedef decay_t<
+      prefer_result_t<io_context::executor_type,
+        execution::outstanding_work_t::tracked_t>
+    > work_executor_type;
+
+  work_executor_type work0 = prefer(pool.get_io_context(0).get_executor(),
+      execution::outstanding_work.tracked);
+  work_executor_type work1 = prefer(pool.get_io_context(1).get_executor(),
+      execution::outstanding_work.tracked);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    ASIO_CHECK(&pool.get_least_loaded_executor().context()
+        == &pool.get_io_context(2));
+  }
+
+  steady_timer timer(pool.get_io_context(2));
+  timer.expires_after(chrono::seconds(10));
+  timer.async_wait([](const asio::error_code&){});
+  steady_timer timer2(pool.get_io_context(2));
+  timer2.expires_after(chrono::seconds(10));
+  timer2.async_wait([](const asio::error_code&){});
+
+  for (int i = 0; i < 10; ++i)
+  {
+    io_context* ctx = &pool.get_least_loaded_executor().context();
+    ASIO_CHECK(ctx == &pool.get_io_context(0)
+        || ctx == &pool.get_io_context(1));
+  }
+
+  pool.stop();
+  pool.join();
+}
+
+void io_context_pool_stop_test()
+{
+  io_context_pool pool(2);
+
+  steady_timer timer(pool.get_executor());
+  timer.expires_after(chrono::seconds(60));
+  timer.async_wait([](const asio::error_code&){});
+
+  pool.stop();
+  pool.join();
+
+  ASIO_CHECK(pool.get_io_context(0).stopped());
+  ASIO_CHECK(pool.get_io_context(1).stopped());
+}
+
+ASIO_TEST_SUITE
+(
+  "io_context_pool",
+  ASIO_TEST_CASE(io_context_pool_test)
+  ASIO_TEST_CASE(io_context_pool_least_loaded_test)
+  ASIO_TEST_CASE(io_context_pool_stop_test)
+)
@@ -19,10 +19,19 @@
 // Test that header file is self-contained.
 #include "asio/ip/tcp.hpp"
 
+#include <atomic>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <new>
+#include <vector>
+#include "asio/bind_allocator.hpp"
+#include "asio/bind_immediate_executor.hpp"
+#include "asio/config.hpp"
+#include "asio/executor_work_guard.hpp"
 #include "asio/io_context.hpp"
 #include "asio/read.hpp"
+#include "asio/thread.hpp"
 #include "asio/write.hpp"
 #include "../unit_test.hpp"
 #include "../archetypes/async_result.hpp"
@@ -30,6 +39,11 @@
 #include "../archetypes/io_control_command.hpp"
 #include "../archetypes/settable_socket_option.hpp"
 
+#if defined(ASIO_HAS_EPOLL) && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+# include <sys/epoll.h>
+# include <unistd.h>
+#endif // defined(ASIO_HAS_EPOLL) && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+
 #if defined(ASIO_HAS_BOOST_ARRAY)
 # include <boost/array.hpp>
 #else // defined(ASIO_HAS_BOOST_ARRAY)
@@ -696,6 +710,356 @@ void test()
 
 //------------------------------------------------------------------------------
 
+// ip_tcp_socket_op_slot_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that, when the "reactor" / "socket_op_slots"
+// option is enabled, send and receive operations do not allocate memory.
+
+namespace ip_tcp_socket_op_slot_runtime {
+
+// Counts calls to the global operator new while counting is enabled, so that
+// the test sees heap allocations made by any means, and not only those made
+// through the handler's associated allocator.
+std::atomic<bool> counting_heap_allocations(false);
+std::atomic<int> heap_allocations(0);
+
+void* counted_allocate(std::size_t size)
+{
+  if (counting_heap_allocations)
+    ++heap_allocations;
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void counted_deallocate(void* p) noexcept
+{
+  std::free(p);
+}
+
+} // namespace ip_tcp_socket_op_slot_runtime
+
+void* operator new(std::size_t size)
+{
+  return ip_tcp_socket_op_slot_runtime::counted_allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return ip_tcp_socket_op_slot_runtime::counted_allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+  ip_tcp_socket_op_slot_runtime::counted_deallocate(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  ip_tcp_socket_op_slot_runtime::counted_deallocate(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  ip_tcp_socket_op_slot_runtime::counted_deallocate(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+  ip_tcp_socket_op_slot_runtime::counted_deallocate(p);
+}
+
+namespace ip_tcp_socket_op_slot_runtime {
+
+template <typename T>
+class counting_allocator
+{
+public:
+  typedef T value_type;
+
+  explicit counting_allocator(int* count)
+    : count_(count)
+  {
+  }
+
+  template <typename U>
+  counting_allocator(const counting_allocator<U>& other)
+    : count_(other.count_)
+  {
+  }
+
+  bool operator==(const counting_allocator& other) const
+  {
+    return count_ == other.count_;
+  }
+
+  bool operator!=(const counting_allocator& other) const
+  {
+    return count_ != other.count_;
+  }
+
+  T* allocate(std::size_t n) const
+  {
+    ++(*count_);
+    return static_cast<T*>(::operator new(sizeof(T) * n));
+  }
+
+  void deallocate(T* p, std::size_t /*n*/) const
+  {
+    ::operator delete(p);
+  }
+
+private:
+  template <typename> friend class counting_allocator;
+
+  int* count_;
+};
+
+void handle_transfer(const asio::error_code& err,
+    size_t bytes_transferred, int* count)
+{
+  ASIO_CHECK(!err);
+  ASIO_CHECK(bytes_transferred == 1);
+  ++(*count);
+}
+
+// Runs a number of send and receive operations after a warm-up operation of
+// each kind. Returns the number of calls to the associated allocator, and
+// sets heap to the number of heap allocations, made after the warm-up.
+int transfer(const char* config, int iterations, int* heap)
+{
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  io_context ioc(config_from_string{config});
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket client_side_socket(ioc);
+  ip::tcp::socket server_side_socket(ioc);
+
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  int allocations = 0;
+  int completed = 0;
+  char data = 0;
+  for (int i = 0; i <= iterations; ++i)
+  {
+    if (i == 1)
+    {
+      allocations = 0;
+      heap_allocations = 0;
+      counting_heap_allocations = true;
+    }
+
+    server_side_socket.async_read_some(asio::buffer(&data, 1),
+        bind_allocator(counting_allocator<void>(&allocations),
+          bindns::bind(handle_transfer, _1, _2, &completed)));
+
+    client_side_socket.async_write_some(asio::buffer(&data, 1),
+        bind_allocator(counting_allocator<void>(&allocations),
+          bindns::bind(handle_transfer, _1, _2, &completed)));
+
+    ioc.restart();
+    ioc.run();
+  }
+
+  counting_heap_allocations = false;
+  *heap = heap_allocations;
+
+  ASIO_CHECK(completed == 2 * (iterations + 1));
+
+  // Leave an operation outstanding so that it outlives the socket.
+  server_side_socket.async_read_some(asio::buffer(&data, 1),
+      [](const asio::error_code&, std::size_t){});
+  ioc.restart();
+  ioc.poll();
+  server_side_socket.close();
+  ioc.restart();
+  ioc.run();
+
+  return allocations;
+}
+
+void test()
+{
+  const int iterations = 10;
+  int heap = 0;
+
+  ASIO_CHECK(transfer("", iterations, &heap) == 2 * iterations);
+  ASIO_CHECK(heap >= 2 * iterations);
+
+#if !defined(ASIO_HAS_IOCP) \
+  && !defined(ASIO_WINDOWS_RUNTIME) \
+  && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+  ASIO_CHECK(transfer("reactor.socket_op_slots=1", iterations, &heap) == 0);
+  ASIO_CHECK(heap == 0);
+#endif // !defined(ASIO_HAS_IOCP)
+       //   && !defined(ASIO_WINDOWS_RUNTIME)
+       //   && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+}
+
+} // namespace ip_tcp_socket_op_slot_runtime
+
+//------------------------------------------------------------------------------
+
+// ip_tcp_socket_speculative_io_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that the "reactor" / "speculative_io" option
+// determines whether a receive operation completes immediately when data is
+// already available.
+
+namespace ip_tcp_socket_speculative_io_runtime {
+
+struct connection
+{
+  explicit connection(const char* config)
+    : ioc(asio::config_from_string{config}),
+      client_side_socket(ioc),
+      server_side_socket(ioc)
+  {
+    namespace ip = asio::ip;
+
+    ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+    ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+    server_endpoint.address(ip::address_v4::loopback());
+
+    client_side_socket.connect(server_endpoint);
+    acceptor.accept(server_side_socket);
+  }
+
+  // Start a receive after the reactor has already been notified that data
+  // is available, and return whether it completed.
+  bool receive_after_notification()
+  {
+    char data = 0;
+    asio::write(client_side_socket, asio::buffer(&data, 1));
+
+    // Give the reactor a chance to see the data before the receive starts.
+    {
+      asio::executor_work_guard<asio::io_context::executor_type> work =
+        asio::make_work_guard(ioc);
+      for (int i = 0; i < 10; ++i)
+      {
+        ioc.restart();
+        ioc.poll();
+      }
+    }
+
+    bool completed = false;
+    server_side_socket.async_read_some(asio::buffer(&data, 1),
+        [&completed](const asio::error_code& err, std::size_t n)
+        {
+          ASIO_CHECK(!err);
+          ASIO_CHECK(n == 1);
+          completed = true;
+        });
+
+    ioc.restart();
+    ioc.run_for(asio::chrono::seconds(5));
+    if (!completed)
+    {
+      // Abandon the receive so that the connection may be destroyed.
+      server_side_socket.cancel();
+      ioc.restart();
+      ioc.run();
+    }
+
+    return completed;
+  }
+
+  // Start a receive, optionally after the data has already arrived, and
+  // return whether it completed immediately.
+  bool receive(bool data_available)
+  {
+    char data = 0;
+    if (data_available)
+      asio::write(client_side_socket, asio::buffer(&data, 1));
+
+    bool completed = false;
+    server_side_socket.async_read_some(asio::buffer(&data, 1),
+        asio::bind_immediate_executor(immediate_ioc.get_executor(),
+          [&completed](const asio::error_code& err, std::size_t n)
+          {
+            ASIO_CHECK(!err);
+            ASIO_CHECK(n == 1);
+            completed = true;
+          }));
+
+    if (!data_available)
+      asio::write(client_side_socket, asio::buffer(&data, 1));
+
+    ioc.restart();
+    ioc.run();
+    immediate_ioc.restart();
+    std::size_t immediate = immediate_ioc.run();
+    ASIO_CHECK(completed);
+
+    return immediate != 0;
+  }
+
+  asio::io_context ioc;
+  asio::io_context immediate_ioc;
+  asio::ip::tcp::socket client_side_socket;
+  asio::ip::tcp::socket server_side_socket;
+};
+
+void test()
+{
+  // The default policy depends on the backend, but must still work.
+  connection c1("");
+  for (int i = 0; i < 4; ++i)
+  {
+    (void)c1.receive(true);
+    (void)c1.receive(false);
+  }
+
+#if defined(ASIO_HAS_EPOLL) || defined(ASIO_HAS_IO_URING)
+  connection c2("reactor.speculative_io=0");
+  for (int i = 0; i < 4; ++i)
+    ASIO_CHECK(!c2.receive(true));
+  for (int i = 0; i < 4; ++i)
+    ASIO_CHECK(c2.receive_after_notification());
+
+  connection c3("reactor.speculative_io=1");
+  for (int i = 0; i < 4; ++i)
+  {
+    ASIO_CHECK(c3.receive(true));
+    ASIO_CHECK(!c3.receive(false));
+  }
+
+  // Once most recent attempts would have blocked, the adaptive policy stops
+  // attempting receives until enough of them have been skipped.
+  connection c4("reactor.speculative_io=2");
+  ASIO_CHECK(c4.receive(true));
+  for (int i = 0; i < 4; ++i)
+    ASIO_CHECK(!c4.receive(false));
+  ASIO_CHECK(!c4.receive(true));
+  bool resumed = false;
+  for (int i = 0; i < 8 && !resumed; ++i)
+    resumed = c4.receive(true);
+  ASIO_CHECK(resumed);
+
+  // A receive that the adaptive policy does not attempt must still complete
+  // when the data arrived before it was started.
+  connection c5("reactor.speculative_io=2");
+  for (int i = 0; i < 4; ++i)
+    ASIO_CHECK(!c5.receive(false));
+  ASIO_CHECK(c5.receive_after_notification());
+#endif // defined(ASIO_HAS_EPOLL) || defined(ASIO_HAS_IO_URING)
+}
+
+} // namespace ip_tcp_socket_speculative_io_runtime
+
+//------------------------------------------------------------------------------
+
 // ip_tcp_acceptor_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -1024,6 +1388,163 @@ void test()
 
 //------------------------------------------------------------------------------
 
+// ip_tcp_acceptor_exclusive_accept_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that connections to a listening socket shared by
+// two io_context objects are all accepted when the "reactor" /
+// "epoll_exclusive_accept" option is enabled, and that a small
+// "reactor" / "epoll_max_events" value does not lose events.
+
+namespace ip_tcp_acceptor_exclusive_accept_runtime {
+
+void test()
+{
+#if defined(ASIO_HAS_EPOLL) && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+  namespace ip = asio::ip;
+
+  const char* config =
+    "reactor.epoll_exclusive_accept=1\nreactor.epoll_max_events=1";
+  asio::io_context ioc1(asio::config_from_string{config});
+  asio::io_context ioc2(asio::config_from_string{config});
+
+  ip::tcp::acceptor acceptor1(ioc1,
+      ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  ip::tcp::acceptor acceptor2(ioc2);
+  acceptor2.assign(ip::tcp::v4(), ::dup(acceptor1.native_handle()));
+
+  int accepted = 0;
+  std::function<void(ip::tcp::acceptor&)> start_accept =
+    [&](ip::tcp::acceptor& acceptor)
+    {
+      acceptor.async_accept(
+          [&](const asio::error_code& err, ip::tcp::socket)
+          {
+            ASIO_CHECK(!err);
+            if (!err && ++accepted < 8)
+              start_accept(acceptor);
+          });
+    };
+  start_accept(acceptor1);
+  start_accept(acceptor2);
+
+  asio::io_context client_ioc;
+  ip::tcp::socket clients[8] = {
+    ip::tcp::socket(client_ioc), ip::tcp::socket(client_ioc),
+    ip::tcp::socket(client_ioc), ip::tcp::socket(client_ioc),
+    ip::tcp::socket(client_ioc), ip::tcp::socket(client_ioc),
+    ip::tcp::socket(client_ioc), ip::tcp::socket(client_ioc) };
+  for (int i = 0; i < 8; ++i)
+    clients[i].connect(acceptor1.local_endpoint());
+
+  for (int i = 0; i < 1000 && accepted < 8; ++i)
+  {
+    ioc1.run_for(asio::chrono::milliseconds(1));
+    ioc2.run_for(asio::chrono::milliseconds(1));
+  }
+  ASIO_CHECK(accepted == 8);
+
+  // An exclusive registration cannot wait for writability.
+  asio::error_code wait_err;
+  acceptor1.cancel();
+  ioc1.restart();
+  ioc1.run();
+  acceptor1.async_wait(ip::tcp::acceptor::wait_write,
+      [&wait_err](const asio::error_code& err) { wait_err = err; });
+  ioc1.restart();
+  ioc1.run();
+# if defined(EPOLLEXCLUSIVE)
+  ASIO_CHECK(wait_err == asio::error::operation_not_supported);
+# endif // defined(EPOLLEXCLUSIVE)
+#endif // defined(ASIO_HAS_EPOLL) && !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+}
+
+} // namespace ip_tcp_acceptor_exclusive_accept_runtime
+
+//------------------------------------------------------------------------------
+
+// ip_tcp_socket_epoll_count_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that data is transferred on sockets that are
+// distributed across several epoll instances using the "reactor" /
+// "epoll_count" option, with the io_context run from several threads.
+
+namespace ip_tcp_socket_epoll_count_runtime {
+
+void test()
+{
+  namespace ip = asio::ip;
+
+  const int num_pairs = 8;
+  const std::size_t length = 4096;
+
+  asio::io_context ioc(asio::config_from_string{
+      "reactor.epoll_count=4\nreactor.epoll_max_events=2"});
+
+  ip::tcp::acceptor acceptor(ioc,
+      ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+
+  std::vector<ip::tcp::socket> clients;
+  std::vector<ip::tcp::socket> servers;
+  for (int i = 0; i < num_pairs; ++i)
+  {
+    clients.push_back(ip::tcp::socket(ioc));
+    clients.back().connect(acceptor.local_endpoint());
+    servers.push_back(acceptor.accept());
+  }
+
+  std::vector<char> data(length, 'x');
+  std::vector<std::vector<char>> echoed(num_pairs);
+  std::vector<std::vector<char>> received(num_pairs);
+  std::atomic<int> completed(0);
+
+  for (int i = 0; i < num_pairs; ++i)
+  {
+    echoed[i].resize(length);
+    received[i].resize(length);
+
+    // The server echoes back whatever the client sends.
+    asio::async_read(servers[i], asio::buffer(echoed[i]),
+        [&, i](const asio::error_code& err, std::size_t)
+        {
+          ASIO_CHECK(!err);
+          asio::async_write(servers[i], asio::buffer(echoed[i]),
+              [](const asio::error_code& err, std::size_t n)
+              {
+                ASIO_CHECK(!err);
+                ASIO_CHECK(n == length);
+              });
+        });
+
+    asio::async_read(clients[i], asio::buffer(received[i]),
+        [&, i](const asio::error_code& err, std::size_t n)
+        {
+          ASIO_CHECK(!err);
+          ASIO_CHECK(n == length);
+          ASIO_CHECK(received[i] == data);
+          ++completed;
+        });
+
+    asio::async_write(clients[i], asio::buffer(data),
+        [](const asio::error_code& err, std::size_t n)
+        {
+          ASIO_CHECK(!err);
+          ASIO_CHECK(n == length);
+        });
+  }
+
+  asio::thread thread1([&ioc]{ ioc.run(); });
+  asio::thread thread2([&ioc]{ ioc.run(); });
+  ioc.run();
+  thread1.join();
+  thread2.join();
+
+  ASIO_CHECK(completed == num_pairs);
+}
+
+} // namespace ip_tcp_socket_epoll_count_runtime
+
+//------------------------------------------------------------------------------
+
 // ip_tcp_resolver_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -1280,8 +1801,12 @@ ASIO_TEST_SUITE
   ASIO_TEST_CASE(ip_tcp_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_socket_compile::test)
   ASIO_TEST_CASE(ip_tcp_socket_runtime::test)
+  ASIO_TEST_CASE(ip_tcp_socket_op_slot_runtime::test)
+  ASIO_TEST_CASE(ip_tcp_socket_speculative_io_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_acceptor_compile::test)
   ASIO_TEST_CASE(ip_tcp_acceptor_runtime::test)
+  ASIO_TEST_CASE(ip_tcp_acceptor_exclusive_accept_runtime::test)
+  ASIO_TEST_CASE(ip_tcp_socket_epoll_count_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_resolver_compile::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_resolver_entry_compile::test)
   ASIO_COMPILE_TEST_CASE(ip_tcp_resolver_entry_compile::test)
@@ -0,0 +1,194 @@
+//
+// mapped_file.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/mapped_file.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// mapped_file_compile test
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that all public member functions on the class
+// mapped_file compile and link correctly. Runtime failures are ignored.
+
+namespace mapped_file_compile {
+
+void test()
+{
+#if defined(ASIO_HAS_MAPPED_FILE)
+  using namespace asio;
+
+  try
+  {
+    asio::error_code ec;
+    const std::string path("");
+
+    // mapped_file constructors.
+
+    mapped_file file1;
+    mapped_file file2("");
+    mapped_file file3(path);
+    mapped_file file4(std::move(file2));
+
+    // mapped_file operators.
+
+    file1 = mapped_file("");
+    file1 = std::move(file3);
+
+    // mapped_file functions.
+
+    file1.open("");
+    file1.open("", ec);
+    file1.open(path);
+    file1.open(path, ec);
+
+    bool b = file1.is_open();
+    (void)b;
+
+    file1.close();
+    file1.close(ec);
+
+    const void* p = file1.data();
+    (void)p;
+
+    std::size_t s1 = file1.size();
+    (void)s1;
+
+    const_buffer b1 = file1.buffer();
+    (void)b1;
+
+    const_buffer b2 = file1.buffer(0, 1);
+    (void)b2;
+
+    file1.advise(mapped_file::sequential);
+    file1.advise(mapped_file::random, ec);
+    file1.advise(mapped_file::will_need, 0, 1);
+    file1.advise(mapped_file::dont_need, 0, 1, ec);
+
+    std::size_t s2 = file1.resident_size();
+    (void)s2;
+
+    std::size_t s3 = file1.resident_size(ec);
+    (void)s3;
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_MAPPED_FILE)
+}
+
+} // namespace mapped_file_compile
+
+//------------------------------------------------------------------------------
+
+// mapped_file_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that mapped_file operates correctly at runtime.
+
+namespace mapped_file_runtime {
+
+static const char file_data[]
+  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+void test()
+{
+#if defined(ASIO_HAS_MAPPED_FILE)
+  using namespace std; // For memcmp, fopen, fwrite, fclose and remove.
+  using namespace asio;
+
+  const char* path = "mapped_file_runtime.tmp";
+  FILE* f = fopen(path, "wb");
+  ASIO_CHECK(f != 0);
+  if (!f)
+    return;
+  fwrite(file_data, 1, sizeof(file_data), f);
+  fclose(f);
+
+  try
+  {
+    asio::error_code ec;
+
+    mapped_file file1(path);
+    ASIO_CHECK(file1.is_open());
+    ASIO_CHECK(file1.size() == sizeof(file_data));
+    ASIO_CHECK(memcmp(file1.data(), file_data, sizeof(file_data)) == 0);
+
+    const_buffer b1 = file1.buffer();
+    ASIO_CHECK(b1.data() == file1.data());
+    ASIO_CHECK(b1.size() == sizeof(file_data));
+
+    const_buffer b2 = file1.buffer(26, 10);
+    ASIO_CHECK(b2.size() == 10);
+    ASIO_CHECK(memcmp(b2.data(), file_data + 26, 10) == 0);
+
+    const_buffer b3 = file1.buffer(50, 100);
+    ASIO_CHECK(b3.size() == sizeof(file_data) - 50);
+
+    const_buffer b4 = file1.buffer(sizeof(file_data), 1);
+    ASIO_CHECK(b4.size() == 0);
+
+    file1.advise(mapped_file::sequential, ec);
+    ASIO_CHECK(!ec);
+
+    file1.advise(mapped_file::will_need, 10, 20, ec);
+    ASIO_CHECK(!ec);
+
+    std::size_t resident = file1.resident_size(ec);
+    ASIO_CHECK(!ec || ec == asio::error::operation_not_supported);
+    ASIO_CHECK(resident <= file1.size());
+
+    mapped_file file2(std::move(file1));
+    ASIO_CHECK(!file1.is_open());
+    ASIO_CHECK(file1.size() == 0);
+    ASIO_CHECK(file2.is_open());
+    ASIO_CHECK(file2.size() == sizeof(file_data));
+
+    file2.close(ec);
+    ASIO_CHECK(!ec);
+    ASIO_CHECK(!file2.is_open());
+    ASIO_CHECK(file2.buffer().size() == 0);
+
+    file2.advise(mapped_file::normal, ec);
+    ASIO_CHECK(ec == asio::error::bad_descriptor);
+
+    file2.open("mapped_file_runtime.missing", ec);
+    ASIO_CHECK(!!ec);
+    ASIO_CHECK(!file2.is_open());
+  }
+  catch (std::exception&)
+  {
+    ASIO_CHECK(false);
+  }
+
+  remove(path);
+#endif // defined(ASIO_HAS_MAPPED_FILE)
+}
+
+} // namespace mapped_file_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "mapped_file",
+  ASIO_COMPILE_TEST_CASE(mapped_file_compile::test)
+  ASIO_TEST_CASE(mapped_file_runtime::test)
+)
@@ -0,0 +1,264 @@
+//
+// process.cpp
+// ~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/process.hpp"
+
+#include <functional>
+#include <string>
+#include <utility>
+#if defined(ASIO_HAS_PROCESS)
+# include <sys/wait.h>
+#endif // defined(ASIO_HAS_PROCESS)
+#include "archetypes/async_result.hpp"
+#include "asio/io_context.hpp"
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// process_compile test
+// ~~~~~~~~~~~~~~~~~~~~
+// The following test checks that all public member functions on the class
+// process compile and link correctly. Runtime failures are ignored.
+
+namespace process_compile {
+
+void wait_handler(const asio::error_code&, int)
+{
+}
+
+void test()
+{
+#if defined(ASIO_HAS_PROCESS)
+  using namespace asio;
+
+  try
+  {
+    io_context ioc;
+    const io_context::executor_type ioc_ex = ioc.get_executor();
+    archetypes::lazy_handler lazy;
+    asio::error_code ec;
+    std::vector<std::string> args;
+
+    // basic_process constructors.
+
+    process process1(ioc);
+    process process2(ioc_ex);
+    process process3(std::move(process2));
+
+    // basic_process operators.
+
+    process1 = process(ioc);
+    process1 = std::move(process3);
+
+    // basic_process functions.
+
+    process::executor_type ex = process1.get_executor();
+    (void)ex;
+
+    process1.spawn("/bin/true", args);
+    process1.spawn("/bin/true", args, process::pipe_stdin);
+    process1.spawn("/bin/true", args,
+        process::pipe_stdout | process::pipe_stderr, ec);
+
+    int id = process1.id();
+    (void)id;
+
+    process::writable_pipe_type& in = process1.std_in();
+    (void)in;
+    process::readable_pipe_type& out = process1.std_out();
+    (void)out;
+    process::readable_pipe_type& err = process1.std_err();
+    (void)err;
+
+    bool running = process1.running();
+    running = process1.running(ec);
+    (void)running;
+
+    int code = process1.exit_code();
+
+    process1.request_exit();
+    process1.request_exit(ec);
+
+    process1.terminate();
+    process1.terminate(ec);
+
+    process1.cancel();
+
+    code = process1.wait();
+    code = process1.wait(ec);
+    (void)code;
+
+    process1.async_wait(&wait_handler);
+    int i = process1.async_wait(lazy);
+    (void)i;
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_PROCESS)
+}
+
+} // namespace process_compile
+
+//------------------------------------------------------------------------------
+
+// process_runtime test
+// ~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the process class.
+
+namespace process_runtime {
+
+void wait_handler(const asio::error_code& ec, int exit_code,
+    asio::error_code* out_ec, int* out_exit_code)
+{
+  *out_ec = ec;
+  *out_exit_code = exit_code;
+}
+
+void test()
+{
+#if defined(ASIO_HAS_PROCESS)
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  asio::io_context ioc;
+  asio::error_code ec;
+  int exit_code = -1;
+
+  // The child's standard streams are connected to pipes.
+  asio::process child(ioc);
+  std::vector<std::string> args;
+  args.push_back("-c");
+  args.push_back("read line; echo \"out:$line\"; echo err >&2; exit 3");
+  child.spawn("/bin/sh", args, asio::process::pipe_stdin
+      | asio::process::pipe_stdout | asio::process::pipe_stderr);
+  ASIO_CHECK(child.id() > 0);
+  ASIO_CHECK(child.exit_code() == -1);
+
+  asio::write(child.std_in(), asio::buffer("hello\n", 6));
+  child.std_in().close();
+
+  std::string out, err;
+  asio::read(child.std_out(), asio::dynamic_buffer(out), ec);
+  ASIO_CHECK(ec == asio::error::eof);
+  ASIO_CHECK(out == "out:hello\n");
+  asio::read(child.std_err(), asio::dynamic_buffer(err), ec);
+  ASIO_CHECK(ec == asio::error::eof);
+  ASIO_CHECK(err == "err\n");
+
+  child.async_wait(bindns::bind(wait_handler, _1, _2, &ec, &exit_code));
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(exit_code == 3);
+  ASIO_CHECK(child.exit_code() == 3);
+  ASIO_CHECK(!child.running());
+
+  // Waiting again completes immediately with the same exit code.
+  exit_code = -1;
+  child.async_wait(bindns::bind(wait_handler, _1, _2, &ec, &exit_code));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(exit_code == 3);
+
+  // A terminated child reports the signal number.
+  args.clear();
+  args.push_back("30");
+  child.spawn("/bin/sleep", args);
+  ASIO_CHECK(child.running());
+  child.async_wait(bindns::bind(wait_handler, _1, _2, &ec, &exit_code));
+  child.terminate();
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(exit_code == 128 + SIGKILL);
+
+  // A wait may be cancelled without affecting the child.
+  child.spawn("/bin/sleep", args);
+  child.async_wait(bindns::bind(wait_handler, _1, _2, &ec, &exit_code));
+  child.cancel();
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+  ASIO_CHECK(child.running());
+  child.request_exit();
+  ASIO_CHECK(child.wait() == 128 + SIGTERM);
+
+  // Spawning a missing program fails.
+  asio::process missing(ioc);
+  missing.spawn("/nonexistent/program",
+      std::vector<std::string>(), asio::process::pipe_stdout, ec);
+  ASIO_CHECK(!!ec);
+  ASIO_CHECK(missing.id() == -1);
+  ASIO_CHECK(!missing.std_out().is_open());
+#endif // defined(ASIO_HAS_PROCESS)
+}
+
+void test_move_and_destroy()
+{
+#if defined(ASIO_HAS_PROCESS)
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  asio::io_context ioc;
+  asio::error_code ec;
+  int exit_code = -1;
+  std::vector<std::string> args;
+  args.push_back("30");
+
+  // A wait remains valid when the process object is moved.
+  asio::process child1(ioc);
+  child1.spawn("/bin/sleep", args);
+  child1.async_wait(bindns::bind(wait_handler, _1, _2, &ec, &exit_code));
+  asio::process child2(std::move(child1));
+  ASIO_CHECK(child1.id() == -1);
+  child2.terminate();
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(exit_code == 128 + SIGKILL);
+  ASIO_CHECK(child2.exit_code() == 128 + SIGKILL);
+
+  // Destroying the process object terminates and reaps a running child, and
+  // aborts an outstanding wait.
+  int pid = -1;
+  {
+    asio::process child3(ioc);
+    child3.spawn("/bin/sleep", args);
+    pid = child3.id();
+    child3.async_wait(bindns::bind(wait_handler, _1, _2, &ec, &exit_code));
+  }
+  ASIO_CHECK(::waitpid(pid, 0, WNOHANG) == -1);
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+#endif // defined(ASIO_HAS_PROCESS)
+}
+
+} // namespace process_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "process",
+  ASIO_COMPILE_TEST_CASE(process_compile::test)
+  ASIO_TEST_CASE(process_runtime::test)
+  ASIO_TEST_CASE(process_runtime::test_move_and_destroy)
+)
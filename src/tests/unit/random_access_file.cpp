@@ -20,6 +20,10 @@
 #include "asio/io_context.hpp"
 #include "unit_test.hpp"
 
+#if defined(ASIO_HAS_FILE) && !defined(ASIO_WINDOWS)
+# include <unistd.h>
+#endif // defined(ASIO_HAS_FILE) && !defined(ASIO_WINDOWS)
+
 // random_access_file_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -59,6 +63,8 @@ void test()
     archetypes::lazy_handler lazy;
     asio::error_code ec;
     const std::string path;
+    file_read_request read_requests[2];
+    file_write_request write_requests[2];
 
     // basic_random_access_file constructors.
 
@@ -125,6 +131,11 @@ void test()
     asio::uint64_t s2 = file1.size(ec);
     (void)s2;
 
+    std::size_t a1 = file1.alignment();
+    (void)a1;
+    std::size_t a2 = file1.alignment(ec);
+    (void)a2;
+
     file1.resize(asio::uint64_t(0));
     file1.resize(asio::uint64_t(0), ec);
 
@@ -155,6 +166,23 @@ void test()
         read_some_at_handler());
     int i3 = file1.async_read_some_at(0, buffer(mutable_char_buffer), lazy);
     (void)i3;
+
+    read_requests[0] = file_read_request(0, buffer(mutable_char_buffer));
+    write_requests[0] = file_write_request(0, buffer(const_char_buffer));
+
+    file1.write_batch_at(write_requests, 2);
+    file1.write_batch_at(write_requests, 2, ec);
+
+    file1.async_write_batch_at(write_requests, 2, write_some_at_handler());
+    int i4 = file1.async_write_batch_at(write_requests, 2, lazy);
+    (void)i4;
+
+    file1.read_batch_at(read_requests, 2);
+    file1.read_batch_at(read_requests, 2, ec);
+
+    file1.async_read_batch_at(read_requests, 2, read_some_at_handler());
+    int i5 = file1.async_read_batch_at(read_requests, 2, lazy);
+    (void)i5;
   }
   catch (std::exception&)
   {
@@ -164,8 +192,65 @@ void test()
 
 } // namespace random_access_file_compile
 
+//------------------------------------------------------------------------------
+
+// random_access_file_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime behaviour of random_access_file.
+
+namespace random_access_file_runtime {
+
+void test_cancel_batch()
+{
+#if defined(ASIO_HAS_FILE) && !defined(ASIO_WINDOWS)
+  using namespace asio;
+
+  io_context ioctx;
+
+  // Reads from an empty pipe do not complete until the batch is cancelled.
+  int fds[2];
+  ASIO_CHECK(::pipe(fds) == 0);
+  random_access_file file(ioctx);
+  file.assign(fds[0]);
+
+  char data1[16];
+  char data2[16];
+  file_read_request requests[2] =
+  {
+    file_read_request(0, buffer(data1)),
+    file_read_request(0, buffer(data2))
+  };
+
+  bool called = false;
+  asio::error_code result_ec;
+  file.async_read_batch_at(requests, 2,
+      [&](const asio::error_code& ec, std::size_t)
+      {
+        called = true;
+        result_ec = ec;
+      });
+
+  ioctx.poll();
+  ASIO_CHECK(!called);
+
+  file.cancel();
+  ioctx.restart();
+  ioctx.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(result_ec == asio::error::operation_aborted);
+  ASIO_CHECK(requests[0].error() == asio::error::operation_aborted);
+  ASIO_CHECK(requests[1].error() == asio::error::operation_aborted);
+
+  ::close(fds[1]);
+#endif // defined(ASIO_HAS_FILE) && !defined(ASIO_WINDOWS)
+}
+
+} // namespace random_access_file_runtime
+
 ASIO_TEST_SUITE
 (
   "random_access_file",
   ASIO_COMPILE_TEST_CASE(random_access_file_compile::test)
+  ASIO_TEST_CASE(random_access_file_runtime::test_cancel_batch)
 )
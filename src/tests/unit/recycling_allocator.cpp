@@ -17,8 +17,13 @@
 #include "asio/recycling_allocator.hpp"
 
 #include "unit_test.hpp"
+#include <functional>
 #include <vector>
+#include "asio/config.hpp"
 #include "asio/detail/type_traits.hpp"
+#include "asio/io_context.hpp"
+#include "asio/post.hpp"
+#include "asio/thread.hpp"
 
 void recycling_allocator_test()
 {
@@ -73,8 +78,84 @@ void recycling_allocator_test()
   ASIO_CHECK(v.size() == 42);
 }
 
+typedef std::vector<void*> block_vector;
+
+void allocate_blocks(block_vector* blocks, std::size_t count)
+{
+  asio::recycling_allocator<char> a;
+  for (std::size_t i = 0; i < count; ++i)
+    blocks->push_back(a.allocate(1 + (i * 37) % 5000));
+}
+
+void deallocate_blocks(block_vector* blocks)
+{
+  asio::recycling_allocator<char> a;
+  for (std::size_t i = 0; i < blocks->size(); ++i)
+    a.deallocate(static_cast<char*>((*blocks)[i]), 1 + (i * 37) % 5000);
+  blocks->clear();
+}
+
+void recycling_allocator_cross_thread_test()
+{
+  block_vector blocks;
+
+  // Blocks freed by another thread are reused by the allocating thread.
+  allocate_blocks(&blocks, 1000);
+#if !defined(ASIO_DISABLE_SLAB_RECYCLING)
+  std::size_t reserved = asio::detail::slab_cache::thread_reserved_bytes();
+  ASIO_CHECK(reserved > 0);
+#endif // !defined(ASIO_DISABLE_SLAB_RECYCLING)
+  asio::thread t1(std::bind(deallocate_blocks, &blocks));
+  t1.join();
+  ASIO_CHECK(blocks.empty());
+  allocate_blocks(&blocks, 1000);
+#if !defined(ASIO_DISABLE_SLAB_RECYCLING)
+  ASIO_CHECK(asio::detail::slab_cache::thread_reserved_bytes() == reserved);
+#endif // !defined(ASIO_DISABLE_SLAB_RECYCLING)
+  deallocate_blocks(&blocks);
+
+  // Blocks may outlive the thread that allocated them.
+  asio::thread t2(std::bind(allocate_blocks, &blocks, 1000));
+  t2.join();
+  ASIO_CHECK(blocks.size() == 1000);
+  deallocate_blocks(&blocks);
+
+  // Blocks may be freed while the allocating thread is exiting.
+  block_vector remote_blocks;
+  allocate_blocks(&remote_blocks, 100);
+  asio::thread t3(std::bind(allocate_blocks, &blocks, 1000));
+  deallocate_blocks(&remote_blocks);
+  t3.join();
+  deallocate_blocks(&blocks);
+}
+
+void increment(int* count)
+{
+  ++(*count);
+}
+
+void post_increments(asio::io_context* ioc, int* count)
+{
+  for (int i = 0; i < 1000; ++i)
+    asio::post(*ioc, std::bind(increment, count));
+}
+
+void recycling_allocator_memory_limit_test()
+{
+  asio::io_context ioc(asio::config_from_string(
+        "scheduler.recycling_memory_limit=1"));
+
+  int count = 0;
+  asio::post(ioc, std::bind(post_increments, &ioc, &count));
+  ioc.run();
+
+  ASIO_CHECK(count == 1000);
+}
+
 ASIO_TEST_SUITE
 (
   "recycling_allocator",
   ASIO_TEST_CASE(recycling_allocator_test)
+  ASIO_TEST_CASE(recycling_allocator_cross_thread_test)
+  ASIO_TEST_CASE(recycling_allocator_memory_limit_test)
 )
@@ -0,0 +1,188 @@
+//
+// segmented_buffer.cpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2026 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/segmented_buffer.hpp"
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include "asio/config.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/read.hpp"
+#include "asio/read_until.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+namespace bindns = std;
+using bindns::placeholders::_1;
+using bindns::placeholders::_2;
+
+// Copy the input sequence of a buffer into a string.
+template <typename ConstBufferSequence>
+std::string to_string(const ConstBufferSequence& buffers)
+{
+  std::string s(asio::buffer_size(buffers), '\0');
+  asio::buffer_copy(asio::buffer(&s[0], s.size()), buffers);
+  return s;
+}
+
+// Count the number of buffers in a buffer sequence.
+template <typename BufferSequence>
+std::size_t buffer_count(const BufferSequence& buffers)
+{
+  std::size_t n = 0;
+  for (typename BufferSequence::const_iterator
+      iter = asio::buffer_sequence_begin(buffers),
+      end = asio::buffer_sequence_end(buffers); iter != end; ++iter)
+    ++n;
+  return n;
+}
+
+void test_segmented_storage()
+{
+  asio::io_context ioc(
+      asio::config_from_string("segmented_buffer.block_size=16"));
+
+  asio::segmented_buffer b(ioc);
+  ASIO_CHECK(b.block_size() == 16);
+  ASIO_CHECK(b.size() == 0);
+  ASIO_CHECK(b.capacity() == 0);
+  ASIO_CHECK(buffer_count(b.data()) == 0);
+
+  // The output sequence spans blocks.
+  asio::segmented_buffer::mutable_buffers_type out = b.prepare(40);
+  ASIO_CHECK(asio::buffer_size(out) == 40);
+  ASIO_CHECK(buffer_count(out) == 3);
+  ASIO_CHECK(b.capacity() == 48);
+  const char text[] = "abcdefghijklmnopqrstuvwxyz0123456789ABCD";
+  asio::buffer_copy(out, asio::buffer(text, 40));
+  b.commit(30);
+  ASIO_CHECK(b.size() == 30);
+  ASIO_CHECK(to_string(b.data()) == std::string(text, 30));
+
+  // Data already in the buffer is not moved when the buffer grows.
+  const void* first = (*asio::buffer_sequence_begin(b.data())).data();
+  b.prepare(100);
+  b.commit(0);
+  ASIO_CHECK((*asio::buffer_sequence_begin(b.data())).data() == first);
+  ASIO_CHECK(to_string(b.data()) == std::string(text, 30));
+
+  // Consuming whole blocks releases them from the front of the chain.
+  b.consume(20);
+  ASIO_CHECK(b.size() == 10);
+  ASIO_CHECK(to_string(b.data()) == std::string(text + 20, 10));
+  ASIO_CHECK(buffer_count(b.data()) == 1);
+  ASIO_CHECK(to_string(b.data(2, 5)) == std::string(text + 22, 5));
+  ASIO_CHECK(to_string(b.data(8, 5)) == std::string(text + 28, 2));
+
+  b.consume(100);
+  ASIO_CHECK(b.size() == 0);
+  ASIO_CHECK(b.capacity() == 16);
+
+  // The dynamic buffer adapter supports the DynamicBuffer_v2 operations.
+  asio::dynamic_segmented_buffer d = asio::dynamic_buffer(b);
+  d.grow(20);
+  ASIO_CHECK(d.size() == 20);
+  asio::buffer_copy(d.data(0, 20), asio::buffer(text, 20));
+  d.shrink(5);
+  ASIO_CHECK(to_string(d.data(0, 100)) == std::string(text, 15));
+
+  // Moving the buffer transfers the blocks.
+  asio::segmented_buffer b2(std::move(b));
+  ASIO_CHECK(b.size() == 0);
+  ASIO_CHECK(b2.size() == 15);
+  ASIO_CHECK(to_string(b2.data()) == std::string(text, 15));
+
+  asio::segmented_buffer b3(ioc.get_executor(), 10);
+  bool threw = false;
+  try
+  {
+    b3.prepare(11);
+  }
+  catch (std::length_error&)
+  {
+    threw = true;
+  }
+  ASIO_CHECK(threw);
+
+  ASIO_CHECK(asio::is_dynamic_buffer_v2<
+      asio::dynamic_segmented_buffer>::value);
+#if !defined(ASIO_NO_DYNAMIC_BUFFER_V1)
+  ASIO_CHECK(asio::is_dynamic_buffer_v1<
+      asio::dynamic_segmented_buffer>::value);
+#endif // !defined(ASIO_NO_DYNAMIC_BUFFER_V1)
+}
+
+void read_handler(const asio::error_code& ec, std::size_t n,
+    asio::error_code* out_ec, std::size_t* out_n)
+{
+  *out_ec = ec;
+  *out_n = n;
+}
+
+void test_stream_operations()
+{
+  asio::io_context ioc(
+      asio::config_from_string("segmented_buffer.block_size=8"));
+  asio::ip::tcp::acceptor acceptor(ioc,
+      asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+  asio::ip::tcp::socket client(ioc), server(ioc);
+  client.connect(acceptor.local_endpoint());
+  acceptor.accept(server);
+
+  const std::string message = "GET /index.html HTTP/1.1\r\n\r\nbody";
+  asio::write(client, asio::buffer(message));
+
+  // A delimiter that straddles blocks is found.
+  asio::segmented_buffer b(ioc);
+  std::size_t n = asio::read_until(server,
+      asio::dynamic_buffer(b), "\r\n\r\n");
+  ASIO_CHECK(n == message.size() - 4);
+  ASIO_CHECK(to_string(b.data()).substr(0, n) == message.substr(0, n));
+  b.consume(n);
+
+  // An asynchronous read appends to the remaining data.
+  asio::write(client, asio::buffer("0123456789", 10));
+  asio::error_code ec;
+  std::size_t bytes = 0;
+  asio::async_read(server, asio::dynamic_buffer(b),
+      asio::transfer_exactly(14 - b.size()),
+      bindns::bind(read_handler, _1, _2, &ec, &bytes));
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(to_string(b.data()) == "body0123456789");
+
+  // An asynchronous write sends the input sequence as a gather write.
+  asio::segmented_buffer echo(ioc);
+  asio::async_write(server, asio::dynamic_buffer(b),
+      bindns::bind(read_handler, _1, _2, &ec, &bytes));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == 14);
+  ASIO_CHECK(b.size() == 0);
+
+  asio::read(client, asio::dynamic_buffer(echo), asio::transfer_exactly(14));
+  ASIO_CHECK(to_string(echo.data()) == "body0123456789");
+}
+
+ASIO_TEST_SUITE
+(
+  "segmented_buffer",
+  ASIO_TEST_CASE(test_segmented_storage)
+  ASIO_TEST_CASE(test_stream_operations)
+)
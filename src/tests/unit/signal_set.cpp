@@ -16,6 +16,9 @@
 // Test that header file is self-contained.
 #include "asio/signal_set.hpp"
 
+#include <chrono>
+#include <functional>
+#include <thread>
 #include "archetypes/async_result.hpp"
 #include "asio/io_context.hpp"
 #include "unit_test.hpp"
@@ -91,8 +94,145 @@ void test()
 
 //------------------------------------------------------------------------------
 
+// signal_set_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the signal_set class.
+
+namespace signal_set_runtime {
+
+void wait_handler(const asio::error_code& ec, int signal_number,
+    asio::error_code* out_ec, int* out_signal_number, int* count)
+{
+  *out_ec = ec;
+  *out_signal_number = signal_number;
+  ++*count;
+}
+
+void test()
+{
+#if !defined(ASIO_WINDOWS) \
+  && !defined(ASIO_WINDOWS_RUNTIME) \
+  && !defined(ASIO_CYGWIN_W32_SOCKETS)
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  asio::io_context ioc;
+  asio::signal_set set1(ioc, SIGUSR1);
+  asio::signal_set set2(ioc, SIGUSR1, SIGUSR2);
+
+  // Every set registered for a signal is notified.
+  asio::error_code ec1, ec2;
+  int signal1 = 0, signal2 = 0, count1 = 0, count2 = 0;
+  set1.async_wait(bindns::bind(wait_handler,
+        _1, _2, &ec1, &signal1, &count1));
+  set2.async_wait(bindns::bind(wait_handler,
+        _1, _2, &ec2, &signal2, &count2));
+  ::raise(SIGUSR1);
+  ioc.run();
+  ASIO_CHECK(count1 == 1);
+  ASIO_CHECK(!ec1);
+  ASIO_CHECK(signal1 == SIGUSR1);
+  ASIO_CHECK(count2 == 1);
+  ASIO_CHECK(!ec2);
+  ASIO_CHECK(signal2 == SIGUSR1);
+
+  // A signal that occurs before a wait is started is queued.
+  ::raise(SIGUSR2);
+  ioc.restart();
+  ioc.poll();
+  set2.async_wait(bindns::bind(wait_handler,
+        _1, _2, &ec2, &signal2, &count2));
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(count2 == 2);
+  ASIO_CHECK(!ec2);
+  ASIO_CHECK(signal2 == SIGUSR2);
+
+  // Removing a signal stops its delivery to the set.
+  set2.remove(SIGUSR1);
+  set1.async_wait(bindns::bind(wait_handler,
+        _1, _2, &ec1, &signal1, &count1));
+  set2.async_wait(bindns::bind(wait_handler,
+        _1, _2, &ec2, &signal2, &count2));
+  ::raise(SIGUSR1);
+  ioc.restart();
+  ioc.run_for(std::chrono::milliseconds(50));
+  ASIO_CHECK(count1 == 2);
+  ASIO_CHECK(count2 == 2);
+
+  set2.cancel();
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(count2 == 3);
+  ASIO_CHECK(ec2 == asio::error::operation_aborted);
+#endif // !defined(ASIO_WINDOWS)
+       //   && !defined(ASIO_WINDOWS_RUNTIME)
+       //   && !defined(ASIO_CYGWIN_W32_SOCKETS)
+}
+
+void test_unblocked_thread()
+{
+#if !defined(ASIO_WINDOWS) \
+  && !defined(ASIO_WINDOWS_RUNTIME) \
+  && !defined(ASIO_CYGWIN_W32_SOCKETS)
+  namespace bindns = std;
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  asio::io_context ioc;
+  asio::signal_set set1(ioc, SIGUSR1);
+
+  // A signal raised in a thread where it is not blocked is still delivered.
+  asio::error_code ec1;
+  int signal1 = 0, count1 = 0;
+  set1.async_wait(bindns::bind(wait_handler,
+        _1, _2, &ec1, &signal1, &count1));
+  std::thread t([]()
+      {
+        sigset_t mask;
+        sigemptyset(&mask);
+        sigaddset(&mask, SIGUSR1);
+        ::pthread_sigmask(SIG_UNBLOCK, &mask, 0);
+        ::raise(SIGUSR1);
+      });
+  t.join();
+  ioc.run_for(std::chrono::seconds(1));
+  ASIO_CHECK(count1 == 1);
+  ASIO_CHECK(!ec1);
+  ASIO_CHECK(signal1 == SIGUSR1);
+
+  // Removing the last registration leaves the signal unblocked.
+  set1.clear();
+  sigset_t current;
+  sigemptyset(&current);
+  ::pthread_sigmask(SIG_BLOCK, 0, &current);
+  ASIO_CHECK(!sigismember(&current, SIGUSR1));
+
+  // A signal the application has already blocked stays blocked.
+  sigset_t mask;
+  sigemptyset(&mask);
+  sigaddset(&mask, SIGUSR2);
+  ::pthread_sigmask(SIG_BLOCK, &mask, 0);
+  asio::signal_set set2(ioc, SIGUSR2);
+  set2.clear();
+  sigemptyset(&current);
+  ::pthread_sigmask(SIG_BLOCK, 0, &current);
+  ASIO_CHECK(sigismember(&current, SIGUSR2));
+  ::pthread_sigmask(SIG_UNBLOCK, &mask, 0);
+#endif // !defined(ASIO_WINDOWS)
+       //   && !defined(ASIO_WINDOWS_RUNTIME)
+       //   && !defined(ASIO_CYGWIN_W32_SOCKETS)
+}
+
+} // namespace signal_set_runtime
+
+//------------------------------------------------------------------------------
+
 ASIO_TEST_SUITE
 (
   "signal_set",
   ASIO_COMPILE_TEST_CASE(signal_set_compile::test)
+  ASIO_TEST_CASE(signal_set_runtime::test)
+  ASIO_TEST_CASE(signal_set_runtime::test_unblocked_thread)
 )
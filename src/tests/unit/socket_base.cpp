@@ -177,6 +177,17 @@ void test()
     (void)static_cast<bool>(!enable_connection_aborted1);
     (void)static_cast<bool>(enable_connection_aborted1.value());
 
+    // io_uring_sends class.
+
+    socket_base::io_uring_sends io_uring_sends1(true);
+    sock.set_option(io_uring_sends1);
+    socket_base::io_uring_sends io_uring_sends2;
+    sock.get_option(io_uring_sends2);
+    io_uring_sends1 = true;
+    (void)static_cast<bool>(io_uring_sends1);
+    (void)static_cast<bool>(!io_uring_sends1);
+    (void)static_cast<bool>(io_uring_sends1.value());
+
     // bytes_readable class.
 
     socket_base::bytes_readable bytes_readable;
@@ -638,6 +649,36 @@ void test()
   ASIO_CHECK(!static_cast<bool>(enable_connection_aborted4));
   ASIO_CHECK(!enable_connection_aborted4);
 
+  // io_uring_sends class.
+
+  socket_base::io_uring_sends io_uring_sends1(true);
+  ASIO_CHECK(io_uring_sends1.value());
+  ASIO_CHECK(static_cast<bool>(io_uring_sends1));
+  ASIO_CHECK(!!io_uring_sends1);
+  tcp_sock.set_option(io_uring_sends1, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::io_uring_sends io_uring_sends2;
+  tcp_sock.get_option(io_uring_sends2, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(io_uring_sends2.value());
+  ASIO_CHECK(static_cast<bool>(io_uring_sends2));
+  ASIO_CHECK(!!io_uring_sends2);
+
+  socket_base::io_uring_sends io_uring_sends3(false);
+  ASIO_CHECK(!io_uring_sends3.value());
+  ASIO_CHECK(!static_cast<bool>(io_uring_sends3));
+  ASIO_CHECK(!io_uring_sends3);
+  tcp_sock.set_option(io_uring_sends3, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::io_uring_sends io_uring_sends4;
+  tcp_sock.get_option(io_uring_sends4, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(!io_uring_sends4.value());
+  ASIO_CHECK(!static_cast<bool>(io_uring_sends4));
+  ASIO_CHECK(!io_uring_sends4);
+
   // bytes_readable class.
 
   socket_base::bytes_readable bytes_readable;
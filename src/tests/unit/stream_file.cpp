@@ -16,8 +16,12 @@
 // Test that header file is self-contained.
 #include "asio/stream_file.hpp"
 
+#include <cstdio>
+#include <cstring>
+#include <vector>
 #include "archetypes/async_result.hpp"
 #include "asio/io_context.hpp"
+#include "asio/write.hpp"
 #include "unit_test.hpp"
 
 // stream_file_compile test
@@ -125,6 +129,11 @@ void test()
     asio::uint64_t s2 = file1.size(ec);
     (void)s2;
 
+    std::size_t a1 = file1.alignment();
+    (void)a1;
+    std::size_t a2 = file1.alignment(ec);
+    (void)a2;
+
     file1.resize(asio::uint64_t(0));
     file1.resize(asio::uint64_t(0), ec);
 
@@ -134,6 +143,9 @@ void test()
     file1.sync_data();
     file1.sync_data(ec);
 
+    file1.set_read_ahead(4, 65536);
+    file1.set_read_ahead(0, 0, ec);
+
     asio::uint64_t s3 = file1.seek(0, stream_file::seek_set);
     (void)s3;
     asio::uint64_t s4 = file1.seek(0, stream_file::seek_set, ec);
@@ -166,8 +178,147 @@ void test()
 
 } // namespace stream_file_compile
 
+//------------------------------------------------------------------------------
+
+// stream_file_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// The following tests check the runtime behaviour of stream reads that are
+// satisfied from read-ahead data.
+
+namespace stream_file_runtime {
+
+#if defined(ASIO_HAS_FILE)
+
+const char* const test_file_name = "stream_file_read_ahead.tmp";
+const std::size_t test_file_size = 10 * 4096 + 123;
+
+unsigned char expected_byte(std::size_t offset)
+{
+  return static_cast<unsigned char>(offset % 251);
+}
+
+void create_test_file(asio::io_context& ioc)
+{
+  std::vector<unsigned char> data(test_file_size);
+  for (std::size_t i = 0; i < data.size(); ++i)
+    data[i] = expected_byte(i);
+
+  asio::stream_file file(ioc, test_file_name,
+      asio::stream_file::write_only
+        | asio::stream_file::create
+        | asio::stream_file::truncate);
+  asio::write(file, asio::buffer(data));
+}
+
+std::size_t async_read_some(asio::io_context& ioc, asio::stream_file& file,
+    const asio::mutable_buffer& buffer, asio::error_code& ec)
+{
+  std::size_t n = 0;
+  file.async_read_some(buffer,
+      [&](const asio::error_code& e, std::size_t bytes_transferred)
+      {
+        ec = e;
+        n = bytes_transferred;
+      });
+  ioc.restart();
+  ioc.run();
+  return n;
+}
+
+bool check_data(const unsigned char* data,
+    std::size_t offset, std::size_t length)
+{
+  for (std::size_t i = 0; i < length; ++i)
+    if (data[i] != expected_byte(offset + i))
+      return false;
+  return true;
+}
+
+#endif // defined(ASIO_HAS_FILE)
+
+void test_read_ahead_order()
+{
+#if defined(ASIO_HAS_FILE)
+  asio::io_context ioc;
+  create_test_file(ioc);
+
+  asio::stream_file file(ioc, test_file_name,
+      asio::stream_file::read_only);
+  file.set_read_ahead(4, 4096);
+
+  // Reads smaller than a chunk must deliver the whole file in order.
+  std::vector<unsigned char> data;
+  asio::error_code ec;
+  for (;;)
+  {
+    unsigned char buf[1000];
+    std::size_t n = async_read_some(ioc, file, asio::buffer(buf), ec);
+    if (ec)
+      break;
+    ASIO_CHECK(n > 0);
+    data.insert(data.end(), buf, buf + n);
+  }
+
+  ASIO_CHECK(ec == asio::error::eof);
+  ASIO_CHECK(data.size() == test_file_size);
+  ASIO_CHECK(check_data(data.data(), 0, data.size()));
+
+  file.close();
+  std::remove(test_file_name);
+#endif // defined(ASIO_HAS_FILE)
+}
+
+void test_read_ahead_discard()
+{
+#if defined(ASIO_HAS_FILE)
+  asio::io_context ioc;
+  create_test_file(ioc);
+
+  asio::stream_file file(ioc, test_file_name,
+      asio::stream_file::read_write);
+  file.set_read_ahead(4, 4096);
+
+  unsigned char buf[1000];
+  asio::error_code ec;
+  std::size_t n = async_read_some(ioc, file, asio::buffer(buf), ec);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(n == sizeof(buf));
+  ASIO_CHECK(check_data(buf, 0, n));
+
+  // A seek discards the read-ahead data, and reading resumes from the new
+  // position.
+  ASIO_CHECK(file.seek(5000, asio::stream_file::seek_set) == 5000);
+  n = async_read_some(ioc, file, asio::buffer(buf), ec);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(n == sizeof(buf));
+  ASIO_CHECK(check_data(buf, 5000, n));
+
+  // A write discards the read-ahead data at the position following the last
+  // byte delivered, so the written data is not hidden by stale chunks.
+  const char new_data[] = "XYZ";
+  ASIO_CHECK(file.write_some(asio::buffer(new_data, 3)) == 3);
+  n = async_read_some(ioc, file, asio::buffer(buf), ec);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(n == sizeof(buf));
+  ASIO_CHECK(check_data(buf, 6003, n));
+
+  ASIO_CHECK(file.seek(6000, asio::stream_file::seek_set) == 6000);
+  n = async_read_some(ioc, file, asio::buffer(buf, 3), ec);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(n == 3);
+  ASIO_CHECK(std::memcmp(buf, new_data, 3) == 0);
+
+  file.close();
+  std::remove(test_file_name);
+#endif // defined(ASIO_HAS_FILE)
+}
+
+} // namespace stream_file_runtime
+
 ASIO_TEST_SUITE
 (
   "stream_file",
   ASIO_COMPILE_TEST_CASE(stream_file_compile::test)
+  ASIO_TEST_CASE(stream_file_runtime::test_read_ahead_order)
+  ASIO_TEST_CASE(stream_file_runtime::test_read_ahead_discard)
 )